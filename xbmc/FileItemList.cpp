@@ -16,6 +16,7 @@
 #include "filesystem/MusicDatabaseDirectory.h"
 #include "filesystem/StackDirectory.h"
 #include "filesystem/VideoDatabaseDirectory.h"
+#include "guilib/VirtualItemList.h"
 #include "music/MusicFileItemClassify.h"
 #include "playlists/PlayListFileItemClassify.h"
 #include "settings/AdvancedSettings.h"
@@ -124,6 +125,7 @@ void CFileItemList::ClearItems()
   std::ranges::for_each(m_items, [](const auto& item) { item->FreeMemory(); });
   m_items.clear();
   m_map.clear();
+  m_virtualItems.reset();
 }
 
 void CFileItemList::AddFastLookupItem(const CFileItemPtr& item)
@@ -212,7 +214,7 @@ void CFileItemList::Remove(int iItem)
 {
   std::unique_lock lock(m_lock);
 
-  if (iItem >= 0 && iItem < Size())
+  if (iItem >= 0 && iItem < static_cast<int>(m_items.size()))
   {
     CFileItemPtr pItem = *(m_items.begin() + iItem);
     if (m_fastLookup)
@@ -236,7 +238,11 @@ void CFileItemList::Assign(const CFileItemList& itemlist, bool append)
   if (!append)
     Clear();
 
-  Append(itemlist);
+  // the same virtual list, nothing is fetched
+  if (!append && itemlist.m_virtualItems)
+    m_virtualItems = itemlist.m_virtualItems;
+  else
+    Append(itemlist);
 
   //! @todo Is it intentional not to copy CFileItem properties, except path, label and property map?
   //! This is different from CFileItemList::Copy. Why?
@@ -269,9 +275,16 @@ bool CFileItemList::Copy(const CFileItemList& items, bool copyItems /* = true */
 
   if (copyItems)
   {
-    // make a copy of each item
-    std::ranges::for_each(items,
-                          [this](const auto& item) { Add(std::make_shared<CFileItem>(*item)); });
+    // the same virtual list, its items are only fetched when shown
+    const std::shared_ptr<CVirtualItemList> virtualItems = items.GetVirtualItems();
+    if (virtualItems && IsEmpty())
+      m_virtualItems = virtualItems;
+    else
+    {
+      // make a copy of each item
+      std::ranges::for_each(
+          items, [this](const auto& item) { Add(std::make_shared<CFileItem>(*item)); });
+    }
   }
 
   return true;
@@ -281,6 +294,9 @@ CFileItemPtr CFileItemList::Get(int iItem) const
 {
   std::unique_lock lock(m_lock);
 
+  if (m_virtualItems)
+    return m_virtualItems->Get(iItem);
+
   if (iItem > -1 && iItem < static_cast<int>(m_items.size()))
     return m_items[iItem];
 
@@ -309,15 +325,77 @@ CFileItemPtr CFileItemList::Get(const std::string& strPath) const
 int CFileItemList::Size() const
 {
   std::unique_lock lock(m_lock);
+  if (m_virtualItems)
+    return m_virtualItems->Size();
   return static_cast<int>(m_items.size());
 }
 
 bool CFileItemList::IsEmpty() const
 {
   std::unique_lock lock(m_lock);
+  if (m_virtualItems)
+    return m_virtualItems->Size() == 0;
   return m_items.empty();
 }
 
+void CFileItemList::SetVirtualItems(std::shared_ptr<CVirtualItemList> items)
+{
+  std::unique_lock lock(m_lock);
+  ClearItems();
+  m_virtualItems = std::move(items);
+}
+
+bool CFileItemList::MaterializeVirtualItems()
+{
+  std::shared_ptr<CVirtualItemList> virtualItems;
+  {
+    std::unique_lock lock(m_lock);
+    virtualItems = m_virtualItems;
+  }
+  if (!virtualItems)
+    return true;
+
+  // the list isn't locked while waiting for the source
+  std::vector<CFileItemPtr> items;
+  if (!virtualItems->GetAll(items))
+  {
+    CLog::LogF(LOGERROR, "failed to get the virtual items of {}", CURL::GetRedacted(GetPath()));
+    return false;
+  }
+
+  MaterializeVirtualItems(std::move(items));
+  return true;
+}
+
+void CFileItemList::MaterializeVirtualItems(std::vector<CFileItemPtr>&& items)
+{
+  std::unique_lock lock(m_lock);
+  if (!m_virtualItems)
+    return;
+
+  CLog::LogF(LOGDEBUG, "turning the {} virtual items of {} into a plain list", items.size(),
+             CURL::GetRedacted(GetPath()));
+  m_virtualItems.reset();
+  m_items = std::move(items);
+  if (m_fastLookup)
+  {
+    m_map.clear();
+    AddFastLookupItems(m_items);
+  }
+}
+
+bool CFileItemList::IsVirtualSortedBy(const SortDescription& sortDescription) const
+{
+  std::unique_lock lock(m_lock);
+  if (!m_virtualItems)
+    return false;
+
+  const SortDescription order = m_virtualItems->GetSortDescription();
+  return order.sortBy != SortBy::NONE && order.sortBy == sortDescription.sortBy &&
+         order.sortOrder == sortDescription.sortOrder &&
+         order.sortAttributes == sortDescription.sortAttributes;
+}
+
 void CFileItemList::Reserve(size_t iCount)
 {
   std::unique_lock lock(m_lock);
@@ -339,7 +417,9 @@ void CFileItemList::Sort(SortBy sortBy,
   sorting.sortAttributes = sortAttributes;
 
   Sort(sorting);
-  m_sortDescription = sorting;
+  // a virtual list is only sorted by its source
+  if (!GetVirtualItems() || IsVirtualSortedBy(sorting))
+    m_sortDescription = sorting;
 }
 
 void CFileItemList::Sort(SortDescription sortDescription)
@@ -350,6 +430,15 @@ void CFileItemList::Sort(SortDescription sortDescription)
        m_sortDescription.sortAttributes == sortDescription.sortAttributes))
     return;
 
+  // the source of a virtual list may sort it already, any other order needs all of its items
+  if (IsVirtualSortedBy(sortDescription))
+    return;
+  if (GetVirtualItems())
+  {
+    CLog::LogF(LOGDEBUG, "the virtual items of {} need to be materialized to be sorted",
+               CURL::GetRedacted(GetPath()));
+    return;
+  }
   if (sortDescription.sortAttributes & SortAttributeForceConsiderFolders)
   {
     sortDescription.sortAttributes =
@@ -376,8 +465,8 @@ void CFileItemList::Sort(SortDescription sortDescription)
   }
 
   const Fields fields = SortUtils::GetFieldsForSorting(sortDescription.sortBy);
-  SortItems sortItems(static_cast<size_t>(Size()));
-  for (int index = 0; index < Size(); index++)
+  SortItems sortItems(m_items.size());
+  for (int index = 0; index < static_cast<int>(m_items.size()); index++)
   {
     sortItems[index] = std::make_shared<SortItem>();
     m_items[index]->ToSortable(*sortItems[index], fields);
@@ -389,7 +478,7 @@ void CFileItemList::Sort(SortDescription sortDescription)
 
   // apply the new order to the existing CFileItems
   std::vector<std::shared_ptr<CFileItem>> sortedFileItems;
-  sortedFileItems.reserve(Size());
+  sortedFileItems.reserve(m_items.size());
   for (const auto& sortItem : sortItems)
   {
     std::shared_ptr<CFileItem> item =
@@ -457,7 +546,7 @@ void CFileItemList::Archive(CArchive& ar)
   else
   {
     CFileItemPtr pParent;
-    if (!IsEmpty())
+    if (!m_items.empty())
     {
       const CFileItemPtr pItem = m_items[0];
       if (pItem->IsParentFolder())
@@ -542,6 +631,8 @@ void CFileItemList::FillInDefaultIcons()
 int CFileItemList::GetFolderCount() const
 {
   std::unique_lock lock(m_lock);
+  if (m_virtualItems)
+    return 0;
   return static_cast<int>(
       std::ranges::count_if(m_items, [](const auto& pItem) { return pItem->IsFolder(); }));
 }
@@ -549,6 +640,8 @@ int CFileItemList::GetFolderCount() const
 int CFileItemList::GetObjectCount() const
 {
   std::unique_lock lock(m_lock);
+  if (m_virtualItems)
+    return m_virtualItems->Size();
 
   auto numObjects = static_cast<int>(m_items.size());
   if (numObjects && m_items[0]->IsParentFolder())
@@ -560,6 +653,8 @@ int CFileItemList::GetObjectCount() const
 int CFileItemList::GetFileCount() const
 {
   std::unique_lock lock(m_lock);
+  if (m_virtualItems)
+    return m_virtualItems->Size();
   return static_cast<int>(
       std::ranges::count_if(m_items, [](const auto& pItem) { return !pItem->IsFolder(); }));
 }
@@ -734,7 +829,7 @@ void CFileItemList::Stack()
   }
 
   std::vector<StackCandidate> stackCandidates;
-  for (int i = 0; i < Size(); ++i)
+  for (int i = 0; i < static_cast<int>(m_items.size()); ++i)
   {
     const auto& item{m_items[i]};
     if (item->IsFolder() || VIDEO::IsDVDFile(*item) || VIDEO::IsBDFile(*item))
@@ -897,8 +992,9 @@ bool CFileItemList::Load(int windowID)
 
 bool CFileItemList::Save(int windowID)
 {
+  // virtual items are paged in from their source, they aren't cached
   int iSize = Size();
-  if (iSize <= 0)
+  if (iSize <= 0 || m_virtualItems)
     return false;
 
   CLog::Log(LOGDEBUG, "Saving fileitems [{}]", CURL::GetRedacted(GetPath()));
@@ -987,6 +1083,7 @@ bool CFileItemList::AlwaysCache() const
 
 void CFileItemList::Swap(unsigned int item1, unsigned int item2)
 {
+  std::unique_lock lock(m_lock);
   if (item1 != item2 && item1 < m_items.size() && item2 < m_items.size())
     std::swap(m_items[item1], m_items[item2]);
 }
@@ -17,12 +17,15 @@
 #include "threads/CriticalSection.h"
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+class CVirtualItemList;
+
 //! item property set by the video library scanner on subfolders whose fast hash matches
 //! the stored hash; Stack() skips the disc structure probes for such folders
 static constexpr const char* PROPERTY_UNCHANGED{"scanner:unchanged"};
@@ -196,6 +199,33 @@ public:
   void SetContent(std::string_view content) { m_content = content; }
   const std::string& GetContent() const { return m_content; }
 
+  /*! \brief Back this list by a virtual list, whose items are materialized when shown.
+   Size(), IsEmpty() and Get(int) then refer to the virtual items, copies share the virtual list.
+   Anything else, like iterating, filtering, adding or removing items or sorting in another order
+   than the source does, only sees the plain items. Callers needing all of the items call
+   MaterializeVirtualItems() first.
+   \param items the virtual list, empty pointer to go back to an empty plain list.
+   \sa CVirtualItemList
+   */
+  void SetVirtualItems(std::shared_ptr<CVirtualItemList> items);
+  const std::shared_ptr<CVirtualItemList>& GetVirtualItems() const { return m_virtualItems; }
+
+  /*! \brief Turn a virtual list into a plain list holding all of its items, with their full
+   details. Waits for the whole list to be fetched from the source, so never call it on the GUI
+   thread, fetch the items in a job with CVirtualItemList::GetAll() instead.
+   \return true on success or for a plain list, false if the source failed.
+   */
+  bool MaterializeVirtualItems();
+
+  /*! \brief Turn a virtual list into a plain list holding the given items.
+   \param items all of the items of the virtual list, as fetched by CVirtualItemList::GetAll().
+   */
+  void MaterializeVirtualItems(std::vector<std::shared_ptr<CFileItem>>&& items);
+
+  /*! \brief Whether this is a virtual list whose source sorts it as given.
+   */
+  bool IsVirtualSortedBy(const SortDescription& sortDescription) const;
+
   void ClearSortState();
 
   auto begin() { return m_items.begin(); }
@@ -250,6 +280,7 @@ private:
   CacheType m_cacheToDisc = CacheType::IF_SLOW;
   bool m_replaceListing = false;
   std::string m_content;
+  std::shared_ptr<CVirtualItemList> m_virtualItems;
 
   std::vector<GUIViewSortDetails> m_sortDetails;
 
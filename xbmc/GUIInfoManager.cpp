@@ -17,6 +17,7 @@
 #include "cores/DataCacheCore.h"
 #include "filesystem/File.h"
 #include "games/tags/GameInfoTag.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/guiinfo/GUIInfo.h"
 #include "guilib/guiinfo/GUIInfoHelper.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
@@ -25,6 +26,8 @@
 #include "interfaces/info/InfoExpression.h"
 #include "messaging/ApplicationMessenger.h"
 #include "playlists/PlayListTypes.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "settings/SkinSettings.h"
 #include "utils/ArtUtils.h"
 #include "utils/CharsetConverter.h"
@@ -10821,6 +10824,9 @@ CGUIInfoManager::~CGUIInfoManager() = default;
 void CGUIInfoManager::Initialize()
 {
   CServiceBroker::GetAppMessenger()->RegisterReceiver(this);
+
+  if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiConditionStats)
+    SetEvaluationStatsEnabled(true);
 }
 
 /// \brief Translates a string as given by the skin into an int that we use for more
@@ -12204,6 +12210,9 @@ void CGUIInfoManager::Clear()
   for (const auto& infoBool : m_bools)
     CLog::Log(LOGDEBUG, "Infobool '{}' still used by {} instances", infoBool->GetExpression(),
               infoBool.use_count());
+
+  // the remaining ones may refer to the settings of another skin now
+  ++m_conditionGeneration;
 }
 
 void CGUIInfoManager::UpdateAVInfo() const
@@ -12485,6 +12494,85 @@ void CGUIInfoManager::ResetCache()
   ++m_refreshCounter;
 }
 
+const GUIINFO::IGUIInfoProvider* CGUIInfoManager::GetChangeTracker(int condition) const
+{
+  condition = std::abs(condition);
+  if (condition >= LISTITEM_START && condition <= LISTITEM_END)
+    return nullptr;
+
+  const auto settings = CServiceBroker::GetSettingsComponent();
+  if (!settings || !settings->GetAdvancedSettings() ||
+      !settings->GetAdvancedSettings()->m_guiIncrementalConditions)
+    return nullptr;
+
+  if (condition >= MULTI_INFO_START && condition <= MULTI_INFO_END)
+    return m_infoProviders.GetChangeTracker(m_multiInfo[condition - MULTI_INFO_START]);
+
+  return m_infoProviders.GetChangeTracker(CGUIInfo(condition));
+}
+
+void CGUIInfoManager::CountEvaluation(int contextWindow, bool evaluated)
+{
+  if (!m_evaluationStatsEnabled && !CGUIFrameProfiler::IsEnabled())
+    return;
+
+  std::unique_lock lock(m_evaluationStatsSection);
+  EvaluationStats& stats = m_evaluationStats[contextWindow];
+  if (evaluated)
+    ++stats.evaluated;
+  else
+    ++stats.skipped;
+}
+
+void CGUIInfoManager::SetEvaluationStatsEnabled(bool enabled)
+{
+  std::unique_lock lock(m_evaluationStatsSection);
+  m_evaluationStatsEnabled = enabled;
+  m_evaluationStats.clear();
+  m_lastEvaluationStats.clear();
+}
+
+std::map<int, CGUIInfoManager::EvaluationStats> CGUIInfoManager::GetEvaluationStats() const
+{
+  std::unique_lock lock(m_evaluationStatsSection);
+  return m_lastEvaluationStats;
+}
+
+void CGUIInfoManager::FinishEvaluationStats()
+{
+  if (!m_evaluationStatsEnabled && !CGUIFrameProfiler::IsEnabled())
+    return;
+
+  std::unique_lock lock(m_evaluationStatsSection);
+  m_lastEvaluationStats.clear();
+  m_lastEvaluationStats.swap(m_evaluationStats);
+
+  if (CGUIFrameProfiler::IsEnabled())
+  {
+    EvaluationStats total;
+    for (const auto& [window, stats] : m_lastEvaluationStats)
+    {
+      total.evaluated += stats.evaluated;
+      total.skipped += stats.skipped;
+    }
+    CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+    profiler.RecordCounter("conditions evaluated", total.evaluated);
+    profiler.RecordCounter("conditions unchanged", total.skipped);
+  }
+
+  if (!m_evaluationStatsEnabled)
+    return;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (now - m_evaluationStatsLogged < std::chrono::seconds(10))
+    return;
+
+  m_evaluationStatsLogged = now;
+  for (const auto& [window, stats] : m_lastEvaluationStats)
+    CLog::Log(LOGDEBUG, "CGUIInfoManager: window {}: {} conditions evaluated, {} unchanged",
+              window, stats.evaluated, stats.skipped);
+}
+
 void CGUIInfoManager::SetCurrentVideoTag(const CVideoInfoTag& tag)
 {
   m_currentFile->SetFromVideoInfoTag(tag);
@@ -14,6 +14,8 @@
 #include "messaging/IMessageTarget.h"
 #include "threads/CriticalSection.h"
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <set>
@@ -158,6 +160,43 @@ public:
    */
   KODI::GUILIB::GUIINFO::CGUIInfoProviders& GetInfoProviders() { return m_infoProviders; }
 
+  /*! \brief Get the provider publishing the changes of a condition.
+   \param condition the translated condition
+   \return the provider, nullptr if the condition has to be evaluated every frame.
+   \sa KODI::GUILIB::GUIINFO::IGUIInfoProvider::TracksChanges
+   */
+  const KODI::GUILIB::GUIINFO::IGUIInfoProvider* GetChangeTracker(int condition) const;
+
+  /*! \brief Generation of the tracked conditions, changes whenever they all need evaluating again.
+   */
+  unsigned int GetConditionGeneration() const { return m_conditionGeneration; }
+
+  struct EvaluationStats
+  {
+    unsigned int evaluated{0}; ///< conditions evaluated
+    unsigned int skipped{0}; ///< tracked conditions whose inputs did not change
+  };
+
+  /*! \brief Count a condition being asked for its value, if counting is enabled.
+   \param contextWindow the window asking
+   \param evaluated whether the condition was evaluated or its value was kept
+   */
+  void CountEvaluation(int contextWindow, bool evaluated);
+
+  /*! \brief Enable counting the conditions evaluated per window and frame.
+   */
+  void SetEvaluationStatsEnabled(bool enabled);
+
+  /*! \brief Get the conditions evaluated in the last frame, per window.
+   \return the counts, empty if counting is disabled.
+   */
+  std::map<int, EvaluationStats> GetEvaluationStats() const;
+
+  /*! \brief Make the conditions counted since the last call the stats of the last frame.
+   Called once the frame has been rendered.
+   */
+  void FinishEvaluationStats();
+
 private:
   /*! \brief class for holding information on properties
    */
@@ -248,5 +287,13 @@ private:
 
   CCriticalSection m_critInfo;
 
+  std::atomic<unsigned int> m_conditionGeneration{1};
+
+  std::atomic_bool m_evaluationStatsEnabled{false};
+  std::map<int, EvaluationStats> m_evaluationStats;
+  std::map<int, EvaluationStats> m_lastEvaluationStats;
+  std::chrono::steady_clock::time_point m_evaluationStatsLogged;
+  mutable CCriticalSection m_evaluationStatsSection;
+
   KODI::GUILIB::GUIINFO::CGUIInfoProviders m_infoProviders;
 };
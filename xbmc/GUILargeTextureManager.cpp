@@ -21,10 +21,12 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <exception>
 #include <mutex>
+#include <thread>
 
 CImageLoader::CImageLoader(const std::string& path,
                            unsigned int targetWidth,
@@ -58,9 +60,14 @@ bool CImageLoader::DoWork()
 
   if (!loadPath.empty())
   {
-    // direct route - load the image
+    // direct route - load the image, or its GPU ready copy if there is one
     auto start = std::chrono::steady_clock::now();
-    m_texture = CTexture::LoadFromFile(loadPath, m_targetWidth, m_targetHeight, m_aspectRatio);
+    const std::string compressedPath =
+        m_use_cache ? CTextureCache::GetCompressedImage(loadPath) : std::string();
+    if (!compressedPath.empty())
+      m_texture = CTexture::LoadFromFile(compressedPath);
+    if (!m_texture)
+      m_texture = CTexture::LoadFromFile(loadPath, m_targetWidth, m_targetHeight, m_aspectRatio);
 
     auto end = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -102,11 +109,13 @@ bool CImageLoader::DoWork()
 CGUILargeTextureManager::CLargeTexture::CLargeTexture(const std::string& path,
                                                       unsigned int targetWidth,
                                                       unsigned int targetHeight,
-                                                      CAspectRatio::AspectRatio aspectRatio)
+                                                      CAspectRatio::AspectRatio aspectRatio,
+                                                      bool useCache)
   : m_path(path),
     m_targetWidth(targetWidth),
     m_targetHeight(targetHeight),
-    m_aspectRatio(aspectRatio)
+    m_aspectRatio(aspectRatio),
+    m_useCache(useCache)
 {
   m_refCount = 1;
   m_timeToDelete = 0;
@@ -155,10 +164,20 @@ void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture
   {
     const auto width = texture->GetWidth();
     const auto height = texture->GetHeight();
+    m_size = static_cast<size_t>(texture->GetPitch()) * texture->GetRows();
     m_texture.Set(std::move(texture), width, height);
   }
 }
 
+bool CGUILargeTextureManager::CLargeTexture::Matches(const std::string& path,
+                                                     unsigned int targetWidth,
+                                                     unsigned int targetHeight,
+                                                     CAspectRatio::AspectRatio aspectRatio) const
+{
+  return m_path == path && m_targetWidth == targetWidth && m_targetHeight == targetHeight &&
+         m_aspectRatio == aspectRatio;
+}
+
 CGUILargeTextureManager::CGUILargeTextureManager() = default;
 
 CGUILargeTextureManager::~CGUILargeTextureManager() = default;
@@ -178,6 +197,13 @@ void CGUILargeTextureManager::CleanupUnusedImages(bool immediately)
   }
 }
 
+bool CGUILargeTextureManager::SetRequestsOffscreen(bool offscreen)
+{
+  const bool previous = m_offscreen;
+  m_offscreen = offscreen;
+  return previous;
+}
+
 // if available, increment reference count, and return the image.
 // else, add to the queue list if appropriate.
 bool CGUILargeTextureManager::GetImage(const std::string& path,
@@ -192,8 +218,7 @@ bool CGUILargeTextureManager::GetImage(const std::string& path,
   for (listIterator it = m_allocated.begin(); it != m_allocated.end(); ++it)
   {
     CLargeTexture *image = *it;
-    if (image->GetPath() == path && image->GetTargetWidth() == width &&
-        image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
+    if (image->Matches(path, width, height, aspectRatio))
     {
       if (firstRequest)
         image->AddRef();
@@ -202,6 +227,50 @@ bool CGUILargeTextureManager::GetImage(const std::string& path,
     }
   }
 
+  const unsigned int frameTime = CTimeUtils::GetFrameTime();
+  for (listIterator it = m_loaded.begin(); it != m_loaded.end(); ++it)
+  {
+    CLargeTexture* image = *it;
+    if (image->Matches(path, width, height, aspectRatio))
+    {
+      if (firstRequest)
+        image->AddRef();
+
+      // the texture is uploaded when it is first rendered, hand it out within this frame's budget
+      const unsigned int uploadLimit =
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiTextureUploadLimit;
+      m_scheduler.SetUploadLimit(static_cast<size_t>(uploadLimit) * 1024);
+      if (!m_scheduler.ReserveUpload(image->GetSize(), !m_offscreen, frameTime))
+        return true; // not ready as yet
+
+      m_loaded.erase(it);
+      m_allocated.push_back(image);
+      texture = image->GetTexture();
+      return texture.size() > 0;
+    }
+  }
+
+  for (CLargeTexture* image : m_queued)
+  {
+    if (image->Matches(path, width, height, aspectRatio))
+    {
+      if (firstRequest)
+        image->AddRef();
+      m_scheduler.Touch(image, !m_offscreen, frameTime);
+      return true;
+    }
+  }
+
+  for (const auto& [jobID, image] : m_loading)
+  {
+    if (image && image->Matches(path, width, height, aspectRatio))
+    {
+      if (firstRequest)
+        image->AddRef();
+      return true;
+    }
+  }
+
   if (firstRequest)
     QueueImage(path, width, height, aspectRatio, useCache);
 
@@ -218,31 +287,56 @@ void CGUILargeTextureManager::ReleaseImage(const std::string& path,
   for (listIterator it = m_allocated.begin(); it != m_allocated.end(); ++it)
   {
     CLargeTexture *image = *it;
-    if (image->GetPath() == path && image->GetTargetWidth() == width &&
-        image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
+    if (image->Matches(path, width, height, aspectRatio))
     {
       if (image->DecrRef(immediately) && immediately)
         m_allocated.erase(it);
       return;
     }
   }
-  for (queueIterator it = m_queued.begin(); it != m_queued.end(); ++it)
+  for (listIterator it = m_loaded.begin(); it != m_loaded.end(); ++it)
   {
-    unsigned int id = it->first;
-    CLargeTexture *image = it->second;
-    if (image->GetPath() == path && image->GetTargetWidth() == width &&
-        image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio &&
-        image->DecrRef(true))
+    CLargeTexture* image = *it;
+    if (image->Matches(path, width, height, aspectRatio))
     {
-      // cancel this job
-      CServiceBroker::GetJobManager()->CancelJob(id);
-      m_queued.erase(it);
+      // keep it around for a while like any other unused image
+      if (image->DecrRef(immediately))
+      {
+        m_loaded.erase(it);
+        if (!immediately)
+          m_allocated.push_back(image);
+      }
+      return;
+    }
+  }
+  for (listIterator it = m_queued.begin(); it != m_queued.end(); ++it)
+  {
+    CLargeTexture* image = *it;
+    if (image->Matches(path, width, height, aspectRatio))
+    {
+      // no loader has started on it yet
+      if (image->DecrRef(true))
+      {
+        m_scheduler.Remove(image);
+        m_queued.erase(it);
+      }
+      return;
+    }
+  }
+  for (auto& [jobID, image] : m_loading)
+  {
+    if (image && image->Matches(path, width, height, aspectRatio))
+    {
+      // the loader keeps running, cancelling it would drop our callback while it still occupies a
+      // job worker. Its slot is freed once it completes.
+      if (image->DecrRef(true))
+        image = nullptr;
       return;
     }
   }
 }
 
-// queue the image, and start the background loader if necessary
+// queue the image, and start a loader if one is free
 void CGUILargeTextureManager::QueueImage(const std::string& path,
                                          unsigned int width,
                                          unsigned int height,
@@ -253,38 +347,57 @@ void CGUILargeTextureManager::QueueImage(const std::string& path,
     return;
 
   std::unique_lock lock(m_listSection);
-  for (queueIterator it = m_queued.begin(); it != m_queued.end(); ++it)
+  CLargeTexture* image = new CLargeTexture(path, width, height, aspectRatio, useCache);
+  m_queued.push_back(image);
+  m_scheduler.Queue(image, !m_offscreen, CTimeUtils::GetFrameTime());
+  StartLoaders();
+}
+
+void CGUILargeTextureManager::StartLoaders()
+{
+  const unsigned int maxLoaders = GetMaxLoaders();
+  CLargeTexture* image = nullptr;
+  while (m_loading.size() < maxLoaders && m_scheduler.Pop(image))
   {
-    CLargeTexture *image = it->second;
-    if (image->GetPath() == path && image->GetTargetWidth() == width &&
-        image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
-    {
-      image->AddRef();
-      return; // already queued
-    }
+    std::erase(m_queued, image);
+    const unsigned int jobID = CServiceBroker::GetJobManager()->AddJob(
+        new CImageLoader(image->GetPath(), image->GetTargetWidth(), image->GetTargetHeight(),
+                         image->GetAspectRatio(), image->GetUseCache()),
+        this, CJob::PRIORITY_NORMAL);
+    m_loading.emplace_back(jobID, image);
   }
+}
 
-  // queue the item
-  CLargeTexture* image = new CLargeTexture(path, width, height, aspectRatio);
-  unsigned int jobID = CServiceBroker::GetJobManager()->AddJob(
-      new CImageLoader(path, width, height, aspectRatio, useCache), this, CJob::PRIORITY_NORMAL);
-  m_queued.emplace_back(jobID, image);
+unsigned int CGUILargeTextureManager::GetMaxLoaders()
+{
+  const unsigned int loaders =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiTextureLoaders;
+  if (loaders)
+    return loaders;
+
+  // leave job workers for scans and caching running at the same time
+  return std::clamp(std::thread::hardware_concurrency() / 2, 2u, 8u);
 }
 
 void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJob *job)
 {
   // see if we still have this job id
   std::unique_lock lock(m_listSection);
-  for (queueIterator it = m_queued.begin(); it != m_queued.end(); ++it)
+  for (queueIterator it = m_loading.begin(); it != m_loading.end(); ++it)
   {
     if (it->first == jobID)
     { // found our job
       CImageLoader *loader = static_cast<CImageLoader*>(job);
       CLargeTexture *image = it->second;
-      image->SetTexture(std::move(loader->m_texture));
-      loader->m_texture = NULL; // we want to keep the texture, and jobs are auto-deleted.
-      m_queued.erase(it);
-      m_allocated.push_back(image);
+      m_loading.erase(it);
+      // released while loading, the texture goes with the job
+      if (image)
+      {
+        image->SetTexture(std::move(loader->m_texture));
+        loader->m_texture = NULL; // we want to keep the texture, and jobs are auto-deleted.
+        m_loaded.push_back(image);
+      }
+      StartLoaders();
       return;
     }
   }
@@ -10,6 +10,7 @@
 
 #include "guilib/AspectRatio.h"
 #include "guilib/TextureManager.h"
+#include "guilib/TextureStreamScheduler.h"
 #include "jobs/IJobCallback.h"
 #include "jobs/Job.h"
 #include "threads/CriticalSection.h"
@@ -61,6 +62,10 @@ private:
  Used to load textures for the user interface asynchronously, allowing fluid framerates
  while background loading textures.
 
+ Images wait in a CTextureStreamScheduler until one of a few loaders is free, so that on-screen
+ images load before the ones containers only preload and before those a fast scroll has passed.
+ Loaded images are handed out within an upload budget per frame to avoid frame time spikes.
+
  \sa IJobCallback, CGUITexture
  */
 class CGUILargeTextureManager : public IJobCallback
@@ -132,6 +137,17 @@ public:
    */
   void CleanupUnusedImages(bool immediately = false);
 
+  /*!
+   \brief Mark the images requested from now on as off-screen or on-screen.
+
+   Containers mark the items outside of their viewport, which they only process to preload
+   their images, so that on-screen images are loaded and uploaded first.
+
+   \param offscreen whether the next requests come from off-screen controls.
+   \return the previous state, to be restored by the caller.
+   */
+  bool SetRequestsOffscreen(bool offscreen);
+
 private:
   class CLargeTexture
   {
@@ -139,7 +155,8 @@ private:
     explicit CLargeTexture(const std::string& path,
                            unsigned int targetWidth,
                            unsigned int targetHeight,
-                           CAspectRatio::AspectRatio aspectRatio);
+                           CAspectRatio::AspectRatio aspectRatio,
+                           bool useCache);
     virtual ~CLargeTexture();
 
     void AddRef();
@@ -152,6 +169,12 @@ private:
     unsigned int GetTargetWidth() const { return m_targetWidth; }
     unsigned int GetTargetHeight() const { return m_targetHeight; }
     CAspectRatio::AspectRatio GetAspectRatio() const { return m_aspectRatio; }
+    bool GetUseCache() const { return m_useCache; }
+    size_t GetSize() const { return m_size; }
+    bool Matches(const std::string& path,
+                 unsigned int targetWidth,
+                 unsigned int targetHeight,
+                 CAspectRatio::AspectRatio aspectRatio) const;
 
   private:
     static const unsigned int TIME_TO_DELETE = 2000;
@@ -162,6 +185,8 @@ private:
     unsigned int m_targetWidth;
     unsigned int m_targetHeight;
     CAspectRatio::AspectRatio m_aspectRatio;
+    bool m_useCache;
+    size_t m_size{0}; ///< bytes of texture data to upload
     unsigned int m_timeToDelete;
   };
 
@@ -171,11 +196,23 @@ private:
                   CAspectRatio::AspectRatio aspectRatio,
                   bool useCache = true);
 
-  std::vector< std::pair<unsigned int, CLargeTexture *> > m_queued;
+  /*!
+   \brief Start loaders for the most wanted queued images while there are free ones.
+   */
+  void StartLoaders();
+  static unsigned int GetMaxLoaders();
+
+  std::vector<CLargeTexture*> m_queued; ///< waiting for a loader, in m_scheduler order
+  std::vector<std::pair<unsigned int, CLargeTexture*>>
+      m_loading; ///< by loader job id, null once released while loading
+  std::vector<CLargeTexture*> m_loaded; ///< waiting for their upload budget
   std::vector<CLargeTexture *> m_allocated;
   typedef std::vector<CLargeTexture *>::iterator listIterator;
   typedef std::vector< std::pair<unsigned int, CLargeTexture *> >::iterator queueIterator;
 
+  CTextureStreamScheduler<CLargeTexture*> m_scheduler;
+  bool m_offscreen{false};
+
   CCriticalSection m_listSection;
 };
 
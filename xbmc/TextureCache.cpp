@@ -23,23 +23,47 @@
 #include "jobs/Job.h"
 #include "jobs/JobManager.h"
 #include "profiles/ProfileManager.h"
+#include "rendering/RenderSystem.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/Crc32.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <mutex>
 #include <optional>
 #include <string.h>
+#include <thread>
 
 using namespace XFILE;
 using namespace std::chrono_literals;
 
+namespace
+{
+// cached images written to the database in one transaction
+constexpr size_t DATABASE_BATCH_SIZE = 50;
+
+unsigned int GetCachingThreads()
+{
+  const unsigned int threads =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageCacheThreads;
+  if (threads > 0)
+    return threads;
+
+  // decoding and scaling is CPU bound, leave room for the GUI and playback
+  return std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+}
+} // namespace
+
 CTextureCache::CTextureCache()
-  : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE), m_cleanTimer{[this]() { CleanTimer(); }}
+  : CJobQueue(false, GetCachingThreads(), CJob::PRIORITY_LOW_PAUSABLE),
+    m_cleanTimer{[this]() { CleanTimer(); }},
+    m_maxFetching{
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageCacheFetches}
 {
 }
 
@@ -57,6 +81,7 @@ void CTextureCache::Deinitialize()
 {
   m_cleanTimer.Stop(true);
   CancelJobs();
+  FlushCachedTextures();
 
   std::unique_lock lock(m_databaseSection);
   m_database.Close();
@@ -168,6 +193,7 @@ std::string CTextureCache::CacheImage(
     CTextureCacheJob job(url);
     bool success = job.CacheTexture(texture);
     OnCachingComplete(success, &job);
+    FlushCachedTexturesIfIdle();
     if (success && details)
       *details = job.m_details;
     return success ? GetCachedPath(job.m_details.file) : "";
@@ -246,15 +272,81 @@ bool CTextureCache::ClearCachedImage(int id)
 bool CTextureCache::GetCachedTexture(const std::string &url, CTextureDetails &details)
 {
   std::unique_lock lock(m_databaseSection);
+  const auto pending = m_pendingTextures.find(url);
+  if (pending != m_pendingTextures.end())
+  {
+    details = pending->second;
+    return true;
+  }
   return m_database.GetCachedTexture(url, details);
 }
 
 bool CTextureCache::AddCachedTexture(const std::string &url, const CTextureDetails &details)
 {
   std::unique_lock lock(m_databaseSection);
+  m_pendingTextures.erase(url);
   return m_database.AddCachedTexture(url, details);
 }
 
+void CTextureCache::QueueCachedTexture(const std::string& url, const CTextureDetails& details)
+{
+  std::unique_lock lock(m_databaseSection);
+  m_pendingTextures.insert_or_assign(url, details);
+  if (m_pendingTextures.size() >= DATABASE_BATCH_SIZE)
+    WritePendingTextures();
+}
+
+void CTextureCache::FlushCachedTextures()
+{
+  std::unique_lock lock(m_databaseSection);
+  if (m_pendingTextures.empty())
+    return;
+
+  WritePendingTextures();
+}
+
+void CTextureCache::WritePendingTextures()
+{
+  if (!m_database.AddCachedTextures(m_pendingTextures))
+  {
+    // the whole transaction was rolled back, add the images one by one so that a single bad
+    // entry doesn't lose the others
+    CLog::Log(LOGWARNING, "{} - unable to add {} cached images at once, adding them one by one",
+              __FUNCTION__, m_pendingTextures.size());
+    for (const auto& [url, details] : m_pendingTextures)
+    {
+      if (!m_database.AddCachedTexture(url, details))
+        CLog::Log(LOGERROR, "{} - unable to add cached image {}", __FUNCTION__, url);
+    }
+  }
+  m_pendingTextures.clear();
+}
+
+void CTextureCache::FlushCachedTexturesIfIdle()
+{
+  if (!IsProcessing())
+    FlushCachedTextures();
+}
+
+bool CTextureCache::FetchImage(const std::string& path, std::vector<uint8_t>& buffer)
+{
+  {
+    std::unique_lock lock(m_fetchSection);
+    m_fetchCondition.wait(lock, [this] { return m_fetching < m_maxFetching; });
+    m_fetching++;
+  }
+
+  CFile file;
+  const bool success = file.LoadFile(path, buffer) > 0;
+
+  {
+    std::unique_lock lock(m_fetchSection);
+    m_fetching--;
+  }
+  m_fetchCondition.notify();
+  return success;
+}
+
 void CTextureCache::IncrementUseCount(const CTextureDetails &details)
 {
   static const size_t count_before_update = 100;
@@ -270,18 +362,21 @@ void CTextureCache::IncrementUseCount(const CTextureDetails &details)
 
 bool CTextureCache::SetCachedTextureValid(const std::string &url, bool updateable)
 {
+  FlushCachedTextures();
   std::unique_lock lock(m_databaseSection);
   return m_database.SetCachedTextureValid(url, updateable);
 }
 
 bool CTextureCache::ClearCachedTexture(const std::string &url, std::string &cachedURL)
 {
+  FlushCachedTextures();
   std::unique_lock lock(m_databaseSection);
   return m_database.ClearCachedTexture(url, cachedURL);
 }
 
 bool CTextureCache::ClearCachedTexture(int id, std::string &cachedURL)
 {
+  FlushCachedTextures();
   std::unique_lock lock(m_databaseSection);
   return m_database.ClearCachedTexture(id, cachedURL);
 }
@@ -301,6 +396,33 @@ std::string CTextureCache::GetCachedPath(const std::string &file)
   return URIUtils::AddFileToFolder(profileManager->GetThumbnailsFolder(), file);
 }
 
+std::string CTextureCache::GetCompressedImage(const std::string& cachedImage)
+{
+  if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageCacheCompressed)
+    return {};
+
+  const std::shared_ptr<CProfileManager> profileManager =
+      CServiceBroker::GetSettingsComponent()->GetProfileManager();
+  if (!URIUtils::PathHasParent(cachedImage, profileManager->GetThumbnailsFolder(), true) ||
+      !URIUtils::HasExtension(cachedImage, ".jpg|.png"))
+    return {};
+
+  const CRenderSystemBase* renderSystem = CServiceBroker::GetRenderSystem();
+  if (!renderSystem || !renderSystem->SupportsCompressedTextureFormat(KD_TEX_FMT_S3TC_RGB8))
+    return {};
+
+  // the copy is written after the image, an older one is left over from recaching the image
+  // while the option was disabled
+  const std::string compressedImage = URIUtils::ReplaceExtension(cachedImage, ".dds");
+  struct __stat64 compressedStat;
+  struct __stat64 imageStat;
+  if (CFile::Stat(compressedImage, &compressedStat) != 0 ||
+      CFile::Stat(cachedImage, &imageStat) != 0 || compressedStat.st_mtime < imageStat.st_mtime)
+    return {};
+
+  return compressedImage;
+}
+
 void CTextureCache::OnCachingComplete(bool success, CTextureCacheJob *job)
 {
   if (success)
@@ -308,7 +430,7 @@ void CTextureCache::OnCachingComplete(bool success, CTextureCacheJob *job)
     if (job->m_details.hashRevalidated)
       SetCachedTextureValid(job->m_url, job->m_details.updateable);
     else
-      AddCachedTexture(job->m_url, job->m_details);
+      QueueCachedTexture(job->m_url, job->m_details);
   }
 
   { // remove from our processing list
@@ -325,7 +447,8 @@ void CTextureCache::OnJobComplete(unsigned int jobID, bool success, CJob *job)
 {
   if (strcmp(job->GetType(), CTextureCacheJob::JOB_TYPE_CACHE_IMAGE) == 0)
     OnCachingComplete(success, static_cast<CTextureCacheJob*>(job));
-  return CJobQueue::OnJobComplete(jobID, success, job);
+  CJobQueue::OnJobComplete(jobID, success, job);
+  FlushCachedTexturesIfIdle();
 }
 
 bool CTextureCache::Export(const std::string &image, const std::string &destination, bool overwrite)
@@ -389,6 +512,7 @@ bool CTextureCache::CleanAllUnusedImages()
 
 bool CTextureCache::CleanAllUnusedImagesJob(CGUIDialogProgress* progress)
 {
+  FlushCachedTextures();
   auto cleaner = IMAGE_FILES::CImageCacheCleaner::Create();
   if (!cleaner)
   {
@@ -452,6 +576,7 @@ void CTextureCache::CleanTimer()
 
 std::chrono::milliseconds CTextureCache::ScanOldestCache()
 {
+  FlushCachedTextures();
   auto cleaner = IMAGE_FILES::CImageCacheCleaner::Create();
   if (!cleaner)
     return std::chrono::hours(1);
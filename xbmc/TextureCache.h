@@ -13,12 +13,15 @@
 #include "guilib/AspectRatio.h"
 #include "jobs/JobQueue.h"
 #include "powermanagement/PowerState.h"
+#include "threads/Condition.h"
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
 #include "threads/Timer.h"
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -148,6 +151,14 @@ public:
    */
   static std::string GetCachedPath(const std::string &file);
 
+  /*! \brief retrieve the DXT compressed copy of a cached image, if it is up to date
+   The copies are written by CPicture::CacheTexture while advancedsettings imagecachecompressed
+   is enabled and can be uploaded to the GPU without decoding.
+   \param cachedImage full path of the cached image, as returned from CheckCachedImage
+   \return full path of the .dds copy, empty if there is none or it can't be used
+   */
+  static std::string GetCompressedImage(const std::string& cachedImage);
+
   /*! \brief Add this image to the database
    Thread-safe wrapper of CTextureDatabase::AddCachedTexture
    \param image url of the original image
@@ -156,6 +167,15 @@ public:
    */
   bool AddCachedTexture(const std::string &image, const CTextureDetails &details);
 
+  /*! \brief Read an image file for caching
+   Blocks while the configured number of reads (advancedsettings imagecachefetches) is in
+   flight, so that parallel caching jobs decode in parallel without flooding the source.
+   \param path url of the image file
+   \param buffer [out] the file contents
+   \return true if the file could be read, false otherwise.
+   */
+  bool FetchImage(const std::string& path, std::vector<uint8_t>& buffer);
+
   /*! \brief Export a (possibly) cached image to a file
    \param image url of the original image
    \param destination url of the destination image, excluding extension.
@@ -168,6 +188,11 @@ public:
   bool CleanAllUnusedImages();
 
 private:
+  /*! \brief Write the queued images to the database, one by one if the batch fails
+   Must be called with m_databaseSection held.
+   */
+  void WritePendingTextures();
+
   // private construction, and no assignments; use the provided singleton methods
   CTextureCache(const CTextureCache&) = delete;
   CTextureCache const& operator=(CTextureCache const&) = delete;
@@ -195,6 +220,24 @@ private:
    */
   bool GetCachedTexture(const std::string &url, CTextureDetails &details);
 
+  /*! \brief Queue a cached image for the database
+   Writes are batched into a single transaction, pending entries are visible through
+   GetCachedTexture until then.
+   \param image url of the original image
+   \param details the texture details to add
+   \sa FlushCachedTextures
+   */
+  void QueueCachedTexture(const std::string& image, const CTextureDetails& details);
+
+  /*! \brief Write all queued images to the database
+   \sa QueueCachedTexture
+   */
+  void FlushCachedTextures();
+
+  /*! \brief Write all queued images to the database once no more caching jobs are pending
+   */
+  void FlushCachedTexturesIfIdle();
+
   /*! \brief Clear an image from the database
    Thread-safe wrapper of CTextureDatabase::ClearCachedTexture
    \param image url of the original image
@@ -236,10 +279,16 @@ private:
   CTimer m_cleanTimer;
   CCriticalSection m_databaseSection;
   CTextureDatabase m_database;
+  std::map<std::string, CTextureDetails>
+      m_pendingTextures; ///< cached images not yet in m_database, guarded by m_databaseSection
   std::set<std::string> m_processinglist; ///< currently processing list to avoid 2 jobs being processed at once
   CCriticalSection     m_processingSection;
   CEvent               m_completeEvent; ///< Set whenever a job has finished
   std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
   CCriticalSection             m_useCountSection;
+  CCriticalSection m_fetchSection;
+  XbmcThreads::ConditionVariable m_fetchCondition;
+  unsigned int m_fetching{0}; ///< image files currently being read by FetchImage
+  unsigned int m_maxFetching{1};
 };
 
@@ -26,6 +26,7 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
@@ -91,6 +92,15 @@ bool ShouldCheckForChanges(const std::string& specialType, const std::string& ur
       StringUtils::StartsWith(url, "http://") || StringUtils::StartsWith(url, "https://");
   return !isHTTP;
 }
+
+// dds, xbt and resource files (which may be backed by an xbt) need the texture loader's own
+// handling, anything else can be fetched first and then decoded from memory
+bool CanDecodeFromMemory(const std::string& path, const std::string& mimeType)
+{
+  return !mimeType.empty() && !URIUtils::HasExtension(path, ".dds") &&
+         !URIUtils::IsProtocol(path, "xbt") && !URIUtils::IsProtocol(path, "resource") &&
+         !URIUtils::IsProtocol(path, "androidapp");
+}
 } // namespace
 
 bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
@@ -114,7 +124,14 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     }
   }
 
-  std::unique_ptr<CTexture> texture = LoadImage(imageURL);
+  // CPicture::CacheTexture fits images into a 16:9 box of imageres lines, or fanartres lines
+  // for 16:9 images, so there is no need to decode more than the larger of the two
+  const std::shared_ptr<CAdvancedSettings> advancedSettings =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const unsigned int maxHeight =
+      std::max(advancedSettings->m_imageRes, advancedSettings->m_fanartRes);
+
+  std::unique_ptr<CTexture> texture = LoadImage(imageURL, maxHeight * 16 / 9, maxHeight);
   if (texture)
   {
     if (texture->HasAlpha())
@@ -155,6 +172,8 @@ bool CTextureCacheJob::ResizeTexture(const std::string& url,
   if (image.empty())
     return false;
 
+  // decode at full size, a JPEG decoded at a reduced resolution is only guaranteed to cover the
+  // box, not the size ResizeTexture is asked for
   std::unique_ptr<CTexture> texture = LoadImage(imageURL);
   if (texture == NULL)
     return false;
@@ -165,7 +184,9 @@ bool CTextureCacheJob::ResizeTexture(const std::string& url,
   return success;
 }
 
-std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageFileURL& imageURL)
+std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageFileURL& imageURL,
+                                                      unsigned int fitWidth,
+                                                      unsigned int fitHeight)
 {
   if (imageURL.IsSpecialImage())
   {
@@ -186,8 +207,20 @@ std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageF
     return {};
   }
 
-  auto texture = CTexture::LoadFromFile(imageURL.GetTargetFile(), 0, 0, CAspectRatio::CENTER,
-                                        file.GetMimeType());
+  const std::string& path = imageURL.GetTargetFile();
+  std::unique_ptr<CTexture> texture;
+  const std::shared_ptr<CTextureCache> textureCache = CServiceBroker::GetTextureCache();
+  if (textureCache && CanDecodeFromMemory(path, file.GetMimeType()))
+  {
+    // the texture cache bounds the reads in flight, decoding then runs in parallel
+    std::vector<uint8_t> buffer;
+    if (!textureCache->FetchImage(path, buffer))
+      return {};
+    texture = CTexture::LoadFromFileInMemory(buffer.data(), buffer.size(), file.GetMimeType(), 0, 0,
+                                             CAspectRatio::CENTER, fitWidth, fitHeight);
+  }
+  else
+    texture = CTexture::LoadFromFile(path, 0, 0, CAspectRatio::CENTER, file.GetMimeType());
   if (!texture)
     return {};
 
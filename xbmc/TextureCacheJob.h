@@ -94,9 +94,13 @@ private:
    or smaller than the desired size for speed reasons.
 
    \param image the URL of the image file.
+   \param fitWidth width of the box the image is going to be fit into, 0 to load at full size.
+   \param fitHeight height of the box the image is going to be fit into, 0 to load at full size.
    \return a pointer to a CTexture object, NULL if failed.
    */
-  static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL);
+  static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL,
+                                             unsigned int fitWidth = 0,
+                                             unsigned int fitHeight = 0);
 
   std::string    m_cachePath;
 };
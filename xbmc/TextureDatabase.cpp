@@ -351,27 +351,56 @@ bool CTextureDatabase::AddCachedTexture(const std::string &url, const CTextureDe
       return false;
 
     BeginTransaction();
+    InsertCachedTexture(url, details);
+    CommitTransaction();
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} failed on url '{}'", __FUNCTION__, url);
+    RollbackTransaction();
+  }
+  return true;
+}
 
-    std::string sql = PrepareSQL("DELETE FROM texture WHERE url='%s'", url.c_str());
-    m_pDS->exec(sql);
-
-    std::string date = details.updateable ? CDateTime::GetCurrentDateTime().GetAsDBDateTime() : "";
-    sql = PrepareSQL("INSERT INTO texture (id, url, cachedurl, imagehash, lasthashcheck) VALUES(NULL, '%s', '%s', '%s', '%s')", url.c_str(), details.file.c_str(), details.hash.c_str(), date.c_str());
-    m_pDS->exec(sql);
-    int textureID = (int)m_pDS->lastinsertid();
+bool CTextureDatabase::AddCachedTextures(const std::map<std::string, CTextureDetails>& textures)
+{
+  if (textures.empty())
+    return true;
 
-    // set the size information
-    sql = PrepareSQL("INSERT INTO sizes (idtexture, size, usecount, lastusetime, width, height) VALUES(%u, 1, 1, CURRENT_TIMESTAMP, %u, %u)", textureID, details.width, details.height);
-    m_pDS->exec(sql);
+  try
+  {
+    if (!m_pDB)
+      return false;
+    if (!m_pDS)
+      return false;
 
+    BeginTransaction();
+    for (const auto& [url, details] : textures)
+      InsertCachedTexture(url, details);
     CommitTransaction();
+    return true;
   }
   catch (...)
   {
-    CLog::Log(LOGERROR, "{} failed on url '{}'", __FUNCTION__, url);
+    CLog::Log(LOGERROR, "{} failed on {} textures", __FUNCTION__, textures.size());
     RollbackTransaction();
   }
-  return true;
+  return false;
+}
+
+void CTextureDatabase::InsertCachedTexture(const std::string& url, const CTextureDetails& details)
+{
+  std::string sql = PrepareSQL("DELETE FROM texture WHERE url='%s'", url.c_str());
+  m_pDS->exec(sql);
+
+  std::string date = details.updateable ? CDateTime::GetCurrentDateTime().GetAsDBDateTime() : "";
+  sql = PrepareSQL("INSERT INTO texture (id, url, cachedurl, imagehash, lasthashcheck) VALUES(NULL, '%s', '%s', '%s', '%s')", url.c_str(), details.file.c_str(), details.hash.c_str(), date.c_str());
+  m_pDS->exec(sql);
+  int textureID = (int)m_pDS->lastinsertid();
+
+  // set the size information
+  sql = PrepareSQL("INSERT INTO sizes (idtexture, size, usecount, lastusetime, width, height) VALUES(%u, 1, 1, CURRENT_TIMESTAMP, %u, %u)", textureID, details.width, details.height);
+  m_pDS->exec(sql);
 }
 
 bool CTextureDatabase::ClearCachedTexture(const std::string &url, std::string &cacheFile)
@@ -12,6 +12,7 @@
 #include "dbwrappers/Database.h"
 #include "dbwrappers/DatabaseQuery.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -60,6 +61,7 @@ public:
 
   bool GetCachedTexture(const std::string &originalURL, CTextureDetails &details);
   bool AddCachedTexture(const std::string &originalURL, const CTextureDetails &details);
+  bool AddCachedTextures(const std::map<std::string, CTextureDetails>& textures);
   bool SetCachedTextureValid(const std::string &originalURL, bool updateable);
   bool ClearCachedTexture(const std::string &originalURL, std::string &cacheFile);
   bool ClearCachedTexture(int textureID, std::string &cacheFile);
@@ -127,6 +129,10 @@ protected:
    */
   unsigned int GetURLHash(const std::string &url) const;
 
+  /*! \brief replace the entry of a url, the caller handles the transaction and exceptions
+   */
+  void InsertCachedTexture(const std::string& url, const CTextureDetails& details);
+
   void CreateTables() override;
   void CreateAnalytics() override;
   void UpdateTables(int version) override;
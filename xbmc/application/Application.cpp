@@ -76,6 +76,7 @@
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControlProfiler.h"
 #include "guilib/GUIFontManager.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/StereoscopicsManager.h"
 #include "guilib/TextureManager.h"
@@ -962,6 +963,8 @@ void CApplication::Render()
   // isn't called)
   CGUIInfoManager& infoMgr = CServiceBroker::GetGUI()->GetInfoManager();
   infoMgr.ResetCache();
+  infoMgr.FinishEvaluationStats();
+  CGUIFrameProfiler::GetInstance().EndFrame();
   infoMgr.GetInfoProviders().GetGUIControlsInfoProvider().ResetContainerMovingCache();
 
   if (hasRendered)
@@ -16,6 +16,7 @@
 #include "cores/AudioEngine/AEResampleFactory.h"
 #include "cores/AudioEngine/Encoders/AEEncoderFFmpeg.h"
 #include "cores/AudioEngine/Interfaces/IAudioCallback.h"
+#include "cores/AudioEngine/Utils/AEKernels.h"
 #include "cores/AudioEngine/Utils/AEStreamData.h"
 #include "cores/AudioEngine/Utils/AEStreamInfo.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
@@ -2198,6 +2199,9 @@ bool CActiveAE::RunStages()
               nb_loops = out->pkt->nb_samples;
             }
 
+            // the limiter only looks at the unprocessed samples of each frame, so the gains of
+            // all frames are computed first and applied in one go
+            m_mixGains.resize(nb_loops);
             for(int i=0; i<nb_loops; i++)
             {
               if ((*it)->m_fadingSamples > 0)
@@ -2217,19 +2221,13 @@ bool CActiveAE::RunStages()
               float volume = (*it)->m_volume * (*it)->m_rgain;
               if(nb_loops > 1)
                 volume *= (*it)->m_limiter.Run((float**)out->pkt->data, out->pkt->config.channels, i*nb_floats, out->pkt->planes > 1);
+              m_mixGains[i] = volume;
+            }
 
-              for(int j=0; j<out->pkt->planes; j++)
-              {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
-              }
+            for(int j=0; j<out->pkt->planes; j++)
+            {
+              CAEKernels::MulFrames(reinterpret_cast<float*>(out->pkt->data[j]),
+                                    m_mixGains.data(), nb_loops, nb_floats);
             }
           }
           else
@@ -2265,6 +2263,7 @@ bool CActiveAE::RunStages()
               nb_loops = out->pkt->nb_samples;
             }
 
+            m_mixGains.resize(nb_loops);
             for(int i=0; i<nb_loops; i++)
             {
               if ((*it)->m_fadingSamples > 0)
@@ -2284,30 +2283,17 @@ bool CActiveAE::RunStages()
               float volume = (*it)->m_volume * (*it)->m_rgain;
               if(nb_loops > 1)
                 volume *= (*it)->m_limiter.Run((float**)mix->pkt->data, mix->pkt->config.channels, i*nb_floats, mix->pkt->planes > 1);
+              m_mixGains[i] = volume;
+            }
 
-              for(int j=0; j<out->pkt->planes && j<mix->pkt->planes; j++)
-              {
-                float *dst = (float*)out->pkt->data[j]+i*nb_floats;
-                float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
-              }
+            for(int j=0; j<out->pkt->planes && j<mix->pkt->planes; j++)
+            {
+              const float peak = CAEKernels::MulAddFrames(
+                  reinterpret_cast<float*>(out->pkt->data[j]),
+                  reinterpret_cast<const float*>(mix->pkt->data[j]), m_mixGains.data(), nb_loops,
+                  nb_floats);
+              if (peak > 1.0f)
+                needClamp = true;
             }
             mix->Return();
           }
@@ -2442,11 +2428,10 @@ bool CActiveAE::RunStages()
   busy |= m_sinkBuffers->ResampleBuffers();
   while(!m_sinkBuffers->m_outputSamples.empty())
   {
-    CSampleBuffer *out = NULL;
-    out = m_sinkBuffers->m_outputSamples.front();
+    // if the sink is that far behind, keep the samples for the next run
+    if (!m_sink.QueueSamples(m_sinkBuffers->m_outputSamples.front()))
+      break;
     m_sinkBuffers->m_outputSamples.pop_front();
-    m_sink.m_dataPort.SendOutMessage(CSinkDataProtocol::SAMPLE,
-        &out, sizeof(CSampleBuffer*));
     busy = true;
   }
 
@@ -2695,12 +2680,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEKernels::MulAdd(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2725,13 +2705,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEKernels::Mul(buffer, volume, nb_floats);
     }
   }
 }
@@ -392,6 +392,7 @@ protected:
   std::list<CActiveAEStream*> m_streams;
   std::list<std::unique_ptr<CActiveAEBufferPool>> m_discardBufferPools;
   unsigned int m_streamIdGen;
+  std::vector<float> m_mixGains; // gain per frame of the stream being mixed
 
   // gui sounds
   struct SoundState
@@ -13,6 +13,7 @@
 #include "cores/AudioEngine/Utils/AEBitstreamPacker.h"
 #include "cores/AudioEngine/Utils/AEStreamInfo.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
+#include "cores/DataCacheCore.h"
 #include "utils/EndianSwap.h"
 #include "utils/MemUtils.h"
 #include "utils/log.h"
@@ -56,6 +57,15 @@ void CActiveAESink::Dispose()
   StopThread();
   m_controlPort.Purge();
   m_dataPort.Purge();
+  if (m_pendingDataMsg)
+  {
+    m_pendingDataMsg->Release();
+    m_pendingDataMsg = nullptr;
+  }
+  // the thread is gone, the samples belong to pools of the engine
+  QueuedSamples queued;
+  while (m_sampleQueue.Pop(queued))
+    ;
 
   if (m_sink)
   {
@@ -371,11 +381,9 @@ void CActiveAESink::StateMachine(int signal, Protocol *port, Message *msg)
         switch (signal)
         {
         case CSinkDataProtocol::SAMPLE:
-          CSampleBuffer *samples;
-          samples = *((CSampleBuffer**)msg->data);
-          CThread::Sleep(std::chrono::milliseconds(1000 * samples->pkt->nb_samples /
-                                                   samples->pkt->config.sample_rate));
-          msg->Reply(CSinkDataProtocol::RETURNSAMPLE, &samples, sizeof(CSampleBuffer*));
+          CThread::Sleep(std::chrono::milliseconds(1000 * m_samples->pkt->nb_samples /
+                                                   m_samples->pkt->config.sample_rate));
+          ReturnSamples(m_samples);
           m_extTimeout = 0ms;
           return;
         default:
@@ -428,11 +436,10 @@ void CActiveAESink::StateMachine(int signal, Protocol *port, Message *msg)
           m_extTimeout = 10s;
           return;
         case CSinkDataProtocol::SAMPLE:
-          CSampleBuffer *samples;
           unsigned int delay;
-          samples = *((CSampleBuffer**)msg->data);
-          delay = OutputSamples(samples);
-          msg->Reply(CSinkDataProtocol::RETURNSAMPLE, &samples, sizeof(CSampleBuffer*));
+          delay = OutputSamples(m_samples);
+          ReturnSamples(m_samples);
+          m_sinkDelay = static_cast<float>(delay);
           if (m_extError)
           {
             m_sink->Deinitialize();
@@ -546,6 +553,9 @@ void CActiveAESink::StateMachine(int signal, Protocol *port, Message *msg)
         switch (signal)
         {
         case CSinkControlProtocol::TIMEOUT:
+          // the engine did not deliver in time
+          if (m_extStreaming)
+            m_underruns++;
           if (!m_extSilenceTimer.IsTimePast())
           {
             m_state = S_TOP_CONFIGURED_SILENCE;
@@ -606,6 +616,7 @@ void CActiveAESink::Process()
 {
   Message *msg = nullptr;
   Protocol *port = nullptr;
+  int signal = 0;
   bool gotMsg;
   XbmcThreads::EndTime<> timer;
 
@@ -623,8 +634,8 @@ void CActiveAESink::Process()
     {
       m_bStateMachineSelfTrigger = false;
       // self trigger state machine
-      StateMachine(msg->signal, port, msg);
-      if (!m_bStateMachineSelfTrigger)
+      StateMachine(signal, port, msg);
+      if (!m_bStateMachineSelfTrigger && msg)
       {
         msg->Release();
         msg = nullptr;
@@ -636,22 +647,37 @@ void CActiveAESink::Process()
     {
       gotMsg = true;
       port = &m_controlPort;
+      signal = msg->signal;
+    }
+    // check sample queue
+    else if (DequeueSamples())
+    {
+      gotMsg = true;
+      port = &m_dataPort;
+      signal = CSinkDataProtocol::SAMPLE;
     }
     // check data port
-    else if (m_dataPort.ReceiveOutMessage(&msg))
+    else if (m_pendingDataMsg || m_dataPort.ReceiveOutMessage(&m_pendingDataMsg))
     {
+      // samples queued before the message was sent go first
+      if (!m_sampleQueue.IsEmpty())
+        continue;
+
       gotMsg = true;
       port = &m_dataPort;
+      msg = std::exchange(m_pendingDataMsg, nullptr);
+      signal = msg->signal;
     }
 
     if (gotMsg)
     {
-      StateMachine(msg->signal, port, msg);
-      if (!m_bStateMachineSelfTrigger)
+      StateMachine(signal, port, msg);
+      if (!m_bStateMachineSelfTrigger && msg)
       {
         msg->Release();
         msg = nullptr;
       }
+      PublishStats();
       continue;
     }
 
@@ -667,13 +693,15 @@ void CActiveAESink::Process()
       msg = m_controlPort.GetMessage();
       msg->signal = CSinkControlProtocol::TIMEOUT;
       port = 0;
+      signal = msg->signal;
       // signal timeout to state machine
-      StateMachine(msg->signal, port, msg);
+      StateMachine(signal, port, msg);
       if (!m_bStateMachineSelfTrigger)
       {
         msg->Release();
         msg = nullptr;
       }
+      PublishStats();
     }
   }
 }
@@ -1019,17 +1047,68 @@ void CActiveAESink::OpenSink()
 
 void CActiveAESink::ReturnBuffers()
 {
+  QueuedSamples queued;
+  while (m_sampleQueue.Pop(queued))
+    ReturnSamples(queued.samples);
+
+  if (m_pendingDataMsg)
+  {
+    m_pendingDataMsg->Release();
+    m_pendingDataMsg = nullptr;
+  }
   Message *msg = nullptr;
-  CSampleBuffer *samples;
   while (m_dataPort.ReceiveOutMessage(&msg))
-  {
-    if (msg->signal == CSinkDataProtocol::SAMPLE)
-    {
-      samples = *((CSampleBuffer**)msg->data);
-      msg->Reply(CSinkDataProtocol::RETURNSAMPLE, &samples, sizeof(CSampleBuffer*));
-    }
     msg->Release();
-  }
+}
+
+bool CActiveAESink::QueueSamples(CSampleBuffer* samples)
+{
+  if (!m_sampleQueue.Push({samples, Clock::now()}))
+    return false;
+
+  m_outMsgEvent.Set();
+  return true;
+}
+
+bool CActiveAESink::DequeueSamples()
+{
+  QueuedSamples queued;
+  if (!m_sampleQueue.Pop(queued))
+    return false;
+
+  const Clock::duration latency = Clock::now() - queued.queued;
+  m_queueLatencySum += latency;
+  m_queueLatencyMax = std::max(m_queueLatencyMax, latency);
+  m_queueLatencyCount++;
+
+  m_samples = queued.samples;
+  return true;
+}
+
+void CActiveAESink::ReturnSamples(CSampleBuffer* samples)
+{
+  m_dataPort.SendInMessage(CSinkDataProtocol::RETURNSAMPLE, &samples, sizeof(CSampleBuffer*));
+}
+
+void CActiveAESink::PublishStats()
+{
+  const Clock::time_point now = Clock::now();
+  if (now - m_statsPublished < 1s)
+    return;
+
+  using Milliseconds = std::chrono::duration<float, std::milli>;
+  CDataCacheCore::SAudioOutputInfo info;
+  info.underruns = m_underruns;
+  info.sinkDelay = m_sinkDelay;
+  if (m_queueLatencyCount > 0)
+    info.queueLatency = Milliseconds(m_queueLatencySum).count() / m_queueLatencyCount;
+  info.maxQueueLatency = Milliseconds(m_queueLatencyMax).count();
+  CDataCacheCore::GetInstance().SetAudioOutputInfo(info);
+
+  m_queueLatencySum = {};
+  m_queueLatencyMax = {};
+  m_queueLatencyCount = 0;
+  m_statsPublished = now;
 }
 
 unsigned int CActiveAESink::OutputSamples(CSampleBuffer* samples)
@@ -12,11 +12,13 @@
 #include "cores/AudioEngine/Engines/ActiveAE/ActiveAEBuffer.h"
 #include "cores/AudioEngine/Interfaces/AE.h"
 #include "cores/AudioEngine/Interfaces/AESink.h"
+#include "cores/AudioEngine/Utils/AESPSCQueue.h"
 #include "threads/Event.h"
 #include "threads/SystemClock.h"
 #include "threads/Thread.h"
 #include "utils/ActorProtocol.h"
 
+#include <chrono>
 #include <memory>
 #include <utility>
 
@@ -80,7 +82,7 @@ public:
   }
   enum OutSignal
   {
-    SAMPLE = 0,
+    SAMPLE = 0, ///< not sent over the port, see CActiveAESink::QueueSamples
     DRAIN,
   };
   enum InSignal
@@ -106,6 +108,16 @@ public:
   bool SupportsFormat(const std::string &device, AEAudioFormat &format);
   bool DeviceExist(std::string driver, const std::string& device);
   bool NeedIecPack() const { return m_needIecPack; }
+
+  /*!
+   \brief Hand samples to the sink, to be returned with CSinkDataProtocol::RETURNSAMPLE.
+
+   Samples bypass the message port: the engine thread is the only producer of a wait-free queue.
+   They are processed before data port messages sent after them.
+   \return false if the queue is full, the samples are to be queued again later.
+   */
+  bool QueueSamples(CSampleBuffer* samples);
+
   CSinkControlProtocol m_controlPort;
   CSinkDataProtocol m_dataPort;
 
@@ -118,6 +130,9 @@ protected:
   void GetDeviceFriendlyName(const std::string& device);
   void OpenSink();
   void ReturnBuffers();
+  bool DequeueSamples();
+  void ReturnSamples(CSampleBuffer* samples);
+  void PublishStats();
   void SetSilenceTimer();
   bool NeedIECPacking();
 
@@ -158,6 +173,26 @@ protected:
   std::unique_ptr<CAEBitstreamPacker> m_packer;
   bool m_needIecPack{false};
   bool m_streamNoise;
+
+  using Clock = std::chrono::steady_clock;
+
+  struct QueuedSamples
+  {
+    CSampleBuffer* samples;
+    Clock::time_point queued;
+  };
+  static constexpr size_t SAMPLE_QUEUE_SIZE = 256;
+  CAESPSCQueue<QueuedSamples> m_sampleQueue{SAMPLE_QUEUE_SIZE};
+  CSampleBuffer* m_samples{nullptr}; ///< the samples handled by the state machine
+  Message* m_pendingDataMsg{nullptr}; ///< waits for the samples queued before it
+
+  // output stats, published to CDataCacheCore once per second
+  unsigned int m_underruns{0};
+  float m_sinkDelay{0.0f};
+  Clock::duration m_queueLatencySum{};
+  Clock::duration m_queueLatencyMax{};
+  unsigned int m_queueLatencyCount{0};
+  Clock::time_point m_statsPublished;
 };
 
 }
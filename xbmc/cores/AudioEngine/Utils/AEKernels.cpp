@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#include "AEKernelsSIMD.h"
+#include "utils/log.h"
+
+#include <cmath>
+
+namespace
+{
+void ScalarMul(float* data, float gain, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    data[i] *= gain;
+}
+
+float ScalarMulAdd(float* dst, const float* src, float gain, size_t count)
+{
+  float highest = 0.0f;
+  for (size_t i = 0; i < count; ++i)
+  {
+    dst[i] += src[i] * gain;
+    highest = MaxKeep(highest, std::fabs(dst[i]));
+  }
+  return highest;
+}
+
+void ScalarMulFrames(float* data, const float* gains, size_t frames, size_t stride)
+{
+  for (size_t frame = 0; frame < frames; ++frame, data += stride)
+    ScalarMul(data, gains[frame], stride);
+}
+
+float ScalarMulAddFrames(
+    float* dst, const float* src, const float* gains, size_t frames, size_t stride)
+{
+  float highest = 0.0f;
+  for (size_t frame = 0; frame < frames; ++frame, dst += stride, src += stride)
+    highest = MaxKeep(highest, ScalarMulAdd(dst, src, gains[frame], stride));
+  return highest;
+}
+
+void ScalarSoftClip(float* data, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    data[i] = SoftClipSample(data[i]);
+}
+
+const CAEKernels::Functions scalarFunctions = {
+    "scalar", ScalarMul, ScalarMulAdd, ScalarMulFrames, ScalarMulAddFrames, ScalarSoftClip};
+
+#if defined(__SSE__)
+const CAEKernels::Functions sseFunctions = MakeFunctions<VectorSSE>("sse");
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+const CAEKernels::Functions neonFunctions = MakeFunctions<VectorNEON>("neon");
+#endif
+
+bool HasAVX2()
+{
+#if defined(HAVE_AE_KERNELS_AVX2)
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#else
+  return false;
+#endif
+}
+} // namespace
+
+const CAEKernels::Functions& CAEKernels::Get()
+{
+  static const Functions& functions = []() -> const Functions&
+  {
+    const Functions* best = GetAvailable().back();
+    CLog::Log(LOGDEBUG, "CAEKernels: using {} kernels", best->name);
+    return *best;
+  }();
+  return functions;
+}
+
+const CAEKernels::Functions& CAEKernels::GetScalar()
+{
+  return scalarFunctions;
+}
+
+std::vector<const CAEKernels::Functions*> CAEKernels::GetAvailable()
+{
+  std::vector<const Functions*> available{&scalarFunctions};
+#if defined(__SSE__)
+  available.emplace_back(&sseFunctions);
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+  available.emplace_back(&neonFunctions);
+#endif
+#if defined(HAVE_AE_KERNELS_AVX2)
+  if (HasAVX2())
+    available.emplace_back(&AE_KERNELS::GetAVX2());
+#endif
+  return available;
+}
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/*!
+ \brief Sample processing kernels of the audio engine, on buffers of float samples.
+
+ The best implementation for the CPU (AVX2, SSE or NEON) is selected at runtime, the first time
+ a kernel is used. All implementations give bit-exact the same results as the scalar one: they
+ perform the same IEEE operations in the same order, without fused multiply-add.
+
+ A "frame" is a run of stride consecutive samples sharing one gain: all channels of a sample for
+ interleaved buffers, a single sample for planar ones.
+ */
+class CAEKernels
+{
+public:
+  struct Functions
+  {
+    const char* name;
+
+    /*! \brief data[i] *= gain */
+    void (*mul)(float* data, float gain, size_t count);
+
+    /*! \brief dst[i] += src[i] * gain
+     \return the highest absolute value of dst after the operation.
+     */
+    float (*mulAdd)(float* dst, const float* src, float gain, size_t count);
+
+    /*! \brief data[f * stride + c] *= gains[f] */
+    void (*mulFrames)(float* data, const float* gains, size_t frames, size_t stride);
+
+    /*! \brief dst[f * stride + c] += src[f * stride + c] * gains[f]
+     \return the highest absolute value of dst after the operation.
+     */
+    float (*mulAddFrames)(
+        float* dst, const float* src, const float* gains, size_t frames, size_t stride);
+
+    /*! \brief Soft clip the samples into [-1, 1], see CAEUtil::SoftClamp */
+    void (*softClip)(float* data, size_t count);
+  };
+
+  /*! \brief The implementation used on this CPU. */
+  static const Functions& Get();
+
+  /*! \brief The plain C++ implementation, the reference of the others. */
+  static const Functions& GetScalar();
+
+  /*! \brief All implementations this CPU can run, the scalar one first. */
+  static std::vector<const Functions*> GetAvailable();
+
+  static void Mul(float* data, float gain, size_t count) { Get().mul(data, gain, count); }
+
+  static float MulAdd(float* dst, const float* src, float gain, size_t count)
+  {
+    return Get().mulAdd(dst, src, gain, count);
+  }
+
+  static void MulFrames(float* data, const float* gains, size_t frames, size_t stride)
+  {
+    Get().mulFrames(data, gains, frames, stride);
+  }
+
+  static float MulAddFrames(
+      float* dst, const float* src, const float* gains, size_t frames, size_t stride)
+  {
+    return Get().mulAddFrames(dst, src, gains, frames, stride);
+  }
+
+  static void SoftClip(float* data, size_t count) { Get().softClip(data, count); }
+};
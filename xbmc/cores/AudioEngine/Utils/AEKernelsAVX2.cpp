@@ -0,0 +1,21 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+// built with -mavx2, only reached through CAEKernels after checking the CPU
+
+#include "AEKernelsSIMD.h"
+
+#if !defined(__AVX2__)
+#error "AEKernelsAVX2.cpp has to be built with AVX2 enabled"
+#endif
+
+const CAEKernels::Functions& AE_KERNELS::GetAVX2()
+{
+  static const CAEKernels::Functions functions = MakeFunctions<VectorAVX2>("avx2");
+  return functions;
+}
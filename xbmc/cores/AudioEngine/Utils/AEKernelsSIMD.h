@@ -0,0 +1,292 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/*!
+ \file AEKernelsSIMD.h
+ \brief Vector implementations of the kernels of CAEKernels, private to AEKernels*.cpp.
+
+ The kernels are written once against a vector type (SSE, AVX2, NEON). Everything in here has
+ internal linkage: AEKernelsAVX2.cpp is built with different instruction set flags, and must not
+ share a single instantiation with the other translation units.
+ */
+
+#include "AEKernels.h"
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+namespace AE_KERNELS
+{
+#if defined(HAVE_AE_KERNELS_AVX2)
+/*! \brief The AVX2 kernels, built in AEKernelsAVX2.cpp. Only call on CPUs supporting AVX2. */
+const CAEKernels::Functions& GetAVX2();
+#endif
+} // namespace AE_KERNELS
+
+namespace
+{
+inline float MaxKeep(float peak, float x)
+{
+  // NaN samples do not count, as they don't need clamping either
+  return x > peak ? x : peak;
+}
+
+inline float SoftClipSample(float x)
+{
+  if (x < -3.0f)
+    return -1.0f;
+  else if (x > 3.0f)
+    return 1.0f;
+  const float y = x * x;
+  return x * (27.0f + y) / (27.0f + 9.0f * y);
+}
+
+#if defined(__SSE__)
+struct VectorSSE
+{
+  using Type = __m128;
+  static constexpr size_t WIDTH = 4;
+  static constexpr bool HAS_DIV = true;
+
+  static Type Load(const float* p) { return _mm_loadu_ps(p); }
+  static void Store(float* p, Type v) { _mm_storeu_ps(p, v); }
+  static Type Set(float x) { return _mm_set1_ps(x); }
+  static Type Zero() { return _mm_setzero_ps(); }
+  static Type LoadPairs(const float* p) { return _mm_setr_ps(p[0], p[0], p[1], p[1]); }
+  static Type Add(Type a, Type b) { return _mm_add_ps(a, b); }
+  static Type Mul(Type a, Type b) { return _mm_mul_ps(a, b); }
+  static Type Div(Type a, Type b) { return _mm_div_ps(a, b); }
+  static Type Abs(Type a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+  // maxps returns its second operand if either one is NaN
+  static Type MaxKeep(Type peak, Type x) { return _mm_max_ps(x, peak); }
+  static Type Greater(Type a, Type b) { return _mm_cmpgt_ps(a, b); }
+  static Type Select(Type mask, Type a, Type b)
+  {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+  }
+  static float ReduceMax(Type v)
+  {
+    const Type high = _mm_max_ps(v, _mm_movehl_ps(v, v));
+    return _mm_cvtss_f32(_mm_max_ss(high, _mm_shuffle_ps(high, high, 1)));
+  }
+};
+#endif
+
+#if defined(__AVX2__)
+struct VectorAVX2
+{
+  using Type = __m256;
+  static constexpr size_t WIDTH = 8;
+  static constexpr bool HAS_DIV = true;
+
+  static Type Load(const float* p) { return _mm256_loadu_ps(p); }
+  static void Store(float* p, Type v) { _mm256_storeu_ps(p, v); }
+  static Type Set(float x) { return _mm256_set1_ps(x); }
+  static Type Zero() { return _mm256_setzero_ps(); }
+  static Type LoadPairs(const float* p)
+  {
+    return _mm256_permutevar8x32_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)),
+                                    _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3));
+  }
+  static Type Add(Type a, Type b) { return _mm256_add_ps(a, b); }
+  static Type Mul(Type a, Type b) { return _mm256_mul_ps(a, b); }
+  static Type Div(Type a, Type b) { return _mm256_div_ps(a, b); }
+  static Type Abs(Type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+  static Type MaxKeep(Type peak, Type x) { return _mm256_max_ps(x, peak); }
+  static Type Greater(Type a, Type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+  static Type Select(Type mask, Type a, Type b) { return _mm256_blendv_ps(b, a, mask); }
+  static float ReduceMax(Type v)
+  {
+    const __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    const __m128 high = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    return _mm_cvtss_f32(_mm_max_ss(high, _mm_shuffle_ps(high, high, 1)));
+  }
+};
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+struct VectorNEON
+{
+  using Type = float32x4_t;
+  static constexpr size_t WIDTH = 4;
+#if defined(__aarch64__)
+  static constexpr bool HAS_DIV = true;
+#else
+  // ARMv7 only has a reciprocal estimate, which isn't exact
+  static constexpr bool HAS_DIV = false;
+#endif
+
+  static Type Load(const float* p) { return vld1q_f32(p); }
+  static void Store(float* p, Type v) { vst1q_f32(p, v); }
+  static Type Set(float x) { return vdupq_n_f32(x); }
+  static Type Zero() { return vdupq_n_f32(0.0f); }
+  static Type LoadPairs(const float* p)
+  {
+    const float32x2_t g = vld1_f32(p);
+    const float32x2x2_t zipped = vzip_f32(g, g);
+    return vcombine_f32(zipped.val[0], zipped.val[1]);
+  }
+  static Type Add(Type a, Type b) { return vaddq_f32(a, b); }
+  static Type Mul(Type a, Type b) { return vmulq_f32(a, b); }
+#if defined(__aarch64__)
+  static Type Div(Type a, Type b) { return vdivq_f32(a, b); }
+#endif
+  static Type Abs(Type a) { return vabsq_f32(a); }
+  static Type MaxKeep(Type peak, Type x) { return vbslq_f32(vcgtq_f32(x, peak), x, peak); }
+  static uint32x4_t Greater(Type a, Type b) { return vcgtq_f32(a, b); }
+  static Type Select(uint32x4_t mask, Type a, Type b) { return vbslq_f32(mask, a, b); }
+  static float ReduceMax(Type v)
+  {
+#if defined(__aarch64__)
+    return vmaxvq_f32(v);
+#else
+    float32x2_t m = vpmax_f32(vget_low_f32(v), vget_high_f32(v));
+    m = vpmax_f32(m, m);
+    return vget_lane_f32(m, 0);
+#endif
+  }
+};
+#endif
+
+/*!
+ \brief dst = src * gain (+ dst), gains per frame of stride samples.
+ \return the highest absolute value of dst if ADD, 0 otherwise.
+ */
+template<class V, bool ADD>
+float ApplyGains(float* dst, const float* src, const float* gains, size_t frames, size_t stride)
+{
+  constexpr size_t W = V::WIDTH;
+  typename V::Type peak = V::Zero();
+  float highest = 0.0f;
+
+  const auto vector = [&](size_t i, typename V::Type gain)
+  {
+    typename V::Type result = V::Mul(V::Load(src + i), gain);
+    if constexpr (ADD)
+    {
+      result = V::Add(V::Load(dst + i), result);
+      peak = V::MaxKeep(peak, V::Abs(result));
+    }
+    V::Store(dst + i, result);
+  };
+  const auto scalar = [&](size_t i, float gain)
+  {
+    if constexpr (ADD)
+    {
+      dst[i] += src[i] * gain;
+      highest = ::MaxKeep(highest, std::fabs(dst[i]));
+    }
+    else
+      dst[i] = src[i] * gain;
+  };
+
+  if (stride == 1)
+  {
+    size_t i = 0;
+    for (; i + W <= frames; i += W)
+      vector(i, V::Load(gains + i));
+    for (; i < frames; ++i)
+      scalar(i, gains[i]);
+  }
+  else if (stride == 2)
+  {
+    // interleaved stereo, a vector spans several frames
+    const size_t count = frames * 2;
+    size_t i = 0;
+    for (; i + W <= count; i += W)
+      vector(i, V::LoadPairs(gains + i / 2));
+    for (; i < count; ++i)
+      scalar(i, gains[i / 2]);
+  }
+  else
+  {
+    for (size_t frame = 0; frame < frames; ++frame)
+    {
+      const float gain = gains[frame];
+      const typename V::Type vgain = V::Set(gain);
+      const size_t end = (frame + 1) * stride;
+      size_t i = frame * stride;
+      for (; i + W <= end; i += W)
+        vector(i, vgain);
+      for (; i < end; ++i)
+        scalar(i, gain);
+    }
+  }
+
+  if constexpr (ADD)
+    return ::MaxKeep(V::ReduceMax(peak), highest);
+  return 0.0f;
+}
+
+template<class V>
+void Mul(float* data, float gain, size_t count)
+{
+  ApplyGains<V, false>(data, data, &gain, 1, count);
+}
+
+template<class V>
+float MulAdd(float* dst, const float* src, float gain, size_t count)
+{
+  return ApplyGains<V, true>(dst, src, &gain, 1, count);
+}
+
+template<class V>
+void MulFrames(float* data, const float* gains, size_t frames, size_t stride)
+{
+  ApplyGains<V, false>(data, data, gains, frames, stride);
+}
+
+template<class V>
+float MulAddFrames(float* dst, const float* src, const float* gains, size_t frames, size_t stride)
+{
+  return ApplyGains<V, true>(dst, src, gains, frames, stride);
+}
+
+template<class V>
+void SoftClip(float* data, size_t count)
+{
+  size_t i = 0;
+  if constexpr (V::HAS_DIV)
+  {
+    const typename V::Type c27 = V::Set(27.0f);
+    const typename V::Type c9 = V::Set(9.0f);
+    const typename V::Type one = V::Set(1.0f);
+    const typename V::Type minusOne = V::Set(-1.0f);
+    const typename V::Type three = V::Set(3.0f);
+    const typename V::Type minusThree = V::Set(-3.0f);
+
+    for (; i + V::WIDTH <= count; i += V::WIDTH)
+    {
+      const typename V::Type x = V::Load(data + i);
+      const typename V::Type y = V::Mul(x, x);
+      typename V::Type result =
+          V::Div(V::Mul(x, V::Add(c27, y)), V::Add(c27, V::Mul(c9, y)));
+      result = V::Select(V::Greater(x, three), one, result);
+      result = V::Select(V::Greater(minusThree, x), minusOne, result);
+      V::Store(data + i, result);
+    }
+  }
+  for (; i < count; ++i)
+    data[i] = SoftClipSample(data[i]);
+}
+
+template<class V>
+CAEKernels::Functions MakeFunctions(const char* name)
+{
+  return {name, Mul<V>, MulAdd<V>, MulFrames<V>, MulAddFrames<V>, SoftClip<V>};
+}
+} // namespace
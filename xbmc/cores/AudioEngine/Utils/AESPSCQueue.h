@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/*!
+ \brief Bounded, wait-free queue between exactly one producer and one consumer thread.
+
+ Push() may only be called by the producer and Pop() by the consumer, neither ever blocks or
+ spins. The indices live on separate cache lines, each side keeps a copy of the other's index
+ and only reloads it when the queue looks full or empty.
+ */
+template<typename T>
+class CAESPSCQueue
+{
+public:
+  /*!
+   \param capacity the number of elements the queue holds, rounded up to a power of two.
+   */
+  explicit CAESPSCQueue(size_t capacity)
+    : m_slots(std::bit_ceil(std::max<size_t>(capacity, 1))),
+      m_mask(m_slots.size() - 1)
+  {
+  }
+
+  CAESPSCQueue(const CAESPSCQueue&) = delete;
+  CAESPSCQueue& operator=(const CAESPSCQueue&) = delete;
+
+  /*!
+   \brief Append an element, producer only.
+   \return false if the queue is full.
+   */
+  bool Push(T value)
+  {
+    const size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_producerHead == m_slots.size())
+    {
+      m_producerHead = m_head.load(std::memory_order_acquire);
+      if (tail - m_producerHead == m_slots.size())
+        return false;
+    }
+
+    m_slots[tail & m_mask] = std::move(value);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+   \brief Take the oldest element, consumer only.
+   \return false if the queue is empty.
+   */
+  bool Pop(T& value)
+  {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_consumerTail)
+    {
+      m_consumerTail = m_tail.load(std::memory_order_acquire);
+      if (head == m_consumerTail)
+        return false;
+    }
+
+    value = std::move(m_slots[head & m_mask]);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+   \brief Check for elements, exact for the consumer, a snapshot for anyone else.
+   */
+  bool IsEmpty() const
+  {
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+  }
+
+  /*!
+   \brief The number of elements, a snapshot unless called by the consumer or producer.
+   */
+  size_t Size() const
+  {
+    const size_t head = m_head.load(std::memory_order_acquire);
+    return m_tail.load(std::memory_order_acquire) - head;
+  }
+
+  size_t Capacity() const { return m_slots.size(); }
+
+private:
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  // consumer side
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head{0};
+  size_t m_consumerTail{0}; ///< last m_tail seen by the consumer
+
+  // producer side
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail{0};
+  size_t m_producerHead{0}; ///< last m_head seen by the producer
+
+  alignas(CACHE_LINE_SIZE) std::vector<T> m_slots;
+  const size_t m_mask;
+};
@@ -0,0 +1,179 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AEKernels.h"
+
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<float> MakeSamples(size_t count, float range, unsigned int seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> distribution(-range, range);
+  std::vector<float> samples(count);
+  for (float& sample : samples)
+    sample = distribution(generator);
+  return samples;
+}
+
+// bitwise, so that -0.0f and 0.0f differ
+bool BitExact(const std::vector<float>& a, const std::vector<float>& b)
+{
+  return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+}
+
+// odd sizes and offsets cover the scalar tails and unaligned buffers
+constexpr size_t SIZES[] = {0, 1, 3, 7, 8, 17, 64, 1023};
+constexpr size_t STRIDES[] = {1, 2, 3, 6, 8, 9};
+} // namespace
+
+class TestAEKernels : public ::testing::TestWithParam<const CAEKernels::Functions*>
+{
+protected:
+  const CAEKernels::Functions& scalar = CAEKernels::GetScalar();
+  const CAEKernels::Functions& kernels = *GetParam();
+};
+
+TEST_P(TestAEKernels, Mul)
+{
+  for (const size_t size : SIZES)
+  {
+    std::vector<float> expected = MakeSamples(size + 1, 2.0f, 1);
+    std::vector<float> actual = expected;
+    scalar.mul(expected.data() + 1, 0.7071f, size);
+    kernels.mul(actual.data() + 1, 0.7071f, size);
+    EXPECT_TRUE(BitExact(expected, actual)) << "size " << size;
+  }
+}
+
+TEST_P(TestAEKernels, MulAdd)
+{
+  for (const size_t size : SIZES)
+  {
+    const std::vector<float> src = MakeSamples(size + 1, 1.0f, 2);
+    std::vector<float> expected = MakeSamples(size + 1, 1.0f, 3);
+    std::vector<float> actual = expected;
+    const float expectedPeak = scalar.mulAdd(expected.data() + 1, src.data() + 1, 0.9f, size);
+    const float actualPeak = kernels.mulAdd(actual.data() + 1, src.data() + 1, 0.9f, size);
+    EXPECT_TRUE(BitExact(expected, actual)) << "size " << size;
+    EXPECT_EQ(expectedPeak, actualPeak) << "size " << size;
+  }
+}
+
+TEST_P(TestAEKernels, MulFrames)
+{
+  for (const size_t stride : STRIDES)
+  {
+    for (const size_t frames : SIZES)
+    {
+      const std::vector<float> gains = MakeSamples(frames, 1.5f, 4);
+      std::vector<float> expected = MakeSamples(frames * stride, 1.0f, 5);
+      std::vector<float> actual = expected;
+      scalar.mulFrames(expected.data(), gains.data(), frames, stride);
+      kernels.mulFrames(actual.data(), gains.data(), frames, stride);
+      EXPECT_TRUE(BitExact(expected, actual)) << "stride " << stride << ", frames " << frames;
+    }
+  }
+}
+
+TEST_P(TestAEKernels, MulAddFrames)
+{
+  for (const size_t stride : STRIDES)
+  {
+    for (const size_t frames : SIZES)
+    {
+      const std::vector<float> gains = MakeSamples(frames, 1.5f, 6);
+      const std::vector<float> src = MakeSamples(frames * stride, 1.0f, 7);
+      std::vector<float> expected = MakeSamples(frames * stride, 1.0f, 8);
+      std::vector<float> actual = expected;
+      const float expectedPeak =
+          scalar.mulAddFrames(expected.data(), src.data(), gains.data(), frames, stride);
+      const float actualPeak =
+          kernels.mulAddFrames(actual.data(), src.data(), gains.data(), frames, stride);
+      EXPECT_TRUE(BitExact(expected, actual)) << "stride " << stride << ", frames " << frames;
+      EXPECT_EQ(expectedPeak, actualPeak) << "stride " << stride << ", frames " << frames;
+    }
+  }
+}
+
+TEST_P(TestAEKernels, SoftClip)
+{
+  for (const size_t size : SIZES)
+  {
+    std::vector<float> expected = MakeSamples(size + 1, 5.0f, 9);
+    std::vector<float> actual = expected;
+    scalar.softClip(expected.data() + 1, size);
+    kernels.softClip(actual.data() + 1, size);
+    EXPECT_TRUE(BitExact(expected, actual)) << "size " << size;
+  }
+
+  std::vector<float> edges = {-std::numeric_limits<float>::infinity(),
+                              -1e30f,
+                              -3.0f,
+                              -1.0f,
+                              -0.0f,
+                              0.0f,
+                              1.0f,
+                              3.0f,
+                              1e30f,
+                              std::numeric_limits<float>::infinity()};
+  std::vector<float> actual = edges;
+  scalar.softClip(edges.data(), edges.size());
+  kernels.softClip(actual.data(), actual.size());
+  EXPECT_TRUE(BitExact(edges, actual));
+  EXPECT_EQ(-1.0f, edges.front());
+  EXPECT_EQ(1.0f, edges.back());
+}
+
+TEST_P(TestAEKernels, DISABLED_Benchmark)
+{
+  // 20 ms of 7.1 at 48 kHz, mixed into an interleaved and a planar buffer
+  constexpr size_t FRAMES = 960;
+  constexpr size_t CHANNELS = 8;
+  constexpr int ITERATIONS = 2000;
+
+  const std::vector<float> src = MakeSamples(FRAMES * CHANNELS, 1.0f, 10);
+  const std::vector<float> gains = MakeSamples(FRAMES * CHANNELS, 1.0f, 11);
+  std::vector<float> dst(FRAMES * CHANNELS);
+
+  const auto measure = [&](const CAEKernels::Functions& functions)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    float peak = 0.0f;
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+      std::ranges::fill(dst, 0.0f);
+      peak += functions.mulAddFrames(dst.data(), src.data(), gains.data(), FRAMES, CHANNELS);
+      peak += functions.mulAddFrames(dst.data(), src.data(), gains.data(), FRAMES * CHANNELS, 1);
+      functions.softClip(dst.data(), dst.size());
+    }
+    const std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+    EXPECT_GT(peak, 0.0f);
+    return elapsed.count() / ITERATIONS;
+  };
+
+  const double scalarUs = measure(scalar);
+  const double kernelsUs = measure(kernels);
+
+  RecordProperty("ScalarUsPerBuffer", std::to_string(scalarUs));
+  RecordProperty(std::string(kernels.name) + "UsPerBuffer", std::to_string(kernelsUs));
+}
+
+INSTANTIATE_TEST_SUITE_P(AEKernels,
+                         TestAEKernels,
+                         ::testing::ValuesIn(CAEKernels::GetAvailable()),
+                         [](const auto& info) { return std::string(info.param->name); });
@@ -0,0 +1,192 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AESPSCQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(TestAESPSCQueue, RoundsCapacityUp)
+{
+  EXPECT_EQ(1u, CAESPSCQueue<int>(0).Capacity());
+  EXPECT_EQ(8u, CAESPSCQueue<int>(5).Capacity());
+  EXPECT_EQ(256u, CAESPSCQueue<int>(256).Capacity());
+}
+
+TEST(TestAESPSCQueue, KeepsOrderUntilFull)
+{
+  CAESPSCQueue<int> queue(4);
+  int value = 0;
+  EXPECT_TRUE(queue.IsEmpty());
+  EXPECT_FALSE(queue.Pop(value));
+
+  for (int i = 0; i < 4; ++i)
+    EXPECT_TRUE(queue.Push(i));
+  EXPECT_FALSE(queue.Push(4));
+  EXPECT_EQ(4u, queue.Size());
+
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(queue.Pop(value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_FALSE(queue.Pop(value));
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(TestAESPSCQueue, WrapsAround)
+{
+  CAESPSCQueue<std::unique_ptr<int>> queue(4);
+  std::unique_ptr<int> value;
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_TRUE(queue.Push(std::make_unique<int>(i)));
+    ASSERT_TRUE(queue.Push(std::make_unique<int>(-i)));
+    ASSERT_TRUE(queue.Pop(value));
+    EXPECT_EQ(i, *value);
+    ASSERT_TRUE(queue.Pop(value));
+    EXPECT_EQ(-i, *value);
+  }
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(TestAESPSCQueue, TransfersEverythingInOrder)
+{
+  constexpr uint64_t COUNT = 1000000;
+  CAESPSCQueue<uint64_t> queue(64);
+
+  std::thread producer(
+      [&queue]
+      {
+        for (uint64_t i = 0; i < COUNT;)
+        {
+          if (queue.Push(i))
+            ++i;
+          else
+            std::this_thread::yield();
+        }
+      });
+
+  uint64_t expected = 0;
+  uint64_t value = 0;
+  bool ordered = true;
+  while (expected < COUNT)
+  {
+    if (!queue.Pop(value))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    ordered &= value == expected;
+    ++expected;
+  }
+  producer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.IsEmpty());
+}
+
+/*!
+ An engine mixing into a fixed pool of buffers and a null sink consuming them at the pace of the
+ audio clock, with buffers going back through a second queue, like ActiveAE and its sink. Busy
+ threads stand in for a library scan and the GUI competing for the CPU.
+ */
+TEST(TestAESPSCQueue, DISABLED_NullSinkStress)
+{
+  constexpr int POOL_SIZE = 16;
+  constexpr int PERIODS = 500;
+  constexpr auto PERIOD = 2ms;
+
+  struct Buffer
+  {
+    int sequence;
+    std::chrono::steady_clock::time_point queued;
+  };
+  std::vector<Buffer> pool(POOL_SIZE);
+
+  CAESPSCQueue<Buffer*> toSink(POOL_SIZE);
+  CAESPSCQueue<Buffer*> toEngine(POOL_SIZE);
+  for (Buffer& buffer : pool)
+    ASSERT_TRUE(toEngine.Push(&buffer));
+
+  std::atomic_bool stop{false};
+  std::vector<std::thread> load;
+  const unsigned int loadThreads = std::max(2u, std::thread::hardware_concurrency());
+  for (unsigned int i = 0; i < loadThreads; ++i)
+  {
+    load.emplace_back(
+        [&stop]
+        {
+          volatile uint64_t work = 0;
+          while (!stop)
+            work = work + 1;
+        });
+  }
+
+  std::thread engine(
+      [&]
+      {
+        Buffer* buffer = nullptr;
+        for (int sequence = 0; sequence < PERIODS;)
+        {
+          if (!toEngine.Pop(buffer))
+          {
+            std::this_thread::sleep_for(PERIOD / 4);
+            continue;
+          }
+          buffer->sequence = sequence++;
+          buffer->queued = std::chrono::steady_clock::now();
+          while (!toSink.Push(buffer))
+            std::this_thread::yield();
+        }
+      });
+
+  // the sink wants a period of audio every PERIOD, it underruns when none is queued by then
+  int underruns = 0;
+  int played = 0;
+  bool ordered = true;
+  std::chrono::steady_clock::duration maxLatency{};
+  auto deadline = std::chrono::steady_clock::now() + PERIOD;
+  Buffer* buffer = nullptr;
+  while (played < PERIODS)
+  {
+    std::this_thread::sleep_until(deadline);
+    deadline += PERIOD;
+    if (!toSink.Pop(buffer))
+    {
+      underruns++;
+      continue;
+    }
+    ordered &= buffer->sequence == played++;
+    maxLatency = std::max(maxLatency, std::chrono::steady_clock::now() - buffer->queued);
+    ASSERT_TRUE(toEngine.Push(buffer));
+  }
+
+  engine.join();
+  stop = true;
+  for (std::thread& thread : load)
+    thread.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(toSink.IsEmpty());
+  EXPECT_EQ(static_cast<size_t>(POOL_SIZE), toEngine.Size());
+
+  RecordProperty("Underruns", underruns);
+  RecordProperty(
+      "MaxQueueLatencyUs",
+      static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(maxLatency).count()));
+}
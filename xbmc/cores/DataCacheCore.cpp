@@ -363,6 +363,20 @@ int CDataCacheCore::GetAudioQueueDataLevel()
   return m_playerAudioInfo.queueDataLevel;
 }
 
+void CDataCacheCore::SetAudioOutputInfo(const SAudioOutputInfo& info)
+{
+  std::unique_lock lock(m_audioOutputSection);
+
+  m_audioOutputInfo = info;
+}
+
+CDataCacheCore::SAudioOutputInfo CDataCacheCore::GetAudioOutputInfo()
+{
+  std::unique_lock lock(m_audioOutputSection);
+
+  return m_audioOutputInfo;
+}
+
 void CDataCacheCore::SetEditList(const std::vector<EDL::Edit>& editList)
 {
   std::unique_lock lock(m_contentSection);
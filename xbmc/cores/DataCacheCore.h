@@ -81,6 +81,25 @@ public:
   void SetAudioQueueDataLevel(int level);
   int GetAudioQueueDataLevel();
 
+  // audio output info
+  struct SAudioOutputInfo
+  {
+    unsigned int underruns = 0; ///< times the sink ran out of samples while streaming
+    float sinkDelay = 0.0f; ///< ms of audio buffered by the sink
+    float queueLatency = 0.0f; ///< average ms a buffer waited for the sink, over the last second
+    float maxQueueLatency = 0.0f; ///< highest ms a buffer waited for the sink, over the last second
+  };
+
+  /*!
+   * @brief Set the state of the audio output, published by the audio engine's sink thread.
+   */
+  void SetAudioOutputInfo(const SAudioOutputInfo& info);
+
+  /*!
+   * @brief Get the state of the audio output.
+   */
+  SAudioOutputInfo GetAudioOutputInfo();
+
   // player subtitle info
   void SetSubtitleDecoderName(std::string name);
   std::string GetSubtitleDecoderName();
@@ -257,6 +276,9 @@ protected:
     int queueDataLevel;
   } m_playerAudioInfo;
 
+  CCriticalSection m_audioOutputSection;
+  SAudioOutputInfo m_audioOutputInfo;
+
   CCriticalSection m_subtitlePlayerSection;
   struct SPlayerSubtitleInfo
   {
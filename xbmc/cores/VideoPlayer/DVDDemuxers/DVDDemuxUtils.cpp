@@ -8,8 +8,8 @@
 
 #include "DVDDemuxUtils.h"
 
+#include "DemuxPacketPool.h"
 #include "cores/VideoPlayer/Interface/DemuxCrypto.h"
-#include "utils/MemUtils.h"
 #include "utils/log.h"
 
 extern "C"
@@ -24,8 +24,9 @@ void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
 {
   if (pPacket)
   {
+    CDemuxPacketPool& pool = CDemuxPacketPool::GetInstance();
     if (pPacket->pData)
-      KODI::MEMORY::AlignedFree(pPacket->pData);
+      pool.ReleaseBuffer(pPacket->pData);
     if (pPacket->iSideDataElems)
     {
       AVPacket* avPkt = av_packet_alloc();
@@ -49,13 +50,15 @@ void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
     }
     if (pPacket->cryptoInfo)
       delete pPacket->cryptoInfo;
-    delete pPacket;
+    pool.ReleasePacket(pPacket);
   }
 }
 
 DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
 {
-  DemuxPacket* pPacket = new DemuxPacket();
+  // packets and their payload buffers are recycled, this runs for every demuxed packet
+  CDemuxPacketPool& pool = CDemuxPacketPool::GetInstance();
+  DemuxPacket* pPacket = pool.AcquirePacket();
 
   if (iDataSize > 0)
   {
@@ -68,7 +71,7 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
      * Note, if the first 23 bits of the additional bytes are not 0 then damaged
      * MPEG bitstreams could cause overread and segfault
      */
-    pPacket->pData = static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(iDataSize + AV_INPUT_BUFFER_PADDING_SIZE, 16));
+    pPacket->pData = pool.AcquireBuffer(iDataSize + AV_INPUT_BUFFER_PADDING_SIZE);
     if (!pPacket->pData)
     {
       FreeDemuxPacket(pPacket);
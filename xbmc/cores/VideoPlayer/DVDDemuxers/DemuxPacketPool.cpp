@@ -0,0 +1,175 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DemuxPacketPool.h"
+
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "utils/MemUtils.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+namespace
+{
+constexpr unsigned int UNPOOLED = ~0U;
+
+// Stored in front of every payload buffer, sized to keep the payload 16 byte aligned
+struct BufferHeader
+{
+  unsigned int sizeClass;
+  size_t capacity;
+};
+constexpr size_t HEADER_SIZE = 16;
+static_assert(sizeof(BufferHeader) <= HEADER_SIZE);
+
+BufferHeader* GetHeader(uint8_t* buffer)
+{
+  return reinterpret_cast<BufferHeader*>(buffer - HEADER_SIZE);
+}
+
+void FreeBuffer(uint8_t* buffer)
+{
+  KODI::MEMORY::AlignedFree(buffer - HEADER_SIZE);
+}
+} // namespace
+
+CDemuxPacketPool::~CDemuxPacketPool()
+{
+  Clear();
+}
+
+CDemuxPacketPool& CDemuxPacketPool::GetInstance()
+{
+  static CDemuxPacketPool pool;
+  return pool;
+}
+
+unsigned int CDemuxPacketPool::GetSizeClass(size_t size)
+{
+  if (size <= (size_t{1} << MIN_CLASS_SHIFT))
+    return 0;
+  if (size > (size_t{1} << MAX_CLASS_SHIFT))
+    return UNPOOLED;
+
+  return static_cast<unsigned int>(std::bit_width(size - 1)) - MIN_CLASS_SHIFT;
+}
+
+DemuxPacket* CDemuxPacketPool::AcquirePacket()
+{
+  {
+    std::unique_lock lock(m_section);
+    if (!m_packets.empty())
+    {
+      DemuxPacket* packet = m_packets.back();
+      m_packets.pop_back();
+      return packet;
+    }
+  }
+  return new DemuxPacket();
+}
+
+void CDemuxPacketPool::ReleasePacket(DemuxPacket* packet)
+{
+  *packet = DemuxPacket();
+
+  {
+    std::unique_lock lock(m_section);
+    if (m_packets.size() < MAX_POOLED_PACKETS)
+    {
+      m_packets.emplace_back(packet);
+      return;
+    }
+  }
+  delete packet;
+}
+
+uint8_t* CDemuxPacketPool::AcquireBuffer(size_t size)
+{
+  const unsigned int sizeClass = GetSizeClass(size);
+  size_t capacity = size;
+  if (sizeClass != UNPOOLED)
+    capacity = size_t{1} << (sizeClass + MIN_CLASS_SHIFT);
+
+  {
+    std::unique_lock lock(m_section);
+    m_stats.bufferRequests++;
+    m_stats.bytesInUse += capacity;
+    m_stats.peakBytesInUse = std::max(m_stats.peakBytesInUse, m_stats.bytesInUse);
+
+    if (sizeClass != UNPOOLED && !m_buffers[sizeClass].empty())
+    {
+      uint8_t* buffer = m_buffers[sizeClass].back();
+      m_buffers[sizeClass].pop_back();
+      m_stats.bufferHits++;
+      m_stats.bytesPooled -= capacity;
+      return buffer;
+    }
+  }
+
+  auto* block = static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(HEADER_SIZE + capacity, 16));
+  if (!block)
+  {
+    std::unique_lock lock(m_section);
+    m_stats.bytesInUse -= capacity;
+    return nullptr;
+  }
+
+  uint8_t* buffer = block + HEADER_SIZE;
+  BufferHeader* header = GetHeader(buffer);
+  header->sizeClass = sizeClass;
+  header->capacity = capacity;
+  return buffer;
+}
+
+void CDemuxPacketPool::ReleaseBuffer(uint8_t* buffer)
+{
+  const BufferHeader* header = GetHeader(buffer);
+  {
+    std::unique_lock lock(m_section);
+    m_stats.bytesInUse -= header->capacity;
+
+    if (header->sizeClass != UNPOOLED &&
+        m_stats.bytesPooled + header->capacity <= MAX_POOLED_BYTES)
+    {
+      m_buffers[header->sizeClass].emplace_back(buffer);
+      m_stats.bytesPooled += header->capacity;
+      return;
+    }
+  }
+  FreeBuffer(buffer);
+}
+
+DemuxPacketPoolStats CDemuxPacketPool::GetStats() const
+{
+  std::unique_lock lock(m_section);
+  return m_stats;
+}
+
+void CDemuxPacketPool::ResetStats()
+{
+  std::unique_lock lock(m_section);
+  m_stats.bufferRequests = 0;
+  m_stats.bufferHits = 0;
+  m_stats.peakBytesInUse = m_stats.bytesInUse;
+}
+
+void CDemuxPacketPool::Clear()
+{
+  std::unique_lock lock(m_section);
+
+  for (auto& buffers : m_buffers)
+  {
+    std::ranges::for_each(buffers, FreeBuffer);
+    buffers.clear();
+  }
+  m_stats.bytesPooled = 0;
+
+  std::ranges::for_each(m_packets, [](DemuxPacket* packet) { delete packet; });
+  m_packets.clear();
+}
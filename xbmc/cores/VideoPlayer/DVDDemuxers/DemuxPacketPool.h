@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct DemuxPacket;
+
+struct DemuxPacketPoolStats
+{
+  uint64_t bufferRequests{0}; //!< payload buffers handed out
+  uint64_t bufferHits{0}; //!< payload buffers served from the pool
+  size_t bytesInUse{0}; //!< payload bytes currently owned by packets
+  size_t peakBytesInUse{0}; //!< high-water mark of bytesInUse
+  size_t bytesPooled{0}; //!< payload bytes kept for reuse
+
+  double GetHitRate() const
+  {
+    return bufferRequests ? static_cast<double>(bufferHits) / bufferRequests : 0.0;
+  }
+};
+
+/*!
+ * \brief Recycles DemuxPacket structures and their payload buffers.
+ *
+ * Payload buffers are grouped in power-of-two size classes. A released buffer is kept in the
+ * free list of its class and handed out again for any request of the same class, so once playback
+ * reaches a steady state demuxing does not hit the heap per packet anymore. Buffers larger than
+ * the biggest class, or exceeding the retention limit, go back to the heap. The pool is cleared
+ * when playback ends, so the retained memory is only held while something is playing.
+ *
+ * All methods are thread safe: packets are usually allocated by the demuxer and freed by the
+ * decoder threads.
+ */
+class CDemuxPacketPool
+{
+public:
+  CDemuxPacketPool() = default;
+  ~CDemuxPacketPool();
+
+  CDemuxPacketPool(const CDemuxPacketPool&) = delete;
+  CDemuxPacketPool& operator=(const CDemuxPacketPool&) = delete;
+
+  /*!
+   * \brief The pool used by CDVDDemuxUtils.
+   */
+  static CDemuxPacketPool& GetInstance();
+
+  /*!
+   * \brief Get a default initialized packet.
+   */
+  DemuxPacket* AcquirePacket();
+
+  /*!
+   * \brief Return a packet, which must not own any buffers anymore.
+   */
+  void ReleasePacket(DemuxPacket* packet);
+
+  /*!
+   * \brief Get a 16 byte aligned payload buffer of at least size bytes. Its content is undefined.
+   * \return the buffer, nullptr if out of memory
+   */
+  uint8_t* AcquireBuffer(size_t size);
+
+  /*!
+   * \brief Return a buffer obtained from AcquireBuffer().
+   */
+  void ReleaseBuffer(uint8_t* buffer);
+
+  DemuxPacketPoolStats GetStats() const;
+
+  /*!
+   * \brief Start counting requests, hits and the peak usage anew, e.g. for a new playback session.
+   */
+  void ResetStats();
+
+  /*!
+   * \brief Free all pooled packets and buffers. Buffers still owned by packets are not affected.
+   */
+  void Clear();
+
+private:
+  static constexpr unsigned int MIN_CLASS_SHIFT = 8; // 256 bytes
+  static constexpr unsigned int MAX_CLASS_SHIFT = 23; // 8 MiB
+  static constexpr unsigned int CLASS_COUNT = MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1;
+  static constexpr size_t MAX_POOLED_BYTES = 64 * 1024 * 1024;
+  static constexpr size_t MAX_POOLED_PACKETS = 1024;
+
+  static unsigned int GetSizeClass(size_t size);
+
+  mutable CCriticalSection m_section;
+  std::array<std::vector<uint8_t*>, CLASS_COUNT> m_buffers;
+  std::vector<DemuxPacket*> m_packets;
+  DemuxPacketPoolStats m_stats;
+};
@@ -0,0 +1,209 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DemuxPacketPool.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "utils/MemUtils.h"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+/*!
+ * Packet sizes as seen when demuxing a 4K HEVC remux (~100 Mbit/s, 24 fps, GOP of 48 frames)
+ * interleaved with a lossless audio track. The sizes vary around the typical values per frame type
+ * but are deterministic for a given seed.
+ */
+std::vector<size_t> CreatePacketSizeTrace(size_t count)
+{
+  std::mt19937 generator(4242);
+  std::uniform_real_distribution<double> jitter(0.7, 1.3);
+  std::vector<size_t> trace;
+  trace.reserve(count);
+
+  for (size_t frame = 0; trace.size() < count; ++frame)
+  {
+    double size = 90000; // B frame
+    if (frame % 48 == 0)
+      size = 1200000; // I frame
+    else if (frame % 4 == 0)
+      size = 300000; // P frame
+    trace.emplace_back(static_cast<size_t>(size * jitter(generator)));
+
+    // ~40 audio packets per second at 24 fps
+    for (int i = 0; i < 2 && trace.size() < count; ++i)
+      trace.emplace_back(static_cast<size_t>(2000 * jitter(generator)));
+  }
+  return trace;
+}
+
+// the demuxer keeps this many packets queued ahead of the decoders
+constexpr size_t QUEUE_DEPTH = 500;
+constexpr size_t PADDING = 64;
+} // namespace
+
+TEST(TestDemuxPacketPool, BufferReuse)
+{
+  CDemuxPacketPool pool;
+
+  uint8_t* buffer = pool.AcquireBuffer(1000);
+  ASSERT_NE(nullptr, buffer);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(buffer) % 16);
+  pool.ReleaseBuffer(buffer);
+
+  // same size class, so the buffer is recycled
+  EXPECT_EQ(buffer, pool.AcquireBuffer(600));
+
+  const DemuxPacketPoolStats stats = pool.GetStats();
+  EXPECT_EQ(2u, stats.bufferRequests);
+  EXPECT_EQ(1u, stats.bufferHits);
+  EXPECT_EQ(1024u, stats.bytesInUse);
+  EXPECT_EQ(0u, stats.bytesPooled);
+  pool.ReleaseBuffer(buffer);
+}
+
+TEST(TestDemuxPacketPool, LargeBuffersAreNotPooled)
+{
+  CDemuxPacketPool pool;
+  constexpr size_t size = 16 * 1024 * 1024;
+
+  uint8_t* buffer = pool.AcquireBuffer(size);
+  ASSERT_NE(nullptr, buffer);
+  EXPECT_EQ(size, pool.GetStats().bytesInUse);
+  pool.ReleaseBuffer(buffer);
+
+  const DemuxPacketPoolStats stats = pool.GetStats();
+  EXPECT_EQ(0u, stats.bytesInUse);
+  EXPECT_EQ(0u, stats.bytesPooled);
+}
+
+TEST(TestDemuxPacketPool, PacketsAreReset)
+{
+  CDemuxPacketPool pool;
+
+  DemuxPacket* packet = pool.AcquirePacket();
+  packet->iSize = 42;
+  packet->pts = 1.0;
+  pool.ReleasePacket(packet);
+
+  DemuxPacket* recycled = pool.AcquirePacket();
+  EXPECT_EQ(packet, recycled);
+  EXPECT_EQ(0, recycled->iSize);
+  EXPECT_EQ(DVD_NOPTS_VALUE, recycled->pts);
+  delete recycled;
+}
+
+TEST(TestDemuxPacketPool, ClearAndResetStats)
+{
+  CDemuxPacketPool pool;
+
+  uint8_t* pooled = pool.AcquireBuffer(1000);
+  uint8_t* inUse = pool.AcquireBuffer(3000);
+  pool.ReleaseBuffer(pooled);
+  EXPECT_EQ(pooled, pool.AcquireBuffer(1000));
+  pool.ReleaseBuffer(pooled);
+
+  pool.Clear();
+  DemuxPacketPoolStats stats = pool.GetStats();
+  EXPECT_EQ(0u, stats.bytesPooled);
+  EXPECT_EQ(4096u, stats.bytesInUse);
+  EXPECT_EQ(5120u, stats.peakBytesInUse);
+  EXPECT_EQ(1u, stats.bufferHits);
+
+  // a new session only counts what happens from now on
+  pool.ResetStats();
+  stats = pool.GetStats();
+  EXPECT_EQ(0u, stats.bufferRequests);
+  EXPECT_EQ(0u, stats.bufferHits);
+  EXPECT_EQ(4096u, stats.bytesInUse);
+  EXPECT_EQ(4096u, stats.peakBytesInUse);
+
+  // a buffer still in use when the pool was cleared can be returned later on
+  pool.ReleaseBuffer(inUse);
+  EXPECT_EQ(0u, pool.GetStats().bytesInUse);
+  EXPECT_EQ(4096u, pool.GetStats().bytesPooled);
+}
+
+TEST(TestDemuxPacketPool, SteadyStateHitRate)
+{
+  const std::vector<size_t> trace = CreatePacketSizeTrace(20000);
+
+  CDemuxPacketPool pool;
+  std::deque<uint8_t*> queue;
+  for (size_t size : trace)
+  {
+    queue.emplace_back(pool.AcquireBuffer(size + PADDING));
+    if (queue.size() > QUEUE_DEPTH)
+    {
+      pool.ReleaseBuffer(queue.front());
+      queue.pop_front();
+    }
+  }
+  for (uint8_t* buffer : queue)
+    pool.ReleaseBuffer(buffer);
+
+  const DemuxPacketPoolStats stats = pool.GetStats();
+  EXPECT_EQ(trace.size(), stats.bufferRequests);
+  EXPECT_EQ(0u, stats.bytesInUse);
+  // after the first queue depth worth of packets, allocations are served from the pool
+  EXPECT_GT(stats.GetHitRate(), 0.9);
+}
+
+TEST(TestDemuxPacketPool, DISABLED_ReplayTrace)
+{
+  const std::vector<size_t> trace = CreatePacketSizeTrace(50000);
+
+  // reference: what AllocateDemuxPacket did before, a heap allocation per packet
+  std::deque<uint8_t*> queue;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t size : trace)
+  {
+    queue.emplace_back(static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(size + PADDING, 16)));
+    if (queue.size() > QUEUE_DEPTH)
+    {
+      KODI::MEMORY::AlignedFree(queue.front());
+      queue.pop_front();
+    }
+  }
+  for (uint8_t* buffer : queue)
+    KODI::MEMORY::AlignedFree(buffer);
+  queue.clear();
+  const std::chrono::duration<double, std::nano> heapTime = std::chrono::steady_clock::now() - start;
+
+  CDemuxPacketPool pool;
+  start = std::chrono::steady_clock::now();
+  for (size_t size : trace)
+  {
+    queue.emplace_back(pool.AcquireBuffer(size + PADDING));
+    if (queue.size() > QUEUE_DEPTH)
+    {
+      pool.ReleaseBuffer(queue.front());
+      queue.pop_front();
+    }
+  }
+  for (uint8_t* buffer : queue)
+    pool.ReleaseBuffer(buffer);
+  const std::chrono::duration<double, std::nano> poolTime = std::chrono::steady_clock::now() - start;
+
+  const DemuxPacketPoolStats stats = pool.GetStats();
+  EXPECT_EQ(trace.size(), stats.bufferRequests);
+  EXPECT_EQ(0u, stats.bytesInUse);
+  // after the first queue depth worth of packets, allocations are served from the pool
+  EXPECT_GT(stats.GetHitRate(), 0.95);
+
+  RecordProperty("HeapNsPerPacket", static_cast<int>(heapTime.count() / trace.size()));
+  RecordProperty("PoolNsPerPacket", static_cast<int>(poolTime.count() / trace.size()));
+  RecordProperty("HitRatePercent", static_cast<int>(stats.GetHitRate() * 100));
+  RecordProperty("PeakKiBInUse", static_cast<int>(stats.peakBytesInUse / 1024));
+}
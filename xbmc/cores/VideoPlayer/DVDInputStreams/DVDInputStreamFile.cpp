@@ -8,8 +8,11 @@
 
 #include "DVDInputStreamFile.h"
 
+#include "ServiceBroker.h"
 #include "filesystem/File.h"
 #include "filesystem/IFile.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 #include "video/VideoFileItemClassify.h"
@@ -47,7 +50,11 @@ bool CDVDInputStreamFile::Open()
 
   // If this file is audio and/or video (= not a subtitle) flag to caller
   if (!VIDEO::IsSubtitle(m_item))
+  {
     flags |= READ_AUDIO_VIDEO;
+    if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_memoryMapLocalFiles)
+      flags |= READ_MEMORY_MAP;
+  }
   else
     flags |= READ_NO_BUFFER; // disable CFileStreamBuffer for subtitles
 
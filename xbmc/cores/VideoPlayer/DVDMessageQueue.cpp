@@ -17,6 +17,46 @@
 
 using namespace std::chrono_literals;
 
+void CDVDMessageRing::emplace_front(std::shared_ptr<CDVDMsg> msg, int priority)
+{
+  if (m_count == m_items.size())
+    Grow();
+
+  DVDMessageListItem& item = m_items[Index(m_count)];
+  item.message = std::move(msg);
+  item.priority = priority;
+  m_count++;
+}
+
+void CDVDMessageRing::emplace_back(std::shared_ptr<CDVDMsg> msg, int priority)
+{
+  if (m_count == m_items.size())
+    Grow();
+
+  m_back = (m_back + m_items.size() - 1) & (m_items.size() - 1);
+  DVDMessageListItem& item = m_items[m_back];
+  item.message = std::move(msg);
+  item.priority = priority;
+  m_count++;
+}
+
+void CDVDMessageRing::pop_back()
+{
+  m_items[m_back].message.reset();
+  m_back = Index(1);
+  m_count--;
+}
+
+void CDVDMessageRing::Grow()
+{
+  std::vector<DVDMessageListItem> items(m_items.size() * 2);
+  for (size_t i = 0; i < m_count; ++i)
+    items[i] = std::move(m_items[Index(i)]);
+
+  m_items = std::move(items);
+  m_back = 0;
+}
+
 CDVDMessageQueue::CDVDMessageQueue(const std::string &owner) : m_hEvent(true), m_owner(owner)
 {
   m_iDataSize     = 0;
@@ -152,8 +192,12 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     }
   }
 
-  // inform waiter for new packet
-  m_hEvent.Set();
+  // inform waiter for new packet, the event is only reset by a waiting consumer
+  if (m_waiting)
+  {
+    m_waiting = false;
+    m_hEvent.Set();
+  }
 
   return MSGQ_OK;
 }
@@ -174,25 +218,32 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
   while (!m_bAbortRequest)
   {
-    std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
-
-    if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
+    const bool prioLane = priority > 0 || !m_prioMessages.empty();
+    DVDMessageListItem* item = nullptr;
+    if (prioLane && !m_prioMessages.empty())
+      item = &m_prioMessages.back();
+    else if (!prioLane && !m_messages.empty())
+      item = &m_messages.back();
+
+    if (item && (item->priority >= priority || m_drain))
     {
-      DVDMessageListItem& item(msgs.back());
-      priority = item.priority;
+      priority = item->priority;
 
-      if (item.message->IsType(CDVDMsg::DEMUXER_PACKET) && item.priority == 0)
+      if (item->message->IsType(CDVDMsg::DEMUXER_PACKET) && item->priority == 0)
       {
         DemuxPacket* packet =
-            std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
+            std::static_pointer_cast<CDVDMsgDemuxerPacket>(item->message)->GetPacket();
         if (packet)
         {
           m_iDataSize -= packet->iSize;
         }
       }
 
-      pMsg = std::move(item.message);
-      msgs.pop_back();
+      pMsg = std::move(item->message);
+      if (prioLane)
+        m_prioMessages.pop_back();
+      else
+        m_messages.pop_back();
       UpdateTimeBack();
       ret = MSGQ_OK;
       break;
@@ -205,6 +256,7 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
     else
     {
       m_hEvent.Reset();
+      m_waiting = true;
       lock.unlock();
 
       // wait for a new message
@@ -275,11 +327,12 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
     return 0;
 
   unsigned count = 0;
-  for (const auto &item : m_messages)
-  {
-    if(item.message->IsType(type))
-      count++;
-  }
+  m_messages.for_each(
+      [type, &count](const DVDMessageListItem& item)
+      {
+        if (item.message->IsType(type))
+          count++;
+      });
   for (const auto &item : m_prioMessages)
   {
     if(item.message->IsType(type))
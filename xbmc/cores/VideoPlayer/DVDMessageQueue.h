@@ -16,6 +16,7 @@
 #include <atomic>
 #include <list>
 #include <string>
+#include <vector>
 
 struct DVDMessageListItem
 {
@@ -25,14 +26,72 @@ struct DVDMessageListItem
   }
   DVDMessageListItem() { priority = 0; }
   DVDMessageListItem(const DVDMessageListItem&) = delete;
+  DVDMessageListItem(DVDMessageListItem&&) = default;
   ~DVDMessageListItem() = default;
 
   DVDMessageListItem& operator=(const DVDMessageListItem&) = delete;
+  DVDMessageListItem& operator=(DVDMessageListItem&&) = default;
 
   std::shared_ptr<CDVDMsg> message;
   int priority;
 };
 
+/*!
+ * \brief Ring buffer holding the normal priority messages of a CDVDMessageQueue.
+ *
+ * New messages are added at the "front", the oldest message sits at the "back" and is the next
+ * one to be consumed. Slots are reused once consumed, so after the ring has grown to the depth
+ * the queue runs at, adding and removing packets does not allocate anymore.
+ */
+class CDVDMessageRing
+{
+public:
+  CDVDMessageRing() : m_items(INITIAL_CAPACITY) {}
+
+  bool empty() const { return m_count == 0; }
+  size_t size() const { return m_count; }
+  size_t capacity() const { return m_items.size(); }
+
+  DVDMessageListItem& front() { return m_items[Index(m_count - 1)]; }
+  DVDMessageListItem& back() { return m_items[m_back]; }
+
+  void emplace_front(std::shared_ptr<CDVDMsg> msg, int priority);
+  void emplace_back(std::shared_ptr<CDVDMsg> msg, int priority);
+  void pop_back();
+
+  template<typename P>
+  void remove_if(P pred)
+  {
+    size_t kept = 0;
+    for (size_t i = 0; i < m_count; ++i)
+    {
+      DVDMessageListItem& item = m_items[Index(i)];
+      if (pred(item))
+        item.message.reset();
+      else if (kept++ != i)
+        m_items[Index(kept - 1)] = std::move(item);
+    }
+    m_count = kept;
+  }
+
+  template<typename F>
+  void for_each(F func) const
+  {
+    for (size_t i = 0; i < m_count; ++i)
+      func(m_items[Index(i)]);
+  }
+
+private:
+  static constexpr size_t INITIAL_CAPACITY = 256;
+
+  size_t Index(size_t pos) const { return (m_back + pos) & (m_items.size() - 1); }
+  void Grow();
+
+  std::vector<DVDMessageListItem> m_items; // size is always a power of two
+  size_t m_back = 0;
+  size_t m_count = 0;
+};
+
 enum MsgQueueReturnCode
 {
   MSGQ_OK = 1,
@@ -104,6 +163,7 @@ private:
 
   CEvent m_hEvent;
   mutable CCriticalSection m_section;
+  bool m_waiting = false;
 
   std::atomic<bool> m_bAbortRequest = false;
   bool m_bInitialized;
@@ -117,7 +177,7 @@ private:
   int m_iMaxDataSize;
   std::string m_owner;
 
-  std::list<DVDMessageListItem> m_messages;
+  CDVDMessageRing m_messages;
   std::list<DVDMessageListItem> m_prioMessages;
 };
 
@@ -15,6 +15,7 @@
 #include "DVDDemuxers/DVDDemuxUtils.h"
 #include "DVDDemuxers/DVDDemuxVobsub.h"
 #include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDDemuxers/DemuxPacketPool.h"
 #include "DVDInputStreams/DVDFactoryInputStream.h"
 #include "DVDInputStreams/DVDInputStream.h"
 #include "network/NetworkFileItemClassify.h"
@@ -900,6 +901,8 @@ void CVideoPlayer::OnStartup()
   m_CurrentRadioRDS.Clear();
   m_CurrentAudioID3.Clear();
 
+  CDemuxPacketPool::GetInstance().ResetStats();
+
   UTILS::FONT::ClearTemporaryFonts();
 }
 
@@ -2944,6 +2947,13 @@ void CVideoPlayer::OnExit()
 
   m_messenger.End();
 
+  // all packets of this session are freed by now, give the memory kept for reuse back
+  CDemuxPacketPool& packetPool = CDemuxPacketPool::GetInstance();
+  const DemuxPacketPoolStats poolStats = packetPool.GetStats();
+  CLog::Log(LOGDEBUG, "CVideoPlayer::OnExit - demux packet pool: {:.1f}% hits, peak {} KiB in use",
+            poolStats.GetHitRate() * 100, poolStats.peakBytesInUse / 1024);
+  packetPool.Clear();
+
   CFFmpegLog::ClearLogLevel();
   m_bStop = true;
 
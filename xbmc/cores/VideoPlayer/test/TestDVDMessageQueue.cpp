@@ -0,0 +1,170 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::shared_ptr<CDVDMsgDemuxerPacket> CreatePacket(int size, double dts, int sequence = 0)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+  packet->iSize = size;
+  packet->dts = dts;
+  packet->pts = dts;
+  packet->iGroupId = sequence;
+  return std::make_shared<CDVDMsgDemuxerPacket>(packet);
+}
+
+int GetSequence(const std::shared_ptr<CDVDMsg>& msg)
+{
+  return std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket()->iGroupId;
+}
+} // namespace
+
+class TestDVDMessageQueue : public testing::Test
+{
+protected:
+  TestDVDMessageQueue()
+  {
+    m_queue.SetMaxDataSize(64 * 1024 * 1024);
+    m_queue.SetMaxTimeSize(8.0);
+    m_queue.Init();
+  }
+
+  CDVDMessageQueue m_queue{"test"};
+};
+
+TEST_F(TestDVDMessageQueue, Fifo)
+{
+  // more than the initial ring capacity so that the ring has to grow while wrapped
+  constexpr int count = 1000;
+  std::shared_ptr<CDVDMsg> msg;
+  for (int i = 0; i < count; ++i)
+  {
+    EXPECT_EQ(MSGQ_OK, m_queue.Put(CreatePacket(10, DVD_TIME_BASE / 100.0 * i, i)));
+    if (i % 3 == 0)
+    {
+      ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+      EXPECT_EQ(i / 3, GetSequence(msg));
+    }
+  }
+
+  for (int i = (count + 2) / 3; i < count; ++i)
+  {
+    ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+    EXPECT_EQ(i, GetSequence(msg));
+  }
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(0, m_queue.GetDataSize());
+}
+
+TEST_F(TestDVDMessageQueue, PutBack)
+{
+  std::shared_ptr<CDVDMsg> msg;
+  m_queue.Put(CreatePacket(10, 0, 1));
+  m_queue.Put(CreatePacket(10, DVD_TIME_BASE, 2));
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(1, GetSequence(msg));
+
+  // a message put back is the next one to be returned
+  m_queue.PutBack(msg);
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(1, GetSequence(msg));
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(2, GetSequence(msg));
+}
+
+TEST_F(TestDVDMessageQueue, PriorityLane)
+{
+  std::shared_ptr<CDVDMsg> msg;
+  m_queue.Put(CreatePacket(10, 0, 1));
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESET), 1);
+
+  int priority = 0;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms, priority));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESET));
+  EXPECT_EQ(1, priority);
+
+  // asking for priority messages only does not return packets
+  priority = 1;
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms, priority));
+
+  priority = 0;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms, priority));
+  EXPECT_EQ(1, GetSequence(msg));
+}
+
+TEST_F(TestDVDMessageQueue, FlushAndLevel)
+{
+  m_queue.Put(CreatePacket(1000, 0));
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESET));
+  m_queue.Put(CreatePacket(1000, 2 * DVD_TIME_BASE));
+  EXPECT_EQ(2000, m_queue.GetDataSize());
+  EXPECT_DOUBLE_EQ(2.0, m_queue.GetTimeSize());
+  EXPECT_EQ(25, m_queue.GetLevel());
+  EXPECT_EQ(2u, m_queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+
+  m_queue.Flush();
+  EXPECT_EQ(0, m_queue.GetDataSize());
+  EXPECT_EQ(0u, m_queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+  EXPECT_EQ(1u, m_queue.GetPacketCount(CDVDMsg::GENERAL_RESET));
+}
+
+TEST_F(TestDVDMessageQueue, DISABLED_Throughput)
+{
+  // producer (demuxer) and consumer (decoder) on separate threads, the way VideoPlayer uses it
+  constexpr int count = 200000;
+  constexpr int maxDataSize = 4 * 1024 * 1024;
+  m_queue.SetMaxDataSize(maxDataSize);
+  std::vector<std::chrono::steady_clock::time_point> queued(count);
+  std::vector<double> latencies;
+  latencies.reserve(count);
+
+  const auto start = std::chrono::steady_clock::now();
+  std::thread consumer(
+      [this, &queued, &latencies]
+      {
+        std::shared_ptr<CDVDMsg> msg;
+        while (static_cast<int>(latencies.size()) < count &&
+               m_queue.Get(msg, 1000ms) == MSGQ_OK)
+        {
+          const std::chrono::duration<double, std::micro> latency =
+              std::chrono::steady_clock::now() - queued[GetSequence(msg)];
+          latencies.emplace_back(latency.count());
+          msg.reset();
+        }
+      });
+
+  for (int i = 0; i < count; ++i)
+  {
+    while (m_queue.GetLevel(true) == 100)
+      std::this_thread::yield();
+    queued[i] = std::chrono::steady_clock::now();
+    m_queue.Put(CreatePacket(1024, DVD_TIME_BASE / 1000.0 * i, i));
+  }
+  consumer.join();
+
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  ASSERT_EQ(count, static_cast<int>(latencies.size()));
+
+  std::ranges::sort(latencies);
+  RecordProperty("PacketsPerSecond", static_cast<int>(count / elapsed.count()));
+  RecordProperty("LatencyP50us", static_cast<int>(latencies[count / 2]));
+  RecordProperty("LatencyP99us", static_cast<int>(latencies[count * 99 / 100]));
+}
@@ -318,6 +318,27 @@ std::string CDatabase::GetSingleValue(const std::string& query) const
   return GetSingleValue(query, *m_pDS);
 }
 
+std::string CDatabase::GetSingleValue(const std::string& query,
+                                      const dbiplus::BindParams& params) const
+{
+  std::string ret;
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return ret;
+
+    if (m_pDS->query(query, params) && m_pDS->num_rows() > 0)
+      ret = m_pDS->fv(0).get_asString();
+
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed on query '{}'", query);
+  }
+  return ret;
+}
+
 int CDatabase::GetSingleValueInt(const std::string& query, Dataset& ds) const
 {
   int ret = 0;
@@ -412,6 +433,34 @@ bool CDatabase::ExecuteQuery(const std::string& strQuery)
   return bReturn;
 }
 
+bool CDatabase::ExecuteQuery(const std::string& strQuery, const dbiplus::BindParams& params)
+{
+  if (nullptr == m_pDB)
+    return false;
+
+  if (m_multipleExecute)
+  {
+    m_multipleQueries.push_back(m_pDB->inline_params(strQuery, params));
+    return true;
+  }
+
+  bool bReturn = false;
+
+  try
+  {
+    if (nullptr == m_pDS)
+      return bReturn;
+    m_pDS->exec(strQuery, params);
+    bReturn = true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to execute query '{}'", strQuery);
+  }
+
+  return bReturn;
+}
+
 bool CDatabase::ResultQuery(const std::string& strQuery) const
 {
   bool bReturn = false;
@@ -435,6 +484,27 @@ bool CDatabase::ResultQuery(const std::string& strQuery) const
   return bReturn;
 }
 
+bool CDatabase::ResultQuery(const std::string& strQuery, const dbiplus::BindParams& params) const
+{
+  bool bReturn = false;
+
+  try
+  {
+    if (nullptr == m_pDB)
+      return bReturn;
+    if (nullptr == m_pDS)
+      return bReturn;
+
+    bReturn = m_pDS->query(strQuery, params);
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to execute query '{}'", strQuery);
+  }
+
+  return bReturn;
+}
+
 bool CDatabase::QueueInsertQuery(const std::string& strQuery)
 {
   if (strQuery.empty())
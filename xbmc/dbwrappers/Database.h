@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "qry_dat.h"
+
 #include <memory>
 #include <string>
 #include <string_view>
@@ -132,6 +134,13 @@ public:
                              const std::string& strOrderBy = std::string()) const;
   std::string GetSingleValue(const std::string& query) const;
 
+  /*! \brief Get a single value from a query with '?' placeholders.
+   \param query the query in question, used as is so it must not be PrepareSQL'ed.
+   \param params the values for the placeholders.
+   \return the value from the query, empty on failure.
+   */
+  std::string GetSingleValue(const std::string& query, const dbiplus::BindParams& params) const;
+
   /*! \brief Get a single value from a query on a dataset.
    \param query the query in question.
    \param ds the dataset to use for the query.
@@ -179,6 +188,17 @@ public:
    */
   bool ExecuteQuery(const std::string& strQuery);
 
+  /*!
+   * @brief Execute a query with '?' placeholders that does not return any result.
+   *        The statement is prepared once per connection and reused, so use this for
+   *        statements repeated many times with different values, e.g. during a scan.
+   *        Queued with the values inlined if BeginMultipleExecute() has been called.
+   * @param strQuery The query to execute, used as is so it must not be PrepareSQL'ed.
+   * @param params The values for the placeholders, see dbiplus::make_params().
+   * @return True if the query was executed successfully, false otherwise.
+   */
+  bool ExecuteQuery(const std::string& strQuery, const dbiplus::BindParams& params);
+
   /*!
    * @brief Execute a query that returns a result.
    * @remarks Call m_pDS->close(); to clean up the dataset when done.
@@ -187,6 +207,16 @@ public:
    */
   bool ResultQuery(const std::string& strQuery) const;
 
+  /*!
+   * @brief Execute a query with '?' placeholders that returns a result.
+   * @remarks Call m_pDS->close(); to clean up the dataset when done.
+   * @param strQuery The query to execute, used as is so it must not be PrepareSQL'ed.
+   * @param params The values for the placeholders, see dbiplus::make_params().
+   * @return True if the query was executed successfully, false otherwise.
+   * @sa ExecuteQuery(const std::string&, const dbiplus::BindParams&)
+   */
+  bool ResultQuery(const std::string& strQuery, const dbiplus::BindParams& params) const;
+
   /*!
    * @brief Start a multiple execution queue. Any ExecuteQuery() function
    *        following this call will be queued rather than executed until
@@ -87,6 +87,62 @@ void Database::EscapeStringConversions(std::string& format)
   }
 }
 
+std::string Database::inline_params(std::string_view sql, const BindParams& params)
+{
+  std::string result;
+  result.reserve(sql.size());
+
+  size_t param = 0;
+  char quote = 0;
+  for (const char c : sql)
+  {
+    if (quote)
+    {
+      if (c == quote)
+        quote = 0;
+    }
+    else if (c == '\'' || c == '"' || c == '`')
+      quote = c;
+    else if (c == '?' && param < params.size())
+    {
+      using enum fType;
+      const field_value& value = params[param++];
+      if (value.get_isNull())
+        result += "NULL";
+      else
+      {
+        switch (value.get_fType())
+        {
+          case ft_Boolean:
+          case ft_Char:
+          case ft_Short:
+          case ft_UShort:
+          case ft_Int:
+          case ft_UInt:
+          case ft_Int64:
+            result += std::to_string(value.get_asInt64());
+            break;
+          case ft_Float:
+          case ft_Double:
+          case ft_LongDouble:
+            // as many digits as it takes to read back the same double, %f keeps only 6 decimals
+            result += StringUtils::Format("{:.17g}", value.get_asDouble());
+            break;
+          default:
+            result += '\'';
+            result += prepare("%s", value.get_asString().c_str());
+            result += '\'';
+            break;
+        }
+      }
+      continue;
+    }
+    result += c;
+  }
+
+  return result;
+}
+
 //************* Dataset implementation ***************
 
 Dataset::Dataset() = default;
@@ -136,6 +192,20 @@ void Dataset::setSqlParams(sqlType t, const char* sqlFrmt, ...)
   }
 }
 
+int Dataset::exec(const std::string& sql, const BindParams& params)
+{
+  if (!db)
+    throw DbErrors("No Database Connection");
+  return exec(db->inline_params(sql, params));
+}
+
+bool Dataset::query(const std::string& sql, const BindParams& params)
+{
+  if (!db)
+    throw DbErrors("No Database Connection");
+  return query(db->inline_params(sql, params));
+}
+
 void Dataset::set_select_sql(std::string_view sel_sql)
 {
   select_sql = sel_sql;
@@ -182,6 +252,10 @@ void Dataset::parse_sql(std::string& sqlcmd) const
 
 void Dataset::close()
 {
+  columns.clear();
+  columnar = false;
+  row_buffer.clear();
+  buffered_row = -1;
   haveError = false;
   frecno = 0;
   fbof = feof = true;
@@ -392,10 +466,43 @@ const field_value& Dataset::get_field_value(int index)
 
 const sql_record* Dataset::get_sql_record()
 {
-  if (result.records.empty() || frecno >= (int)result.records.size())
+  return get_record(frecno);
+}
+
+const sql_record* Dataset::get_record(int row)
+{
+  if (columnar)
+  {
+    if (row < 0 || static_cast<size_t>(row) >= columns.num_rows())
+      return nullptr;
+    if (row != buffered_row)
+    {
+      columns.get_row(row, row_buffer);
+      buffered_row = row;
+    }
+    return &row_buffer;
+  }
+
+  if (row < 0 || static_cast<size_t>(row) >= result.records.size())
     return nullptr;
 
-  return result.records[frecno];
+  return result.records[row];
+}
+
+bool Dataset::query_columnar(const std::string& sql)
+{
+  columnar_requested = true;
+  try
+  {
+    const bool ret = query(sql);
+    columnar_requested = false;
+    return ret;
+  }
+  catch (...)
+  {
+    columnar_requested = false;
+    throw;
+  }
 }
 
 field_value Dataset::f_old(const char* f_name)
@@ -21,6 +21,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 
 namespace dbiplus
 {
@@ -174,6 +175,17 @@ public:
 
   virtual bool in_transaction() { return false; }
 
+  /*! \brief Substitute the '?' placeholders of a statement with the escaped parameter values.
+   Used where a statement can't be prepared, e.g. when queued for later execution.
+   \param sql - statement with '?' placeholders, those within quotes are left alone
+   \param params - values for the placeholders, in order
+   \return the statement with the values inlined.
+   */
+  std::string inline_params(std::string_view sql, const BindParams& params);
+
+  /*! \brief Number of prepared statements currently cached on this connection */
+  virtual size_t cached_statements() const { return 0; }
+
 protected:
   /*! \brief Rewrite each "%s" conversion sequence to "%q", the quote-escaping form.
    \param format - C printf compliant format string, rewritten in place
@@ -226,6 +238,17 @@ protected:
   result_set exec_res;
   bool autorefresh{false};
 
+  /* query results stored by column, when asked for with query_columnar() */
+  column_result_set columns;
+  bool columnar{false};
+  bool columnar_requested{false};
+  /* the current columnar row, decoded on access */
+  sql_record row_buffer;
+  int buffered_row{-1};
+
+  /* for the backends: whether the query being opened stores its results by column */
+  bool begin_columnar() { return columnar = std::exchange(columnar_requested, false); }
+
   bool active{false}; // Is Query Opened?
   bool haveError{false};
   int frecno{0}; // number of current row bei bewegung
@@ -318,6 +341,27 @@ public:
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
+
+  /*! \brief As query(), storing the results column by column rather than as records.
+   Meant for large listings: filling the result set allocates in blocks instead of per value.
+   Rows are decoded on access by get_record() and the navigation functions, into a buffer that
+   is reused for the next row, so copy out what is needed before moving on.
+   */
+  bool query_columnar(const std::string& sql);
+
+  /*! \brief Execute a statement with '?' placeholders, without results to return.
+   The backends keep the compiled statement in a per connection cache, so repeating the same
+   statement with other values skips parsing it again.
+   \param sql - statement with '?' placeholders, passed to the backend unchanged
+   \param params - values bound to the placeholders, in order
+   \return DB_COMMAND_OK, throws DbErrors on failure.
+   */
+  virtual int exec(const std::string& sql, const BindParams& params);
+  /*! \brief As query(), for a SELECT statement with '?' placeholders.
+   \sa exec(const std::string&, const BindParams&)
+   */
+  virtual bool query(const std::string& sql, const BindParams& params);
+
   /* Close SQL Query*/
   virtual void close();
   /* Refresh dataset (reopen it and set the same cursor position) */
@@ -403,6 +447,12 @@ public:
   /* --------------- for fast access ---------------- */
   const result_set& get_result_set() const { return result; }
   const sql_record* get_sql_record();
+  /*! \brief Random access to a row of the result, for either kind of result set.
+   \return the row, valid until the next row is accessed, nullptr when out of range.
+   */
+  const sql_record* get_record(int row);
+  /* memory held by a columnar result set, in bytes */
+  size_t get_columnar_size() const { return columns.memory_usage(); }
 
 private:
   Dataset(const Dataset&) = delete;
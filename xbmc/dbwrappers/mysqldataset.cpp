@@ -41,6 +41,10 @@ namespace
 constexpr int MYSQL_OK = 0;
 constexpr int ER_BAD_DB_ERROR = 1049;
 
+// a scan only uses a few dozen distinct statements, flush everything when something unexpected
+// keeps adding new ones
+constexpr size_t MAX_CACHED_STATEMENTS = 256;
+
 #define DEF_CHARSET "utf8mb4"
 #define DEF_COLLATION "utf8mb4_general_ci"
 constexpr std::string_view SQL_CHARSET_COLLATION =
@@ -374,6 +378,7 @@ int MysqlDatabase::connect(bool create_new)
 
 void MysqlDatabase::disconnect()
 {
+  finalize_statements();
   if (conn)
   {
     mysql_close(conn);
@@ -642,6 +647,72 @@ int MysqlDatabase::query_with_reconnect(std::string_view query)
   return result;
 }
 
+MYSQL_STMT* MysqlDatabase::get_statement(const std::string& sql)
+{
+  if (!active || !conn)
+    return nullptr;
+
+  if (const auto it = statements.find(sql); it != statements.end())
+    return it->second;
+
+  // servers limit the prepared statements per connection (max_prepared_stmt_count)
+  if (statements.size() >= MAX_CACHED_STATEMENTS)
+    finalize_statements();
+
+  int attempts = 5;
+  while (true)
+  {
+    MYSQL_STMT* stmt = mysql_stmt_init(conn);
+    if (!stmt)
+    {
+      setErr(mysql_errno(conn), sql.c_str());
+      return nullptr;
+    }
+
+    if (mysql_stmt_prepare(stmt, sql.c_str(), sql.size()) == MYSQL_OK)
+    {
+      statements.try_emplace(sql, stmt);
+      return stmt;
+    }
+
+    setStmtErr(stmt, sql.c_str());
+    const unsigned int err = mysql_stmt_errno(stmt);
+    mysql_stmt_close(stmt);
+
+    // try to reconnect if server is gone, as query_with_reconnect() does
+    if ((err != CR_SERVER_GONE_ERROR && err != CR_SERVER_LOST) || attempts-- <= 0)
+      return nullptr;
+
+    CLog::Log(LOGINFO, "MYSQL server has gone. Will try {} more attempt(s) to reconnect.",
+              attempts);
+    if (!reconnect())
+      return nullptr;
+  }
+}
+
+int MysqlDatabase::setStmtErr(MYSQL_STMT* stmt, const char* qry)
+{
+  const unsigned int err = mysql_stmt_errno(stmt);
+  const char* errMsg = mysql_stmt_error(stmt);
+  error = StringUtils::Format("[{}] MySQL error {} ({}): {}\nQuery: {}\n", db, err,
+                              mysql_stmt_sqlstate(stmt), *errMsg != 0 ? errMsg : "unknown error",
+                              qry);
+  return static_cast<int>(err);
+}
+
+bool MysqlDatabase::reconnect()
+{
+  active = false;
+  return connect(true) == DB_CONNECTION_OK;
+}
+
+void MysqlDatabase::finalize_statements()
+{
+  for (const auto& [sql, stmt] : statements)
+    mysql_stmt_close(stmt);
+  statements.clear();
+}
+
 long MysqlDatabase::nextid(const char* sname)
 {
   CLog::LogFC(LOGDEBUG, LOGDATABASE, "nextid for {}", sname);
@@ -1881,8 +1952,7 @@ void MysqlDataset::make_deletion()
 
 void MysqlDataset::fill_fields()
 {
-  if (!db || (result.record_header.empty()) ||
-      (result.records.size() < static_cast<unsigned int>(frecno)))
+  if (!db || (result.record_header.empty()) || (num_rows() < frecno))
     return;
 
   if (fields_object->empty()) // Filling columns name
@@ -1899,17 +1969,13 @@ void MysqlDataset::fill_fields()
   }
 
   //Filling result
-  if (!result.records.empty())
+  if (const sql_record* row = get_record(frecno))
   {
-    const sql_record* row = result.records[frecno];
-    if (row)
-    {
-      const size_t ncols = row->size();
-      fields_object->resize(ncols);
-      for (size_t i = 0; i < ncols; ++i)
-        (*fields_object)[i].val = row->at(i);
-      return;
-    }
+    const size_t ncols = row->size();
+    fields_object->resize(ncols);
+    for (size_t i = 0; i < ncols; ++i)
+      (*fields_object)[i].val = row->at(i);
+    return;
   }
   const size_t ncols = result.record_header.size();
   fields_object->resize(ncols);
@@ -1979,6 +2045,97 @@ int MysqlDataset::exec(const std::string& sql)
   }
 }
 
+int MysqlDataset::exec(const std::string& sql, const BindParams& params)
+{
+  using enum fType;
+
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  exec_res.clear();
+
+  // the bound buffers have to outlive mysql_stmt_execute
+  std::vector<MYSQL_BIND> binds(params.size());
+  std::vector<int64_t> ints(params.size());
+  std::vector<double> doubles(params.size());
+  std::vector<std::string> strings(params.size());
+  std::vector<unsigned long> lengths(params.size());
+  for (size_t i = 0; i < params.size(); ++i)
+  {
+    const field_value& value = params[i];
+    MYSQL_BIND& bind = binds[i];
+    if (value.get_isNull())
+    {
+      bind.buffer_type = MYSQL_TYPE_NULL;
+      continue;
+    }
+    switch (value.get_fType())
+    {
+      case ft_Boolean:
+      case ft_Char:
+      case ft_Short:
+      case ft_UShort:
+      case ft_Int:
+      case ft_UInt:
+      case ft_Int64:
+        ints[i] = value.get_asInt64();
+        bind.buffer_type = MYSQL_TYPE_LONGLONG;
+        bind.buffer = &ints[i];
+        break;
+      case ft_Float:
+      case ft_Double:
+      case ft_LongDouble:
+        doubles[i] = value.get_asDouble();
+        bind.buffer_type = MYSQL_TYPE_DOUBLE;
+        bind.buffer = &doubles[i];
+        break;
+      default:
+        strings[i] = value.get_asString();
+        lengths[i] = static_cast<unsigned long>(strings[i].size());
+        bind.buffer_type = MYSQL_TYPE_STRING;
+        bind.buffer = strings[i].data();
+        bind.buffer_length = lengths[i];
+        bind.length = &lengths[i];
+        break;
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+
+  auto* mysqlDb = static_cast<MysqlDatabase*>(db);
+  for (bool retry = true;; retry = false)
+  {
+    MYSQL_STMT* stmt = mysqlDb->get_statement(sql);
+    if (!stmt)
+      throw DbErrors("%s", db->getErrorMsg());
+
+    if (mysql_stmt_param_count(stmt) != params.size())
+      throw DbErrors("Wrong number of parameters (%zu) for query: %s", params.size(), sql.c_str());
+
+    if (mysql_stmt_bind_param(stmt, binds.data()) == MYSQL_OK &&
+        mysql_stmt_execute(stmt) == MYSQL_OK)
+      break;
+
+    mysqlDb->setStmtErr(stmt, sql.c_str());
+
+    // the cached statements went away with the connection, reconnecting prepares them again
+    const unsigned int err = mysql_stmt_errno(stmt);
+    if (!retry || (err != CR_SERVER_GONE_ERROR && err != CR_SERVER_LOST))
+      throw DbErrors("%s", db->getErrorMsg());
+
+    CLog::Log(LOGINFO, "MYSQL server has gone. Will try to reconnect and execute the query again.");
+    if (!mysqlDb->reconnect())
+      throw DbErrors("%s", db->getErrorMsg());
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for prepared query: {}", duration.count(), sql);
+
+  return MYSQL_OK;
+}
+
 int MysqlDataset::exec()
 {
   return exec(sql);
@@ -1998,6 +2155,7 @@ bool MysqlDataset::query(const std::string& query)
   assert(query.find("SELECT") != std::string::npos || query.find("select") != std::string::npos);
 
   close();
+  begin_columnar();
 
   size_t loc;
 
@@ -2025,6 +2183,53 @@ bool MysqlDataset::query(const std::string& query)
   for (unsigned int i = 0; i < numColumns; i++)
     result.record_header[i].name = fields[i].name;
 
+  if (columnar)
+  {
+    // same conversions as for records below
+    columns.reset(numColumns);
+    while ((row = mysql_fetch_row(stmt)))
+    {
+      const unsigned long* lengths = mysql_fetch_lengths(stmt);
+      for (unsigned int i = 0; i < numColumns; i++)
+      {
+        switch (fields[i].type)
+        {
+          case MYSQL_TYPE_LONGLONG:
+          case MYSQL_TYPE_DECIMAL:
+          case MYSQL_TYPE_NEWDECIMAL:
+          case MYSQL_TYPE_TINY:
+          case MYSQL_TYPE_SHORT:
+          case MYSQL_TYPE_INT24:
+          case MYSQL_TYPE_LONG:
+            columns.add_int64(i, row[i] ? strtoll(row[i], nullptr, 10) : 0);
+            break;
+          case MYSQL_TYPE_FLOAT:
+          case MYSQL_TYPE_DOUBLE:
+            columns.add_double(i, row[i] ? atof(row[i]) : 0);
+            break;
+          case MYSQL_TYPE_STRING:
+          case MYSQL_TYPE_VAR_STRING:
+          case MYSQL_TYPE_VARCHAR:
+          case MYSQL_TYPE_TINY_BLOB:
+          case MYSQL_TYPE_MEDIUM_BLOB:
+          case MYSQL_TYPE_LONG_BLOB:
+          case MYSQL_TYPE_BLOB:
+            columns.add_text(i, row[i] ? row[i] : "", row[i] ? lengths[i] : 0);
+            break;
+          case MYSQL_TYPE_NULL:
+          default:
+            columns.add_null(i);
+            break;
+        }
+      }
+    }
+    mysql_free_result(stmt);
+    active = true;
+    ds_state = dsSelect;
+    this->first();
+    return true;
+  }
+
   // returned rows
   while ((row = mysql_fetch_row(stmt)))
   { // have a row of data
@@ -2142,7 +2347,7 @@ void MysqlDataset::cancel()
 
 int MysqlDataset::num_rows()
 {
-  return static_cast<int>(result.records.size());
+  return static_cast<int>(columnar ? columns.num_rows() : result.records.size());
 }
 
 bool MysqlDataset::eof()
@@ -12,6 +12,7 @@
 
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #ifdef HAS_MYSQL
 #include <mysql/mysql.h>
@@ -46,6 +47,8 @@ public:
   /* func. returns current status about MySQL-server connection */
   int status() override;
   int setErr(int err_code, const char* qry) override;
+  /* as setErr, for an error of a prepared statement */
+  int setStmtErr(MYSQL_STMT* stmt, const char* qry);
 
   /* func. connects to database-server */
   int connect(bool create) override;
@@ -79,7 +82,22 @@ public:
   int query_with_reconnect(std::string_view query);
   void configure_connection();
 
+  /*! \brief Get the server side prepared form of a statement, preparing it on first use.
+   \return the statement, nullptr on error with the error set.
+   */
+  MYSQL_STMT* get_statement(const std::string& sql);
+
+  /*! \brief Connect again after the server has gone away, dropping the cached statements.
+   \return true if connected.
+   */
+  bool reconnect();
+  size_t cached_statements() const override { return statements.size(); }
+
 private:
+  void finalize_statements();
+
+  std::unordered_map<std::string, MYSQL_STMT*> statements;
+
   char et_getdigit(double* val, int* cnt) const;
   std::string mysql_vmprintf(const char* zFormat, va_list ap);
 
@@ -150,9 +168,13 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  int exec(const std::string& sql, const BindParams& params) override;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  /* queries with parameters have them inlined, results of prepared statements are bound
+     column by column which doesn't fit the text based result set */
+  using Dataset::query;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
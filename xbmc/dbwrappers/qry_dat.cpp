@@ -17,7 +17,9 @@
 
 #include "qry_dat.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -810,4 +812,118 @@ std::string_view field_value::gft() const
   return "";
 }
 
+//************* column_result_set implementation ***************
+
+namespace
+{
+// text is packed into blocks of this size, longer values get a block of their own
+constexpr size_t ARENA_BLOCK_SIZE = 64 * 1024;
+} // namespace
+
+void column_result_set::reset(size_t ncols)
+{
+  columns.clear();
+  columns.resize(ncols);
+  blocks.clear();
+  large_blocks.clear();
+  block_used = block_size = arena_size = 0;
+}
+
+void column_result_set::add_null(size_t col)
+{
+  cell& c = columns[col].emplace_back();
+  c.integer = 0;
+  c.len = 0;
+  c.type = cellType::null;
+}
+
+void column_result_set::add_int64(size_t col, int64_t value)
+{
+  cell& c = columns[col].emplace_back();
+  c.integer = value;
+  c.len = 0;
+  c.type = cellType::integer;
+}
+
+void column_result_set::add_double(size_t col, double value)
+{
+  cell& c = columns[col].emplace_back();
+  c.floating = value;
+  c.len = 0;
+  c.type = cellType::floating;
+}
+
+void column_result_set::add_text(size_t col, const char* text, size_t len)
+{
+  cell& c = columns[col].emplace_back();
+  c.text = store(text, len);
+  c.len = static_cast<uint32_t>(len);
+  c.type = cellType::text;
+}
+
+const char* column_result_set::store(const char* text, size_t len)
+{
+  if (len == 0)
+    return "";
+
+  if (len > ARENA_BLOCK_SIZE / 4)
+  {
+    // a block of its own, the current one stays open for the small values that follow
+    auto& block = large_blocks.emplace_back(std::make_unique<char[]>(len));
+    std::memcpy(block.get(), text, len);
+    arena_size += len;
+    return block.get();
+  }
+
+  if (blocks.empty() || block_used + len > block_size)
+  {
+    blocks.emplace_back(std::make_unique<char[]>(ARENA_BLOCK_SIZE));
+    block_used = 0;
+    block_size = ARENA_BLOCK_SIZE;
+    arena_size += ARENA_BLOCK_SIZE;
+  }
+
+  char* dest = blocks.back().get() + block_used;
+  std::memcpy(dest, text, len);
+  block_used += len;
+  return dest;
+}
+
+void column_result_set::get_row(size_t row, sql_record& record) const
+{
+  record.resize(columns.size());
+  for (size_t col = 0; col < columns.size(); ++col)
+  {
+    const cell& c = columns[col][row];
+    field_value& v = record[col];
+    switch (c.type)
+    {
+      case cellType::integer:
+        v.set_asInt64(c.integer);
+        v.set_isNull(false);
+        break;
+      case cellType::floating:
+        v.set_asDouble(c.floating);
+        v.set_isNull(false);
+        break;
+      case cellType::text:
+        v.set_asString(c.text, c.len);
+        v.set_isNull(false);
+        break;
+      case cellType::null:
+        v.set_asString("", 0);
+        v.set_isNull();
+        break;
+    }
+  }
+}
+
+size_t column_result_set::memory_usage() const
+{
+  size_t size = arena_size;
+  for (const auto& column : columns)
+    size += column.capacity() * sizeof(cell);
+  return size;
+}
+
 } // namespace dbiplus
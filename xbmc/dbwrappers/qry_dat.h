@@ -13,6 +13,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -219,7 +220,7 @@ public:
     }
   }
 
-  void set_isNull() { is_null = true; }
+  void set_isNull(bool null = true) { is_null = null; }
   void set_asString(const char* s);
   void set_asString(const char* s, std::size_t len);
   void set_asString(std::string_view s);
@@ -238,6 +239,48 @@ public:
   std::string_view gft() const;
 };
 
+/* Values bound, in order, to the '?' placeholders of a prepared statement */
+using BindParams = std::vector<field_value>;
+
+inline field_value make_param(std::string_view s)
+{
+  return field_value(s.data(), s.size());
+}
+inline field_value make_param(const char* s)
+{
+  return field_value(s);
+}
+inline field_value make_param(bool b)
+{
+  return field_value(b);
+}
+inline field_value make_param(int i)
+{
+  return field_value(i);
+}
+inline field_value make_param(unsigned int i)
+{
+  return field_value(i);
+}
+inline field_value make_param(int64_t i)
+{
+  return field_value(i);
+}
+inline field_value make_param(double d)
+{
+  return field_value(d);
+}
+
+/* Build the parameters of a prepared statement, e.g. make_params(idSong, strArtist) */
+template<typename... Args>
+BindParams make_params(const Args&... args)
+{
+  BindParams params;
+  params.reserve(sizeof...(args));
+  (params.emplace_back(make_param(args)), ...);
+  return params;
+}
+
 struct field_prop
 {
   std::string name;
@@ -273,6 +316,61 @@ public:
   query_data records;
 };
 
+/* Result set stored column by column, for large listings.
+   Every value is a 16 byte cell holding a number or pointing into an arena of text blocks, so
+   filling it costs a handful of allocations instead of a record plus a string per value. */
+class column_result_set
+{
+public:
+  /* start over with the given number of columns, releasing the previous contents */
+  void reset(size_t columns);
+  void clear() { reset(0); }
+
+  void add_null(size_t col);
+  void add_int64(size_t col, int64_t value);
+  void add_double(size_t col, double value);
+  void add_text(size_t col, const char* text, size_t len);
+
+  size_t num_columns() const { return columns.size(); }
+  size_t num_rows() const { return columns.empty() ? 0 : columns.back().size(); }
+
+  /* decode a row into a record, reusing the storage of its values */
+  void get_row(size_t row, sql_record& record) const;
+
+  /* bytes held, cells and text arena */
+  size_t memory_usage() const;
+
+private:
+  enum class cellType : uint8_t
+  {
+    null,
+    integer,
+    floating,
+    text
+  };
+
+  struct cell
+  {
+    union
+    {
+      int64_t integer;
+      double floating;
+      const char* text;
+    };
+    uint32_t len;
+    cellType type;
+  };
+
+  const char* store(const char* text, size_t len);
+
+  std::vector<std::vector<cell>> columns;
+  std::vector<std::unique_ptr<char[]>> blocks;
+  std::vector<std::unique_ptr<char[]>> large_blocks;
+  size_t block_used{0};
+  size_t block_size{0};
+  size_t arena_size{0};
+};
+
 #ifdef TARGET_WINDOWS_STORE
 #pragma pack(pop)
 #endif
@@ -207,6 +207,27 @@ int busy_callback(void*, int /*busyCount*/)
   KODI::TIME::Sleep(100ms);
   return 1;
 }
+
+// scans only use a few dozen distinct statements, flush everything when something unexpected
+// keeps adding new ones
+constexpr size_t MAX_CACHED_STATEMENTS = 256;
+
+// return a cached statement to its initial state once done with it, whatever the outcome
+class CStatementReset
+{
+public:
+  explicit CStatementReset(sqlite3_stmt* stmt) : m_stmt(stmt) {}
+  ~CStatementReset()
+  {
+    sqlite3_reset(m_stmt);
+    sqlite3_clear_bindings(m_stmt);
+  }
+  CStatementReset(const CStatementReset&) = delete;
+  CStatementReset& operator=(const CStatementReset&) = delete;
+
+private:
+  sqlite3_stmt* m_stmt;
+};
 } // unnamed namespace
 
 namespace dbiplus
@@ -407,6 +428,7 @@ void SqliteDatabase::disconnect()
 {
   if (!active)
     return;
+  finalize_statements();
   sqlite3_close(conn);
   active = false;
   conn = nullptr; // Reset handle to avoid stale pointer usage after database is closed
@@ -589,6 +611,36 @@ long SqliteDatabase::nextid(const char* sname)
   return DB_UNEXPECTED_RESULT;
 }
 
+sqlite3_stmt* SqliteDatabase::get_statement(const std::string& sql)
+{
+  if (!active)
+    return nullptr;
+
+  if (const auto it = statements.find(sql); it != statements.end())
+    return it->second;
+
+  if (statements.size() >= MAX_CACHED_STATEMENTS)
+    finalize_statements();
+
+  sqlite3_stmt* stmt = nullptr;
+  if (setErr(sqlite3_prepare_v2(conn, sql.c_str(), static_cast<int>(sql.size()), &stmt, nullptr),
+             sql.c_str()) != SQLITE_OK)
+  {
+    sqlite3_finalize(stmt);
+    return nullptr;
+  }
+
+  statements.try_emplace(sql, stmt);
+  return stmt;
+}
+
+void SqliteDatabase::finalize_statements()
+{
+  for (const auto& [sql, stmt] : statements)
+    sqlite3_finalize(stmt);
+  statements.clear();
+}
+
 // methods for transactions
 // ---------------------------------------------
 void SqliteDatabase::start_transaction()
@@ -794,8 +846,7 @@ void SqliteDataset::make_deletion()
 void SqliteDataset::fill_fields()
 {
   //cout <<"rr "<<result.records.size()<<"|" << frecno <<"\n";
-  if (!db || (result.record_header.empty()) ||
-      (result.records.size() < static_cast<unsigned int>(frecno)))
+  if (!db || (result.record_header.empty()) || (num_rows() < frecno))
     return;
 
   if (fields_object->empty()) // Filling columns name
@@ -812,17 +863,13 @@ void SqliteDataset::fill_fields()
   }
 
   //Filling result
-  if (!result.records.empty())
+  if (const sql_record* row = get_record(frecno))
   {
-    const sql_record* row = result.records[frecno];
-    if (row)
-    {
-      const size_t ncols = row->size();
-      fields_object->resize(ncols);
-      for (size_t i = 0; i < ncols; ++i)
-        (*fields_object)[i].val = row->at(i);
-      return;
-    }
+    const size_t ncols = row->size();
+    fields_object->resize(ncols);
+    for (size_t i = 0; i < ncols; ++i)
+      (*fields_object)[i].val = row->at(i);
+    return;
   }
   const size_t ncols = result.record_header.size();
   fields_object->resize(ncols);
@@ -942,26 +989,149 @@ bool SqliteDataset::query(const std::string& query)
   assert(query.find("SELECT") != std::string::npos || query.find("select") != std::string::npos);
 
   close();
+  begin_columnar();
 
   sqlite3_stmt* stmt = nullptr;
   if (db->setErr(sqlite3_prepare_v2(handle(), query.c_str(), -1, &stmt, nullptr), query.c_str()) !=
       SQLITE_OK)
     throw DbErrors("%s", db->getErrorMsg());
 
+  fetch_rows(stmt);
+  if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
+  {
+    active = true;
+    ds_state = dsSelect;
+    this->first();
+    return true;
+  }
+  else
+  {
+    throw DbErrors("%s", db->getErrorMsg());
+  }
+}
+
+bool SqliteDataset::query(const std::string& sql, const BindParams& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  // Must be a SELECT SQL query
+  assert(sql.find("SELECT") != std::string::npos || sql.find("select") != std::string::npos);
+
+  close();
+  begin_columnar();
+
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->get_statement(sql);
+  if (!stmt)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  CStatementReset reset(stmt);
+  bind_params(stmt, params, sql);
+  if (db->setErr(fetch_rows(stmt), sql.c_str()) != SQLITE_DONE)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
+}
+
+int SqliteDataset::exec(const std::string& sql, const BindParams& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  exec_res.clear();
+
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->get_statement(sql);
+  if (!stmt)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  CStatementReset reset(stmt);
+  bind_params(stmt, params, sql);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  int res;
+  while ((res = sqlite3_step(stmt)) == SQLITE_ROW)
+    ;
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for prepared query: {}", duration.count(), sql);
+
+  if (db->setErr(res, sql.c_str()) != SQLITE_DONE)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  return SQLITE_OK;
+}
+
+void SqliteDataset::bind_params(sqlite3_stmt* stmt, const BindParams& params, const std::string& sql)
+{
+  using enum fType;
+
+  if (static_cast<size_t>(sqlite3_bind_parameter_count(stmt)) != params.size())
+    throw DbErrors("Wrong number of parameters (%zu) for query: %s", params.size(), sql.c_str());
+
+  for (int i = 0; i < static_cast<int>(params.size()); ++i)
+  {
+    const field_value& value = params[i];
+    int res;
+    if (value.get_isNull())
+      res = sqlite3_bind_null(stmt, i + 1);
+    else
+    {
+      switch (value.get_fType())
+      {
+        case ft_Boolean:
+        case ft_Char:
+        case ft_Short:
+        case ft_UShort:
+        case ft_Int:
+        case ft_UInt:
+        case ft_Int64:
+          res = sqlite3_bind_int64(stmt, i + 1, value.get_asInt64());
+          break;
+        case ft_Float:
+        case ft_Double:
+        case ft_LongDouble:
+          res = sqlite3_bind_double(stmt, i + 1, value.get_asDouble());
+          break;
+        default:
+        {
+          const std::string str = value.get_asString();
+          res = sqlite3_bind_text(stmt, i + 1, str.c_str(), static_cast<int>(str.size()),
+                                  SQLITE_TRANSIENT);
+          break;
+        }
+      }
+    }
+    if (db->setErr(res, sql.c_str()) != SQLITE_OK)
+      throw DbErrors("%s", db->getErrorMsg());
+  }
+}
+
+int SqliteDataset::fetch_rows(sqlite3_stmt* stmt)
+{
   // column headers
   const unsigned int numColumns = sqlite3_column_count(stmt);
   result.record_header.resize(numColumns);
   for (unsigned int i = 0; i < numColumns; i++)
     result.record_header[i].name = sqlite3_column_name(stmt, i);
 
+  if (columnar)
+    return fetch_columns(stmt);
+
   // returned rows
-  while (sqlite3_step(stmt) == SQLITE_ROW)
+  int res;
+  while ((res = sqlite3_step(stmt)) == SQLITE_ROW)
   { // have a row of data
-    auto* res = new sql_record;
-    res->resize(numColumns);
+    auto* row = new sql_record;
+    row->resize(numColumns);
     for (unsigned int i = 0; i < numColumns; i++)
     {
-      field_value& v = res->at(i);
+      field_value& v = row->at(i);
       switch (sqlite3_column_type(stmt, i))
       {
         case SQLITE_INTEGER:
@@ -985,19 +1155,42 @@ bool SqliteDataset::query(const std::string& query)
           break;
       }
     }
-    result.records.push_back(res);
+    result.records.push_back(row);
   }
-  if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
-  {
-    active = true;
-    ds_state = dsSelect;
-    this->first();
-    return true;
-  }
-  else
+  return res;
+}
+
+int SqliteDataset::fetch_columns(sqlite3_stmt* stmt)
+{
+  const int numColumns = sqlite3_column_count(stmt);
+  columns.reset(numColumns);
+
+  int res;
+  while ((res = sqlite3_step(stmt)) == SQLITE_ROW)
   {
-    throw DbErrors("%s", db->getErrorMsg());
+    for (int i = 0; i < numColumns; i++)
+    {
+      switch (sqlite3_column_type(stmt, i))
+      {
+        case SQLITE_INTEGER:
+          columns.add_int64(i, sqlite3_column_int64(stmt, i));
+          break;
+        case SQLITE_FLOAT:
+          columns.add_double(i, sqlite3_column_double(stmt, i));
+          break;
+        case SQLITE_TEXT:
+        case SQLITE_BLOB:
+          columns.add_text(i, reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                           sqlite3_column_bytes(stmt, i));
+          break;
+        case SQLITE_NULL:
+        default:
+          columns.add_null(i);
+          break;
+      }
+    }
   }
+  return res;
 }
 
 void SqliteDataset::open(const std::string& sql)
@@ -1041,7 +1234,7 @@ void SqliteDataset::cancel()
 
 int SqliteDataset::num_rows()
 {
-  return static_cast<int>(result.records.size());
+  return static_cast<int>(columnar ? columns.num_rows() : result.records.size());
 }
 
 bool SqliteDataset::eof()
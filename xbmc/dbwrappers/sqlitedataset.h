@@ -15,8 +15,10 @@
 #include "dataset.h"
 
 #include <string>
+#include <unordered_map>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace dbiplus
 {
@@ -81,6 +83,18 @@ public:
   std::string vprepare(std::string_view format, va_list args) override;
 
   bool in_transaction() override { return _in_transaction; }
+
+  /*! \brief Get the compiled form of a statement, preparing it on first use.
+   The statement stays owned by the cache and must be reset by the caller after use.
+   \return the statement, nullptr on error with the error set.
+   */
+  sqlite3_stmt* get_statement(const std::string& sql);
+  size_t cached_statements() const override { return statements.size(); }
+
+private:
+  void finalize_statements();
+
+  std::unordered_map<std::string, sqlite3_stmt*> statements;
 };
 
 /***************** Class SqliteDataset definition *******************
@@ -111,6 +125,13 @@ protected:
   /* Changing field values during dataset navigation */
   virtual void free_row(); // free the memory allocated for the current row
 
+  /* Bind the parameters of a cached statement */
+  void bind_params(sqlite3_stmt* stmt, const BindParams& params, const std::string& sql);
+  /* Step through a statement, collecting its rows into the result set */
+  int fetch_rows(sqlite3_stmt* stmt);
+  /* As fetch_rows, into the columnar result set */
+  int fetch_columns(sqlite3_stmt* stmt);
+
 public:
   /* constructor */
   using Dataset::Dataset;
@@ -128,9 +149,11 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  int exec(const std::string& sql, const BindParams& params) override;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  bool query(const std::string& sql, const BindParams& params) override;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
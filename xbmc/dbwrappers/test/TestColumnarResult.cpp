@@ -0,0 +1,209 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/Directory.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/URIUtils.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace dbiplus;
+
+namespace
+{
+class TestColumnarResult : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    folder = URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"),
+                                       "TestColumnarResult");
+    ASSERT_TRUE(XFILE::CDirectory::Create(folder));
+    db.setHostName(folder.c_str());
+    db.setDatabase("test");
+    ASSERT_EQ(DB_CONNECTION_OK, db.connect(true));
+    ds.reset(db.CreateDataset());
+    ds->exec("CREATE TABLE movie (idMovie INTEGER PRIMARY KEY, c00 TEXT, c01 TEXT, c02 TEXT, "
+             "c03 TEXT, c04 TEXT, c05 TEXT, c06 TEXT, c07 TEXT, strPath TEXT, fRating REAL, "
+             "playCount INTEGER)");
+  }
+
+  void TearDown() override
+  {
+    ds.reset();
+    db.disconnect();
+    XFILE::CDirectory::RemoveRecursive(folder);
+  }
+
+  /*!
+   * \brief Fill the table like a movie view: many short text columns, a long plot and some NULLs.
+   */
+  void Populate(int rows)
+  {
+    const std::string plot(400, 'p');
+    db.start_transaction();
+    for (int i = 0; i < rows; ++i)
+    {
+      BindParams params = make_params(
+          i + 1, "Movie " + std::to_string(i), plot, "Tagline", std::to_string(i % 10), "Writer",
+          "1080p", "Director", "2024-01-01", "/movies/" + std::to_string(i) + "/", i * 0.5, i % 3);
+      if (i % 7 == 0)
+        params[11].set_isNull();
+      ds->exec("INSERT INTO movie VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", params);
+    }
+    db.commit_transaction();
+  }
+
+  std::string folder;
+  SqliteDatabase db;
+  std::unique_ptr<Dataset> ds;
+};
+
+size_t HeapInUse()
+{
+#if defined(__GLIBC__)
+  return mallinfo2().uordblks;
+#else
+  return 0;
+#endif
+}
+} // namespace
+
+TEST(TestColumnResultSet, Values)
+{
+  column_result_set columns;
+  columns.reset(4);
+  columns.add_int64(0, 42);
+  columns.add_double(1, 2.5);
+  columns.add_text(2, "text", 4);
+  columns.add_null(3);
+  const std::string large(100 * 1024, 'x');
+  columns.add_int64(0, -1);
+  columns.add_double(1, 0.0);
+  columns.add_text(2, large.c_str(), large.size());
+  columns.add_text(3, "", 0);
+  EXPECT_EQ(4u, columns.num_columns());
+  EXPECT_EQ(2u, columns.num_rows());
+  EXPECT_GT(columns.memory_usage(), large.size());
+
+  sql_record record;
+  columns.get_row(0, record);
+  ASSERT_EQ(4u, record.size());
+  EXPECT_EQ(42, record[0].get_asInt64());
+  EXPECT_DOUBLE_EQ(2.5, record[1].get_asDouble());
+  EXPECT_EQ("text", record[2].get_asString());
+  EXPECT_TRUE(record[3].get_isNull());
+
+  // the same record is reused for the next row
+  columns.get_row(1, record);
+  EXPECT_EQ(-1, record[0].get_asInt64());
+  EXPECT_EQ(large, record[2].get_asString());
+  EXPECT_FALSE(record[3].get_isNull());
+  EXPECT_EQ("", record[3].get_asString());
+
+  columns.clear();
+  EXPECT_EQ(0u, columns.num_rows());
+  EXPECT_EQ(0u, columns.memory_usage());
+}
+
+TEST_F(TestColumnarResult, MatchesRecords)
+{
+  Populate(100);
+  const std::string sql = "SELECT * FROM movie ORDER BY idMovie";
+
+  ASSERT_TRUE(ds->query(sql));
+  std::vector<sql_record> expected;
+  for (int i = 0; i < ds->num_rows(); ++i)
+    expected.push_back(*ds->get_record(i));
+  ds->close();
+
+  ASSERT_TRUE(ds->query_columnar(sql));
+  ASSERT_EQ(static_cast<int>(expected.size()), ds->num_rows());
+  EXPECT_EQ(12, ds->fieldCount());
+  EXPECT_STREQ("c00", ds->fieldName(1));
+
+  // random access, backwards
+  for (int i = ds->num_rows() - 1; i >= 0; --i)
+  {
+    const sql_record& record = *ds->get_record(i);
+    ASSERT_EQ(expected[i].size(), record.size());
+    for (size_t col = 0; col < record.size(); ++col)
+    {
+      EXPECT_EQ(expected[i][col].get_isNull(), record[col].get_isNull());
+      EXPECT_EQ(expected[i][col].get_fType(), record[col].get_fType());
+      EXPECT_EQ(expected[i][col].get_asString(), record[col].get_asString());
+    }
+  }
+  EXPECT_EQ(nullptr, ds->get_record(ds->num_rows()));
+
+  // navigation and field access decode the current row
+  ds->first();
+  int rows = 0;
+  while (!ds->eof())
+  {
+    EXPECT_EQ(rows + 1, ds->fv("idMovie").get_asInt());
+    EXPECT_EQ("Movie " + std::to_string(rows), ds->fv("c00").get_asString());
+    EXPECT_EQ(rows % 7 == 0, ds->fv("playCount").get_isNull());
+    ds->next();
+    rows++;
+  }
+  EXPECT_EQ(100, rows);
+  ds->close();
+
+  // the next query is back to records
+  ASSERT_TRUE(ds->query("SELECT COUNT(*) FROM movie"));
+  EXPECT_EQ(100, ds->fv(0).get_asInt());
+  EXPECT_EQ(0u, ds->get_columnar_size());
+  ds->close();
+}
+
+TEST_F(TestColumnarResult, DISABLED_Benchmark)
+{
+  constexpr int rows = 30000;
+  Populate(rows);
+  const std::string sql = "SELECT * FROM movie";
+
+  const auto run = [&](bool columnar, size_t& heap)
+  {
+    const size_t before = HeapInUse();
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(columnar ? ds->query_columnar(sql) : ds->query(sql));
+    // read every row once, as a listing does
+    size_t length = 0;
+    for (int i = 0; i < ds->num_rows(); ++i)
+      length += ds->get_record(i)->at(1).get_asString().size();
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    heap = HeapInUse() - before;
+    EXPECT_EQ(rows, ds->num_rows());
+    EXPECT_GT(length, 0u);
+    ds->close();
+    return elapsed.count();
+  };
+
+  size_t recordHeap;
+  size_t columnarHeap;
+  const double records = run(false, recordHeap);
+  const double columnar = run(true, columnarHeap);
+
+  RecordProperty("RecordsMs", static_cast<int>(records));
+  RecordProperty("ColumnarMs", static_cast<int>(columnar));
+#if defined(__GLIBC__)
+  RecordProperty("RecordsHeapKB", static_cast<int>(recordHeap / 1024));
+  RecordProperty("ColumnarHeapKB", static_cast<int>(columnarHeap / 1024));
+  EXPECT_LT(columnarHeap, recordHeap);
+#endif
+}
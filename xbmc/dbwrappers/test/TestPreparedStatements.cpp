@@ -0,0 +1,150 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/Directory.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/URIUtils.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+namespace
+{
+class TestPreparedStatements : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    folder = URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"),
+                                       "TestPreparedStatements");
+    ASSERT_TRUE(XFILE::CDirectory::Create(folder));
+    db.setHostName(folder.c_str());
+    db.setDatabase("test");
+    ASSERT_EQ(DB_CONNECTION_OK, db.connect(true));
+    ds.reset(db.CreateDataset());
+    ds->exec("CREATE TABLE song_artist (idArtist INTEGER, idSong INTEGER, strArtist TEXT, "
+             "fRating REAL)");
+  }
+
+  void TearDown() override
+  {
+    ds.reset();
+    db.disconnect();
+    XFILE::CDirectory::RemoveRecursive(folder);
+  }
+
+  std::string folder;
+  SqliteDatabase db;
+  std::unique_ptr<Dataset> ds;
+};
+} // namespace
+
+TEST_F(TestPreparedStatements, ExecAndQuery)
+{
+  const std::string insert =
+      "INSERT INTO song_artist (idArtist, idSong, strArtist, fRating) VALUES (?, ?, ?, ?)";
+  EXPECT_EQ(0, ds->exec(insert, make_params(1, 10, "Guns N' Roses", 4.5)));
+  EXPECT_EQ(0, ds->exec(insert, make_params(2, 10, std::string("?"), 3.0)));
+  EXPECT_EQ(1u, db.cached_statements());
+
+  ASSERT_TRUE(ds->query("SELECT idArtist, strArtist, fRating FROM song_artist WHERE idSong = ? "
+                        "AND strArtist LIKE ?",
+                        make_params(10, "guns%")));
+  ASSERT_EQ(1, ds->num_rows());
+  EXPECT_EQ(1, ds->fv("idArtist").get_asInt());
+  EXPECT_EQ("Guns N' Roses", ds->fv("strArtist").get_asString());
+  EXPECT_DOUBLE_EQ(4.5, ds->fv("fRating").get_asDouble());
+  ds->close();
+
+  // values are bound, never parsed as sql
+  ASSERT_TRUE(ds->query("SELECT idArtist FROM song_artist WHERE strArtist = ?",
+                        make_params("?")));
+  ASSERT_EQ(1, ds->num_rows());
+  EXPECT_EQ(2, ds->fv(0).get_asInt());
+  ds->close();
+  EXPECT_EQ(3u, db.cached_statements());
+
+  // the statements are released with the connection
+  db.disconnect();
+  EXPECT_EQ(0u, db.cached_statements());
+}
+
+TEST_F(TestPreparedStatements, NullAndErrors)
+{
+  BindParams params = make_params(1, 1, "", 0.0);
+  params[2].set_isNull();
+  ds->exec("INSERT INTO song_artist (idArtist, idSong, strArtist, fRating) VALUES (?, ?, ?, ?)",
+           params);
+
+  ASSERT_TRUE(
+      ds->query("SELECT strArtist FROM song_artist WHERE strArtist IS NULL", BindParams()));
+  EXPECT_EQ(1, ds->num_rows());
+  ds->close();
+
+  EXPECT_THROW(ds->exec("INSERT INTO song_artist (idArtist) VALUES (?)", make_params(1, 2)),
+               DbErrors);
+  EXPECT_THROW(ds->exec("INSERT INTO missing (idArtist) VALUES (?)", make_params(1)), DbErrors);
+
+  // the failed statement was reset and can be used again
+  EXPECT_EQ(0, ds->exec("INSERT INTO song_artist (idArtist) VALUES (?)", make_params(1)));
+}
+
+TEST_F(TestPreparedStatements, InlineParams)
+{
+  BindParams params = make_params(7, "it's", 0.5, true, "");
+  params[4].set_isNull();
+  EXPECT_EQ("SELECT '?', 7, 'it''s', 0.5, 1, NULL",
+            db.inline_params("SELECT '?', ?, ?, ?, ?, ?", params));
+
+  // doubles keep all their digits, %f turned the second one into 0.000000
+  for (const double value : {1.0 / 3 + 1e-9, 1e-7, 123456789.123456789})
+    EXPECT_EQ(value, std::stod(db.inline_params("?", make_params(value))));
+}
+
+TEST_F(TestPreparedStatements, DISABLED_Benchmark)
+{
+  // the shape of a scan: the same few statements over and over inside a transaction
+  constexpr int rows = 20000;
+  const auto insert = [this](bool prepared)
+  {
+    ds->exec("DELETE FROM song_artist");
+    db.start_transaction();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rows; ++i)
+    {
+      const std::string artist = "Artist " + std::to_string(i % 500);
+      if (prepared)
+        ds->exec("INSERT INTO song_artist (idArtist, idSong, strArtist) VALUES (?, ?, ?)",
+                 make_params(i % 500, i, artist));
+      else
+        ds->exec(db.prepare("INSERT INTO song_artist (idArtist, idSong, strArtist) "
+                            "VALUES (%i, %i, '%s')",
+                            i % 500, i, artist.c_str()));
+    }
+    db.commit_transaction();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return rows / elapsed.count();
+  };
+
+  const double text = insert(false);
+  const double prepared = insert(true);
+
+  ASSERT_TRUE(ds->query("SELECT COUNT(*) FROM song_artist", BindParams()));
+  EXPECT_EQ(rows, ds->fv(0).get_asInt());
+  ds->close();
+
+  RecordProperty("TextRowsPerSecond", static_cast<int>(text));
+  RecordProperty("PreparedRowsPerSecond", static_cast<int>(prepared));
+  EXPECT_GT(prepared, text);
+}
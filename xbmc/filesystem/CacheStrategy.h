@@ -53,6 +53,12 @@ public:
   virtual int64_t CachedDataEndPos() = 0;
   virtual bool IsCachedPosition(int64_t iFilePosition) = 0;
 
+  /*!
+   \brief Limit how far the cache fills ahead of the read position
+   \param readAhead number of bytes, ignored by strategies with a fixed forward buffer
+   */
+  virtual void SetReadAhead(int64_t readAhead) {}
+
   virtual CCacheStrategy *CreateNew() = 0;
 
   CEvent m_space;
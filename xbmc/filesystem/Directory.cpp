@@ -24,6 +24,7 @@
 #include "messaging/ApplicationMessenger.h"
 #include "music/MusicFileItemClassify.h"
 #include "playlists/PlayListFileItemClassify.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/URIUtils.h"
@@ -36,6 +37,19 @@ using namespace std::chrono_literals;
 
 #define TIME_TO_BUSY_DIALOG 500
 
+namespace
+{
+bool IsDirectoryPersistenceEnabled()
+{
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  if (!settingsComponent)
+    return false;
+
+  const auto advancedSettings = settingsComponent->GetAdvancedSettings();
+  return advancedSettings && advancedSettings->m_persistDirectoryCache;
+}
+} // unnamed namespace
+
 class CGetDirectory
 {
 private:
@@ -172,8 +186,26 @@ bool CDirectory::GetDirectory(const CURL& url,
       return false;
 
     // check our cache for this path
-    if (g_directoryCache.GetDirectory(realURL, items,
-                                      (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE))
+    const bool readCache = (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE;
+    bool cached = g_directoryCache.GetDirectory(realURL, items, readCache);
+
+    // then, for callers accepting cached listings, the listing persisted by an earlier session
+    // as long as the source didn't change. fresh listings are persisted for any caller, but never
+    // the ones with explicit credentials
+    const bool persist = !cached && !(hints.flags & DIR_FLAG_BYPASS_CACHE) &&
+                         realURL.GetUserName().empty() && realURL.GetPassWord().empty() &&
+                         IsDirectoryPersistenceEnabled() && g_directoryCache.IsPersistable(realURL);
+    DirectoryStamp stamp;
+    if (persist)
+    {
+      stamp = CDirectoryCache::GetDirectoryStamp(URIUtils::AddCredentials(realURL));
+      if (readCache)
+        cached = g_directoryCache.GetPersistedDirectory(realURL, items, stamp);
+      if (cached)
+        g_directoryCache.SetDirectory(realURL, items, pDirectory->GetCacheType(url));
+    }
+
+    if (cached)
       items.SetURL(url);
     else
     {
@@ -251,7 +283,12 @@ bool CDirectory::GetDirectory(const CURL& url,
 
       // cache the directory, if necessary
       if (!(hints.flags & DIR_FLAG_BYPASS_CACHE))
-        g_directoryCache.SetDirectory(realURL, items, pDirectory->GetCacheType(url));
+      {
+        const CacheType cacheType = pDirectory->GetCacheType(url);
+        g_directoryCache.SetDirectory(realURL, items, cacheType);
+        if (persist && cacheType != CacheType::NEVER)
+          g_directoryCache.PersistDirectory(realURL, items, stamp);
+      }
     }
 
     // now filter for allowed files
@@ -9,20 +9,43 @@
 #include "DirectoryCache.h"
 
 #include "Directory.h"
+#include "File.h"
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "IDirectory.h"
 #include "URL.h"
+#include "XBDateTime.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
+#include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
 #include <climits>
 #include <mutex>
+#include <vector>
 
 // Maximum number of directories to keep in our cache
 #define MAX_CACHED_DIRS 50
 
+// Version of the persisted listings, to be bumped when the layout of a CFileItem archive changes
+#define PERSISTENT_VERSION 1
+
+// Maximum age of persisted listings that can't be validated against the source
+#define PERSISTENT_MAX_AGE std::chrono::hours(24)
+
+// Persisted listings not used for that long are removed
+#define PERSISTENT_PRUNE_AGE std::chrono::days(30)
+
+// Maximum size of all persisted listings, the least recently stored ones are removed first
+#define PERSISTENT_PRUNE_SIZE (64 * 1024 * 1024)
+
+// Number of listings stored between two prunes
+#define PERSISTENT_PRUNE_INTERVAL 200
+
 using namespace XFILE;
 
 namespace
@@ -44,6 +67,24 @@ std::string getDirKey(const CURL& url)
   return dirPath;
 }
 
+int64_t getNow()
+{
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+// the date a listing gives an entry, converted to local time as the directories do
+CDateTime getEntryTime(const struct __stat64& buffer)
+{
+  const int64_t timeDate = buffer.st_mtime == 0 ? buffer.st_ctime : buffer.st_mtime;
+  KODI::TIME::FileTime fileTime{};
+  KODI::TIME::FileTime localTime{};
+  KODI::TIME::TimeTToFileTime(timeDate, &fileTime);
+  KODI::TIME::FileTimeToLocalFileTime(&fileTime, &localTime);
+  return CDateTime(localTime);
+}
+
 } // Unnamed namespace
 
 CDirectoryCache::CDir::CDir(CacheType cacheType) : m_Items(std::make_unique<CFileItemList>())
@@ -64,10 +105,9 @@ void CDirectoryCache::CDir::SetLastAccess(unsigned int &accessCounter)
 CDirectoryCache::CDirectoryCache(void)
 {
   m_accessCounter = 0;
-#ifdef _DEBUG
   m_cacheHits = 0;
   m_cacheMisses = 0;
-#endif
+  m_persistentPath = "special://temp/dircache/";
 }
 
 CDirectoryCache::~CDirectoryCache(void) = default;
@@ -86,12 +126,11 @@ bool CDirectoryCache::GetDirectory(const CURL& url, CFileItemList& items, bool r
     {
       items.Copy(*dir.m_Items);
       dir.SetLastAccess(m_accessCounter);
-#ifdef _DEBUG
-      m_cacheHits += items.Size();
-#endif
+      m_cacheHits++;
       return true;
     }
   }
+  m_cacheMisses++;
   return false;
 }
 
@@ -127,7 +166,13 @@ void CDirectoryCache::SetDirectory(const CURL& url, const CFileItemList& items,
 void CDirectoryCache::ClearFile(const CURL& url)
 {
   const std::string dirPath = getDirKey(url);
-  m_cache.erase(dirPath);
+  {
+    std::unique_lock lock(m_cs);
+    m_cache.erase(dirPath);
+  }
+
+  if (IsPersistable(url))
+    RemovePersistedDirectory(dirPath);
 }
 
 void CDirectoryCache::ClearDirectory(const CURL& url)
@@ -136,6 +181,10 @@ void CDirectoryCache::ClearDirectory(const CURL& url)
 
   const std::string storedPath = getKey(url);
   m_cache.erase(storedPath);
+
+  lock.unlock();
+  if (IsPersistable(url))
+    RemovePersistedDirectory(storedPath);
 }
 
 void CDirectoryCache::ClearSubPaths(const CURL& url)
@@ -176,14 +225,10 @@ bool CDirectoryCache::FileExists(const CURL& url, bool& foundInCache)
     foundInCache = true;
     CDir& dir = i->second;
     dir.SetLastAccess(m_accessCounter);
-#ifdef _DEBUG
     m_cacheHits++;
-#endif
     return (URIUtils::PathEquals(filePath, dirPath) || dir.m_Items->Contains(url.Get()));
   }
-#ifdef _DEBUG
   m_cacheMisses++;
-#endif
   return false;
 }
 
@@ -231,12 +276,265 @@ void CDirectoryCache::CheckIfFull()
     m_cache.erase(lastAccessed);
 }
 
-#ifdef _DEBUG
+void CDirectoryCache::SetPersistentPath(const std::string& path)
+{
+  std::unique_lock lock(m_cs);
+  m_persistentPath = path;
+  if (!m_persistentPath.empty())
+    URIUtils::AddSlashAtEnd(m_persistentPath);
+}
+
+bool CDirectoryCache::IsPersistable(const CURL& url) const
+{
+  {
+    std::unique_lock lock(m_cs);
+    if (m_persistentPath.empty())
+      return false;
+  }
+
+  // local listings are as quick to get as they are to load
+  return url.IsProtocol("smb") || url.IsProtocol("nfs") || url.IsProtocol("upnp");
+}
+
+DirectoryStamp CDirectoryCache::GetDirectoryStamp(const CURL& url)
+{
+  DirectoryStamp stamp;
+
+  // media servers have no notion of a directory modification time
+  if (url.IsProtocol("upnp"))
+    return stamp;
+
+  struct __stat64 buffer = {};
+  if (CFile::Stat(url, &buffer) == 0)
+  {
+    stamp.mtime = static_cast<int64_t>(buffer.st_mtime);
+    stamp.size = static_cast<int64_t>(buffer.st_size);
+  }
+  return stamp;
+}
+
+std::string CDirectoryCache::GetPersistentFile(const std::string& key) const
+{
+  std::unique_lock lock(m_cs);
+  if (m_persistentPath.empty())
+    return {};
+  return StringUtils::Format("{}{:08x}.dc", m_persistentPath, Crc32::Compute(key));
+}
+
+bool CDirectoryCache::IsEntryCurrent(const CFileItem& item)
+{
+  if (item.IsParentFolder())
+    return true;
+
+  struct __stat64 buffer = {};
+  if (CFile::Stat(URIUtils::AddCredentials(item.GetURL()), &buffer) != 0)
+    return false;
+
+  if (item.IsFolder())
+    return !item.HasProperty(DIR_PROPERTY_STAT_MTIME) ||
+           item.GetProperty(DIR_PROPERTY_STAT_MTIME).asInteger() ==
+               static_cast<int64_t>(buffer.st_mtime);
+
+  return item.GetSize() == static_cast<int64_t>(buffer.st_size) &&
+         (!item.GetDateTime().IsValid() || item.GetDateTime() == getEntryTime(buffer));
+}
+
+void CDirectoryCache::RemovePersistedDirectory(const std::string& key) const
+{
+  // m_cs is only held to get the file name, never while touching the disk
+  const std::string file = GetPersistentFile(key);
+  if (!file.empty() && CFile::Exists(file))
+    CFile::Delete(file);
+}
+
+bool CDirectoryCache::GetPersistedDirectory(const CURL& url,
+                                            CFileItemList& items,
+                                            const DirectoryStamp& stamp)
+{
+  const std::string storedPath = getKey(url);
+  const std::string file = GetPersistentFile(storedPath);
+
+  bool loaded = false;
+  bool stale = false;
+  CFile persisted;
+  if (!file.empty() && persisted.Open(file))
+  {
+    try
+    {
+      CArchive ar(&persisted, CArchive::load);
+      int version = 0;
+      std::string key;
+      DirectoryStamp persistedStamp;
+      int64_t savedAt = 0;
+      ar >> version;
+      if (version == PERSISTENT_VERSION)
+      {
+        ar >> key;
+        ar >> persistedStamp.mtime;
+        ar >> persistedStamp.size;
+        ar >> savedAt;
+      }
+
+      // the crc of the key may collide
+      if (version != PERSISTENT_VERSION || key != storedPath)
+        stale = true;
+      else if (persistedStamp.IsValid() || stamp.IsValid())
+        stale = persistedStamp != stamp;
+      else
+        stale = getNow() - savedAt > std::chrono::seconds(PERSISTENT_MAX_AGE).count();
+
+      if (!stale)
+      {
+        ar >> items;
+        loaded = true;
+      }
+      ar.Close();
+    }
+    catch (const std::out_of_range&)
+    {
+      CLog::Log(LOGERROR, "{} - Corrupt directory cache file {} for {}", __FUNCTION__, file,
+                url.GetRedacted());
+      items.Clear();
+      stale = true;
+    }
+    persisted.Close();
+  }
+
+  std::unique_lock lock(m_cs);
+  if (loaded)
+    m_persistentHits++;
+  else if (stale)
+    m_persistentStale++;
+  else
+    m_persistentMisses++;
+
+  return loaded;
+}
+
+void CDirectoryCache::PersistDirectory(const CURL& url,
+                                       const CFileItemList& items,
+                                       const DirectoryStamp& stamp)
+{
+  const std::string storedPath = getKey(url);
+  const std::string file = GetPersistentFile(storedPath);
+  if (file.empty())
+    return;
+
+  // write to a temporary file first, so concurrent readers never see a partial listing
+  const std::string temp = StringUtils::Format("{}.{}.tmp", file, fmt::ptr(&items));
+  CFile persisted;
+  if (!persisted.OpenForWrite(temp, true))
+  {
+    CLog::Log(LOGDEBUG, "{} - Unable to create {}", __FUNCTION__, temp);
+    return;
+  }
+
+  // archiving needs write access to the list for its lock, the items aren't modified
+  CFileItemList& list = const_cast<CFileItemList&>(items);
+  {
+    CArchive ar(&persisted, CArchive::store);
+    ar << PERSISTENT_VERSION;
+    ar << storedPath;
+    ar << stamp.mtime;
+    ar << stamp.size;
+    ar << getNow();
+    ar << list;
+    ar.Close();
+  }
+  persisted.Close();
+
+  if (!CFile::Rename(temp, file))
+  {
+    CFile::Delete(temp);
+    CLog::Log(LOGDEBUG, "{} - Unable to store {}", __FUNCTION__, file);
+    return;
+  }
+
+  bool prune = false;
+  {
+    std::unique_lock lock(m_cs);
+    if (++m_persistedSincePrune >= PERSISTENT_PRUNE_INTERVAL)
+      prune = true;
+  }
+  if (prune)
+    PrunePersistedDirectories();
+}
+
+void CDirectoryCache::PrunePersistedDirectories()
+{
+  PrunePersistedDirectories(PERSISTENT_PRUNE_AGE, PERSISTENT_PRUNE_SIZE);
+}
+
+void CDirectoryCache::PrunePersistedDirectories(std::chrono::seconds maxAge, int64_t maxSize)
+{
+  std::string path;
+  {
+    std::unique_lock lock(m_cs);
+    m_persistedSincePrune = 0;
+    path = m_persistentPath;
+  }
+  if (path.empty())
+    return;
+
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(path, items, ".dc|.tmp",
+                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_BYPASS_CACHE))
+    return;
+
+  // the oldest first, reading a listing doesn't touch it so this is the order they were stored in
+  std::vector<std::shared_ptr<CFileItem>> files;
+  for (const auto& item : items)
+  {
+    if (!item->IsFolder())
+      files.push_back(item);
+  }
+  std::ranges::sort(files, [](const auto& a, const auto& b)
+                    { return a->GetDateTime() < b->GetDateTime(); });
+
+  int64_t totalSize = 0;
+  for (const auto& file : files)
+    totalSize += file->GetSize();
+
+  const CDateTime now = CDateTime::GetCurrentDateTime();
+  unsigned int removed = 0;
+  for (const auto& file : files)
+  {
+    const bool expired = (now - file->GetDateTime()).GetSecondsTotal() > maxAge.count();
+    if (!expired && totalSize <= maxSize)
+      break;
+
+    if (CFile::Delete(file->GetPath()))
+    {
+      totalSize -= file->GetSize();
+      removed++;
+    }
+  }
+
+  if (removed > 0)
+    CLog::Log(LOGDEBUG, "{} - Removed {} persisted listings, {} bytes left", __FUNCTION__,
+              removed, totalSize);
+}
+
+DirectoryCacheStats CDirectoryCache::GetStats() const
+{
+  std::unique_lock lock(m_cs);
+  DirectoryCacheStats stats;
+  stats.hits = m_cacheHits;
+  stats.misses = m_cacheMisses;
+  stats.persistentHits = m_persistentHits;
+  stats.persistentStale = m_persistentStale;
+  stats.persistentMisses = m_persistentMisses;
+  stats.cachedDirs = static_cast<unsigned int>(m_cache.size());
+  return stats;
+}
+
 void CDirectoryCache::PrintStats() const
 {
   std::unique_lock lock(m_cs);
   CLog::Log(LOGDEBUG, "{} - total of {} cache hits, and {} cache misses", __FUNCTION__, m_cacheHits,
             m_cacheMisses);
+  CLog::Log(LOGDEBUG, "{} - {} listings loaded from disk, {} stale and {} missing", __FUNCTION__,
+            m_persistentHits, m_persistentStale, m_persistentMisses);
   // run through and find the oldest and the number of items cached
   unsigned int oldest = UINT_MAX;
   unsigned int numItems = 0;
@@ -251,4 +549,3 @@ void CDirectoryCache::PrintStats() const
   CLog::Log(LOGDEBUG, "{} - {} folders cached, with {} items total.  Oldest is {}, current is {}",
             __FUNCTION__, numDirs, numItems, oldest, m_accessCounter);
 }
-#endif
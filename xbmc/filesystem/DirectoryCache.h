@@ -11,15 +11,41 @@
 #include "IDirectory.h"
 #include "threads/CriticalSection.h"
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <set>
+#include <string>
 #include <unordered_map>
 
+class CFileItem;
 class CURL;
 
 namespace XFILE
 {
+  /*!
+   * \brief What identifies a version of a directory on the source, used to validate persisted
+   * listings. A zero modification time means the protocol can't tell.
+   */
+  struct DirectoryStamp
+  {
+    int64_t mtime = 0;
+    int64_t size = 0;
+
+    bool IsValid() const { return mtime != 0; }
+    bool operator==(const DirectoryStamp& other) const = default;
+  };
+
+  struct DirectoryCacheStats
+  {
+    unsigned int hits = 0; //!< lookups served from memory
+    unsigned int misses = 0; //!< lookups not in memory
+    unsigned int persistentHits = 0; //!< listings loaded from disk
+    unsigned int persistentStale = 0; //!< listings on disk that no longer matched the source
+    unsigned int persistentMisses = 0; //!< listings not on disk
+    unsigned int cachedDirs = 0; //!< directories held in memory
+  };
+
   class CDirectoryCache
   {
     class CDir
@@ -52,13 +78,69 @@ namespace XFILE
     void Clear();
     void AddFile(const CURL& url);
     bool FileExists(const CURL& url, bool& foundInCache);
-#ifdef _DEBUG
+
+    /*!
+     * \brief Set the folder persisted listings are kept in, an empty path disables persistence.
+     */
+    void SetPersistentPath(const std::string& path);
+
+    /*!
+     * \brief Whether listings of the given location are worth keeping on disk, i.e. the ones of
+     * network shares and media servers.
+     */
+    bool IsPersistable(const CURL& url) const;
+
+    /*!
+     * \brief Get the stamp of a directory on the source, invalid if the protocol can't provide it.
+     */
+    static DirectoryStamp GetDirectoryStamp(const CURL& url);
+
+    /*!
+     * \brief Load a listing from disk, as stored by PersistDirectory().
+     *
+     * A listing is only returned if its stamp matches the given one. As the modification time of
+     * a directory doesn't change when a file in it is rewritten, the entries themselves aren't
+     * checked, see IsEntryCurrent(). Listings that can't be validated are only returned if they
+     * are younger than a day.
+     * \param url the directory
+     * \param items [out] the listing
+     * \param stamp the current stamp of the directory on the source
+     * \return true if the listing was loaded, false otherwise
+     */
+    bool GetPersistedDirectory(const CURL& url, CFileItemList& items, const DirectoryStamp& stamp);
+
+    /*!
+     * \brief Whether an entry of a persisted listing still has the size and modification time
+     * it was listed with, for callers that need to know before using it. Stats the entry.
+     */
+    static bool IsEntryCurrent(const CFileItem& item);
+
+    /*!
+     * \brief Store a listing on disk, together with the stamp of the directory it was listed with.
+     */
+    void PersistDirectory(const CURL& url, const CFileItemList& items, const DirectoryStamp& stamp);
+
+    /*!
+     * \brief Remove the persisted listings stored longer than a month ago, then the oldest ones
+     * until they take no more than 64 MiB. Also done every 200 stored listings.
+     */
+    void PrunePersistedDirectories();
+
+    /*!
+     * \brief Remove the persisted listings older than maxAge, then the oldest ones until they
+     * take no more than maxSize bytes.
+     */
+    void PrunePersistedDirectories(std::chrono::seconds maxAge, int64_t maxSize);
+
+    DirectoryCacheStats GetStats() const;
     void PrintStats() const;
-#endif
+
   private:
     void InitCache(const std::set<std::string>& dirs);
     void ClearCache(std::set<std::string>& dirs);
     void CheckIfFull();
+    std::string GetPersistentFile(const std::string& key) const;
+    void RemovePersistedDirectory(const std::string& key) const;
 
     struct StringHash
     {
@@ -76,10 +158,14 @@ namespace XFILE
 
     unsigned int m_accessCounter;
 
-#ifdef _DEBUG
     unsigned int m_cacheHits;
     unsigned int m_cacheMisses;
-#endif
+    unsigned int m_persistentHits = 0;
+    unsigned int m_persistentStale = 0;
+    unsigned int m_persistentMisses = 0;
+    unsigned int m_persistedSincePrune = 0;
+
+    std::string m_persistentPath;
   };
 }
 extern XFILE::CDirectoryCache g_directoryCache;
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DirectoryPrefetcher.h"
+
+#include "Directory.h"
+#include "File.h"
+#include "FileItemList.h"
+#include "URL.h"
+#include "threads/Thread.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+using namespace XFILE;
+
+namespace
+{
+class CFetchWorker : public CThread
+{
+public:
+  explicit CFetchWorker(std::function<void()> work)
+    : CThread("DirectoryPrefetcher"), m_work(std::move(work))
+  {
+  }
+
+protected:
+  void Process() override { m_work(); }
+
+private:
+  std::function<void()> m_work;
+};
+} // unnamed namespace
+
+CDirectoryPrefetcher::CDirectoryPrefetcher(std::string mask, int flags, unsigned int maxPerHost)
+  : m_mask(std::move(mask)), m_flags(flags), m_maxPerHost(std::max(1U, maxPerHost))
+{
+}
+
+int64_t CDirectoryPrefetcher::GetTime(const std::string& path)
+{
+  struct __stat64 buffer;
+  if (CFile::Stat(path, &buffer) != 0)
+    return 0;
+
+  return buffer.st_mtime ? buffer.st_mtime : buffer.st_ctime;
+}
+
+bool CDirectoryPrefetcher::GetDirectory(const std::string& path, CFileItemList& items)
+{
+  return CDirectory::GetDirectory(path, items, m_mask, m_flags);
+}
+
+void CDirectoryPrefetcher::FetchOne(const Request& request,
+                                    const ListingPredicate& needsListing,
+                                    Result& result)
+{
+  result.time = request.time ? request.time : GetTime(request.path);
+
+  if (needsListing && !needsListing(request.path, result.time))
+    return;
+
+  result.items = std::make_unique<CFileItemList>();
+  result.listed = GetDirectory(request.path, *result.items);
+  if (!result.listed)
+    result.items.reset();
+}
+
+std::vector<CDirectoryPrefetcher::Result> CDirectoryPrefetcher::Fetch(
+    const std::vector<Request>& requests,
+    const ListingPredicate& needsListing,
+    const std::atomic<bool>& stop)
+{
+  std::vector<Result> results(requests.size());
+  for (size_t i = 0; i < requests.size(); ++i)
+    results[i].path = requests[i].path;
+
+  // each host gets its own queue, served by up to m_maxPerHost workers
+  struct Queue
+  {
+    std::vector<size_t> requests;
+    std::atomic<size_t> next{0};
+  };
+  std::map<std::string, Queue> queues;
+  for (size_t i = 0; i < requests.size(); ++i)
+  {
+    const CURL url(requests[i].path);
+    queues[url.GetProtocol() + "://" + url.GetHostName()].requests.emplace_back(i);
+  }
+
+  const auto work = [&](Queue& queue)
+  {
+    for (size_t next = queue.next++; next < queue.requests.size() && !stop; next = queue.next++)
+    {
+      const size_t index = queue.requests[next];
+      FetchOne(requests[index], needsListing, results[index]);
+    }
+  };
+
+  std::vector<std::unique_ptr<CFetchWorker>> workers;
+  for (auto& [host, queue] : queues)
+  {
+    const size_t count = std::min<size_t>(m_maxPerHost, queue.requests.size());
+    for (size_t i = 0; i < count; ++i)
+    {
+      workers.emplace_back(std::make_unique<CFetchWorker>([&work, &queue] { work(queue); }));
+      workers.back()->Create();
+    }
+  }
+
+  // waits for the workers, they return once their queue is served or stop is set
+  for (const auto& worker : workers)
+    worker->StopThread();
+
+  return results;
+}
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class CFileItemList;
+
+namespace XFILE
+{
+
+/*!
+ * \brief Gets the modification times and listings of a set of directories in parallel.
+ *
+ * Meant for walks over large trees, e.g. by the library scanners, where most of the time is spent
+ * waiting for the round trips to a share. Directories are grouped by host and at most a given
+ * number of requests are in flight per host, so a single NAS isn't flooded. The results are
+ * returned in the order of the requests, so callers processing them stay deterministic.
+ */
+class CDirectoryPrefetcher
+{
+public:
+  struct Request
+  {
+    std::string path;
+    int64_t time = 0; //!< modification time of the directory if already known, else it's stat'ed
+  };
+
+  struct Result
+  {
+    std::string path;
+    int64_t time = 0; //!< modification, or change, time of the directory. 0 if unknown
+    bool listed = false; //!< whether the directory was listed successfully
+    std::unique_ptr<CFileItemList> items; //!< the listing, if listed
+  };
+
+  /*!
+   * \brief Decides, once the time of a directory is known, whether it needs to be listed.
+   * Called from the worker threads.
+   */
+  using ListingPredicate = std::function<bool(const std::string& path, int64_t time)>;
+
+  /*!
+   * \param mask the mask directories are listed with, see CDirectory::GetDirectory
+   * \param flags the flags directories are listed with, see CDirectory::GetDirectory
+   * \param maxPerHost maximum number of concurrent requests per host
+   */
+  CDirectoryPrefetcher(std::string mask, int flags, unsigned int maxPerHost);
+  virtual ~CDirectoryPrefetcher() = default;
+
+  /*!
+   * \brief Get the times, and listings if needed, of the given directories.
+   * \param requests the directories
+   * \param needsListing whether a directory is to be listed, all are if empty
+   * \param stop set to abort, directories not done yet are returned without time and listing
+   * \return one result per request, in the order of the requests
+   */
+  std::vector<Result> Fetch(const std::vector<Request>& requests,
+                            const ListingPredicate& needsListing,
+                            const std::atomic<bool>& stop);
+
+protected:
+  virtual int64_t GetTime(const std::string& path);
+  virtual bool GetDirectory(const std::string& path, CFileItemList& items);
+
+private:
+  void FetchOne(const Request& request, const ListingPredicate& needsListing, Result& result);
+
+  const std::string m_mask;
+  const int m_flags;
+  const unsigned int m_maxPerHost;
+};
+
+} // namespace XFILE
@@ -264,6 +264,7 @@ bool CFile::Open(const CURL& file, const unsigned int flags)
   try
   {
     bool bPathInCache;
+    bool mapInsteadOfCache = false;
 
     CURL url(URIUtils::SubstitutePath(file));
     CURL url2(url);
@@ -311,6 +312,14 @@ bool CFile::Open(const CURL& file, const unsigned int flags)
         }
       }
 
+      // a mapped local file is read from the page cache, FileCache would only add another copy.
+      // it is still cached if it can't be mapped after all, see below
+      if ((m_flags & READ_CACHED) && (m_flags & READ_MEMORY_MAP) && URIUtils::IsHD(pathToUrl))
+      {
+        m_flags &= ~READ_CACHED;
+        mapInsteadOfCache = true;
+      }
+
       if (m_flags & READ_CACHED)
       {
         m_pFile = std::make_unique<CFileCache>(m_flags);
@@ -365,6 +374,24 @@ bool CFile::Open(const CURL& file, const unsigned int flags)
       return false;
     }
 
+    if (m_flags & READ_MEMORY_MAP)
+    {
+      if (m_pFile->IoControl(IOControl::MEMORY_MAP, nullptr) == 0)
+        m_flags |= READ_NO_BUFFER; // no need to buffer reads from memory
+      else
+      {
+        m_flags &= ~READ_MEMORY_MAP;
+        if (mapInsteadOfCache)
+        {
+          // e.g. a network or FUSE mount, read it through FileCache as it would have been
+          m_pFile->Close();
+          m_flags |= READ_CACHED;
+          m_pFile = std::make_unique<CFileCache>(m_flags);
+          return m_pFile->Open(url);
+        }
+      }
+    }
+
     if (ShouldUseStreamBuffer(url))
     {
       m_pBuffer = std::make_unique<CFileStreamBuffer>(0);
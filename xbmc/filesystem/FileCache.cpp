@@ -9,8 +9,10 @@
 #include "FileCache.h"
 
 #include "CircularCache.h"
+#include "SegmentedCache.h"
 #include "ServiceBroker.h"
 #include "URL.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
@@ -135,6 +137,14 @@ bool CFileCache::Open(const CURL& url)
 
   m_fileSize = m_source.GetLength();
 
+  // Seekable audio/video sources can keep the ranges around previous read positions in memory, so
+  // skipping between chapters or the interleaved reads of READ_MULTI_STREAM are served from there
+  // (opt-in through <segmentedfilecache> until it has had more testing)
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  const bool segmented = cacheMemSize != 0 && (m_flags & READ_AUDIO_VIDEO) &&
+                         m_seekPossible > 0 && advancedSettings &&
+                         advancedSettings->m_segmentedFileCache;
+
   if (!m_pCache)
   {
     if (cacheMemSize == 0)
@@ -162,7 +172,7 @@ bool CFileCache::Open(const CURL& url)
         cacheSize = cacheMemSize;
 
         // NOTE: READ_MULTI_STREAM is only used with READ_AUDIO_VIDEO
-        if (m_flags & READ_MULTI_STREAM)
+        if ((m_flags & READ_MULTI_STREAM) && !segmented)
         {
           // READ_MULTI_STREAM requires double buffering, so use half the amount of memory for each buffer
           cacheSize /= 2;
@@ -173,7 +183,10 @@ bool CFileCache::Open(const CURL& url)
           cacheSize = m_chunkSize * 2;
       }
 
-      if (m_flags & READ_MULTI_STREAM)
+      if (segmented)
+        CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using segmented memory cache sized {} bytes",
+                  __FUNCTION__, m_sourcePath, cacheSize);
+      else if (m_flags & READ_MULTI_STREAM)
         CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using double memory cache each sized {} bytes",
                   __FUNCTION__, m_sourcePath, cacheSize);
       else
@@ -183,12 +196,15 @@ bool CFileCache::Open(const CURL& url)
       const size_t back = cacheSize / 4;
       const size_t front = cacheSize - back;
 
-      m_pCache = std::make_unique<CCircularCache>(front, back);
+      if (segmented)
+        m_pCache = std::make_unique<CSegmentedCache>(front, back);
+      else
+        m_pCache = std::make_unique<CCircularCache>(front, back);
       m_forwardCacheSize = front;
       m_maxForward = m_forwardCacheSize;
     }
 
-    if (m_flags & READ_MULTI_STREAM)
+    if ((m_flags & READ_MULTI_STREAM) && !segmented)
     {
       // If READ_MULTI_STREAM flag is set: Double buffering is required
       m_pCache = std::make_unique<CDoubleCache>(m_pCache.release());
@@ -208,6 +224,7 @@ bool CFileCache::Open(const CURL& url)
   m_writeRate = 1024 * 1024;
   m_writeRateActual = 0;
   m_writeRateLowSpeed = 0;
+  m_sourceRate = 0;
   m_bFilling = true;
   m_seekEvent.Reset();
   m_seekEnded.Reset();
@@ -433,7 +450,9 @@ void CFileCache::Process()
     if (m_bFilling && m_forwardCacheSize != 0)
     {
       const int64_t forward = m_pCache->WaitForData(0, 0ms);
-      if (forward + m_chunkSize >= m_forwardCacheSize)
+      // a limited read-ahead may stop the cache short of its forward size
+      if (forward + m_chunkSize >= m_forwardCacheSize ||
+          m_pCache->GetMaxWriteSize(m_chunkSize) < m_chunkSize)
       {
         if (m_writeRateActual < m_writeRate)
           m_writeRateLowSpeed = m_writeRateActual;
@@ -441,6 +460,19 @@ void CFileCache::Process()
         m_bFilling = false;
       }
     }
+
+    // While filling, reads aren't throttled, so the average is what the source can deliver
+    if (m_bFilling && m_writeRateActual > 0)
+      m_sourceRate = m_writeRateActual;
+
+    // The slower the source compared to the stream, the further ahead we read to ride out
+    // stalls. Strategies that support it keep the remaining memory for previously read ranges.
+    if (m_sourceRate > 0 && m_writeRate > 0)
+    {
+      const double headroom = static_cast<double>(m_sourceRate) / m_writeRate;
+      const double seconds = std::clamp(20.0 / headroom, 5.0, 60.0);
+      m_pCache->SetReadAhead(static_cast<int64_t>(seconds * m_writeRate));
+    }
   }
 }
 
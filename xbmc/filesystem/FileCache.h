@@ -72,6 +72,7 @@ namespace XFILE
     uint32_t m_writeRate = 0;
     uint32_t m_writeRateActual = 0;
     uint32_t m_writeRateLowSpeed = 0;
+    uint32_t m_sourceRate = 0;
     int64_t m_forwardCacheSize = 0;
     int64_t m_maxForward = 0;
     bool m_bFilling = false;
@@ -42,6 +42,10 @@ static const unsigned int READ_REOPEN = 0x100;
 /* indicate that caller want open a file without intermediate buffer regardless to file type */
 static const unsigned int READ_NO_BUFFER = 0x200;
 
+// Indicate that the caller wants local files to be memory mapped (if on a local disk file system).
+// Reads are served straight from the page cache, which replaces FileCache and StreamBuffer for them.
+static const unsigned int READ_MEMORY_MAP = 0x400;
+
 struct SNativeIoControl
 {
   unsigned long int request;
@@ -74,6 +78,7 @@ enum class IOControl
   CACHE_SETRATE = 4, /**< unsigned int with speed limit for caching in bytes per second */
   SET_CACHE = 8, /**< CFileCache */
   SET_RETRY = 16, /**< Enable/disable retry within the protocol handler (if supported) */
+  MEMORY_MAP = 32, /**< map the file into memory for reading, return 0 on success */
 };
 
 enum class CURLOptionType
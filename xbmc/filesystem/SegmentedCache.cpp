@@ -0,0 +1,414 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SegmentedCache.h"
+
+#include "threads/SystemClock.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr size_t MAX_BLOCK_SIZE = 256 * 1024;
+} // namespace
+
+CSegmentedCache::CSegmentedCache(size_t front, size_t back)
+  : m_front(front),
+    m_back(back),
+    m_blockSize(std::max<size_t>(1, std::min(MAX_BLOCK_SIZE, (front + back) / 8))),
+    m_readAhead(front)
+{
+}
+
+CSegmentedCache::~CSegmentedCache()
+{
+  Close();
+}
+
+int CSegmentedCache::Open()
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t blockCount = (m_front + m_back) / m_blockSize;
+  m_buf.reset(new (std::nothrow) uint8_t[blockCount * m_blockSize]);
+  if (!m_buf)
+    return CACHE_RC_ERROR;
+
+  m_freeBlocks.clear();
+  m_freeBlocks.reserve(blockCount);
+  for (size_t i = blockCount; i > 0; --i)
+    m_freeBlocks.emplace_back(m_buf.get() + (i - 1) * m_blockSize);
+
+  m_segments.assign(1, Segment());
+  m_active = 0;
+  m_cur = 0;
+  return CACHE_RC_OK;
+}
+
+void CSegmentedCache::Close()
+{
+  std::unique_lock lock(m_sync);
+  m_segments.clear();
+  m_freeBlocks.clear();
+  m_buf.reset();
+}
+
+size_t CSegmentedCache::GetDroppableHistory() const
+{
+  // whole blocks of the active segment that are further behind the read position than the
+  // guaranteed back buffer
+  const Segment& active = m_segments[m_active];
+  const int64_t behind = m_cur - static_cast<int64_t>(m_back) - active.base;
+  if (behind <= 0)
+    return 0;
+  return std::min(static_cast<size_t>(behind) / m_blockSize, active.blocks.size());
+}
+
+size_t CSegmentedCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  std::unique_lock lock(m_sync);
+  if (m_segments.empty())
+    return 0;
+
+  const Segment& active = m_segments[m_active];
+  const int64_t forward = active.end - m_cur;
+  if (forward >= m_readAhead)
+    return 0;
+
+  size_t blocks = m_freeBlocks.size() + GetDroppableHistory();
+  for (size_t i = 0; i < m_segments.size(); ++i)
+  {
+    if (i != m_active)
+      blocks += m_segments[i].blocks.size();
+  }
+
+  const size_t tail = active.blocks.size() * m_blockSize - (active.end - active.base);
+  const size_t limit = std::min<size_t>(tail + blocks * m_blockSize, m_readAhead - forward);
+
+  return std::min(iRequestSize, limit);
+}
+
+void CSegmentedCache::DropTailBlock(Segment& segment)
+{
+  m_freeBlocks.emplace_back(segment.blocks.back());
+  segment.blocks.pop_back();
+  segment.end = std::min<int64_t>(segment.end, segment.base + segment.blocks.size() * m_blockSize);
+  segment.start = std::min(segment.start, segment.end);
+}
+
+void CSegmentedCache::RemoveSegment(size_t index)
+{
+  for (uint8_t* block : m_segments[index].blocks)
+    m_freeBlocks.emplace_back(block);
+
+  m_segments.erase(m_segments.begin() + index);
+  if (m_active > index)
+    m_active--;
+}
+
+bool CSegmentedCache::AppendBlock()
+{
+  Segment& active = Active();
+
+  if (m_freeBlocks.empty() && GetDroppableHistory() > 0)
+  {
+    m_freeBlocks.emplace_back(active.blocks.front());
+    active.blocks.pop_front();
+    active.base += m_blockSize;
+    active.start = std::max(active.start, active.base);
+  }
+
+  if (m_freeBlocks.empty())
+  {
+    // take the tail of the least recently used segment, seeks usually land at the start of a range
+    size_t lru = m_segments.size();
+    for (size_t i = 0; i < m_segments.size(); ++i)
+    {
+      if (i != m_active && !m_segments[i].blocks.empty() &&
+          (lru == m_segments.size() || m_segments[i].lastUsed < m_segments[lru].lastUsed))
+        lru = i;
+    }
+    if (lru == m_segments.size())
+      return false;
+
+    DropTailBlock(m_segments[lru]);
+    if (m_segments[lru].blocks.empty())
+      RemoveSegment(lru);
+  }
+
+  Active().blocks.emplace_back(m_freeBlocks.back());
+  m_freeBlocks.pop_back();
+  return true;
+}
+
+void CSegmentedCache::RemoveCoveredSegments()
+{
+  const Segment& active = Active();
+  for (size_t i = m_segments.size(); i > 0; --i)
+  {
+    const Segment& segment = m_segments[i - 1];
+    if (i - 1 != m_active && segment.start >= active.start && segment.end <= active.end)
+      RemoveSegment(i - 1);
+  }
+}
+
+/**
+ * Writes at the end of the active segment, as much as the read-ahead limit and
+ * the available blocks allow.
+ */
+int CSegmentedCache::WriteToCache(const char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+  if (m_segments.empty())
+    return 0;
+
+  len = std::min<size_t>(len, std::max<int64_t>(0, m_readAhead - (Active().end - m_cur)));
+
+  size_t written = 0;
+  bool newBlocks = false;
+  while (written < len)
+  {
+    size_t offset = Active().end - Active().base;
+    if (offset == Active().blocks.size() * m_blockSize)
+    {
+      if (!AppendBlock())
+        break;
+      newBlocks = true;
+      offset = Active().end - Active().base;
+    }
+
+    Segment& active = Active();
+    const size_t inBlock = offset % m_blockSize;
+    const size_t size = std::min(len - written, m_blockSize - inBlock);
+    memcpy(active.blocks[offset / m_blockSize] + inBlock, buf + written, size);
+    active.end += size;
+    written += size;
+  }
+
+  if (newBlocks)
+    RemoveCoveredSegments();
+
+  if (written > 0)
+    m_written.Set();
+
+  return static_cast<int>(written);
+}
+
+/**
+ * Reads from the active segment, up to the end of the current block. So
+ * multiple calls may be needed to get all available data.
+ */
+int CSegmentedCache::ReadFromCache(char* buf, size_t len)
+{
+  std::unique_lock lock(m_sync);
+  if (m_segments.empty())
+    return 0;
+
+  Segment& active = Active();
+  if (m_cur >= active.end)
+  {
+    if (IsEndOfInput())
+      return 0;
+    else
+      return CACHE_RC_WOULD_BLOCK;
+  }
+
+  const size_t offset = m_cur - active.base;
+  const size_t inBlock = offset % m_blockSize;
+  len = std::min({len, m_blockSize - inBlock, static_cast<size_t>(active.end - m_cur)});
+  if (len == 0)
+    return 0;
+
+  memcpy(buf, active.blocks[offset / m_blockSize] + inBlock, len);
+  m_cur += len;
+  active.lastUsed = ++m_useCounter;
+
+  m_space.Set();
+
+  return static_cast<int>(len);
+}
+
+int64_t CSegmentedCache::WaitForData(uint32_t minimum, std::chrono::milliseconds timeout)
+{
+  std::unique_lock lock(m_sync);
+  if (m_segments.empty())
+    return 0;
+
+  int64_t avail = Active().end - m_cur;
+  if (timeout == 0ms || IsEndOfInput())
+    return avail;
+
+  minimum = static_cast<uint32_t>(std::min<int64_t>(minimum, m_readAhead));
+
+  XbmcThreads::EndTime<> endtime{timeout};
+  while (!IsEndOfInput() && avail < minimum && !endtime.IsTimePast())
+  {
+    lock.unlock();
+    m_written.Wait(50ms); // may miss the deadline. shouldn't be a problem.
+    lock.lock();
+    if (m_segments.empty())
+      return 0;
+    avail = Active().end - m_cur;
+  }
+
+  return avail;
+}
+
+int64_t CSegmentedCache::Seek(int64_t pos)
+{
+  std::unique_lock lock(m_sync);
+  if (m_segments.empty())
+    return CACHE_RC_ERROR;
+
+  if (!Active().Contains(pos))
+  {
+    // another segment has it: fail to trigger a reset, which activates that segment
+    for (const Segment& segment : m_segments)
+    {
+      if (segment.Contains(pos))
+        return CACHE_RC_ERROR;
+    }
+  }
+
+  // if seek is a bit over what we have, try to wait a few seconds for the data to be available.
+  // we try to avoid a (heavy) seek on the source
+  if (pos >= Active().end && pos < Active().end + 100000)
+  {
+    // make everything in the active segment history, so the whole read-ahead is available
+    m_cur = Active().end;
+
+    lock.unlock();
+    WaitForData(static_cast<uint32_t>(pos - m_cur), 5s);
+    lock.lock();
+
+    if (m_segments.empty())
+      return CACHE_RC_ERROR;
+
+    if (!Active().Contains(pos))
+      CLog::Log(LOGDEBUG,
+                "CSegmentedCache::{} - ({}) Wait for data failed for pos {}, ended up at {}",
+                __FUNCTION__, fmt::ptr(this), pos, Active().end);
+  }
+
+  if (Active().Contains(pos))
+  {
+    m_cur = pos;
+    Active().lastUsed = ++m_useCounter;
+    return pos;
+  }
+
+  return CACHE_RC_ERROR;
+}
+
+bool CSegmentedCache::Reset(int64_t pos)
+{
+  std::unique_lock lock(m_sync);
+  if (m_segments.empty())
+    return true;
+
+  // prefer the segment with the most data after pos, the active one on a tie
+  size_t best = m_segments.size();
+  for (size_t i = 0; i < m_segments.size(); ++i)
+  {
+    const Segment& segment = m_segments[i];
+    if (!segment.Contains(pos))
+      continue;
+    if (best == m_segments.size() || segment.end > m_segments[best].end ||
+        (segment.end == m_segments[best].end && i == m_active))
+      best = i;
+  }
+
+  if (best != m_segments.size())
+  {
+    if (best != m_active)
+      CLog::Log(LOGDEBUG, "CSegmentedCache::{} - ({}) Switching to segment {}-{} for {}",
+                __FUNCTION__, fmt::ptr(this), m_segments[best].start, m_segments[best].end, pos);
+
+    m_active = best;
+    m_cur = pos;
+    Active().lastUsed = ++m_useCounter;
+    return false;
+  }
+
+  // keep the active segment, unless it has no data
+  if (Active().start == Active().end)
+    RemoveSegment(m_active);
+
+  if (m_segments.size() >= MAX_SEGMENTS)
+  {
+    const auto lru = std::ranges::min_element(m_segments, {}, &Segment::lastUsed);
+    RemoveSegment(std::distance(m_segments.begin(), lru));
+  }
+
+  Segment segment;
+  segment.base = pos;
+  segment.start = pos;
+  segment.end = pos;
+  segment.lastUsed = ++m_useCounter;
+  m_segments.emplace_back(std::move(segment));
+  m_active = m_segments.size() - 1;
+  m_cur = pos;
+
+  return true;
+}
+
+int64_t CSegmentedCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+
+  int64_t end = iFilePosition;
+  for (const Segment& segment : m_segments)
+  {
+    if (segment.Contains(iFilePosition))
+      end = std::max(end, segment.end);
+  }
+  return end;
+}
+
+int64_t CSegmentedCache::CachedDataStartPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_segments.empty() ? 0 : Active().start;
+}
+
+int64_t CSegmentedCache::CachedDataEndPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_segments.empty() ? 0 : Active().end;
+}
+
+bool CSegmentedCache::IsCachedPosition(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  return std::ranges::any_of(m_segments, [iFilePosition](const Segment& segment)
+                             { return segment.Contains(iFilePosition); });
+}
+
+void CSegmentedCache::SetReadAhead(int64_t readAhead)
+{
+  std::unique_lock lock(m_sync);
+  m_readAhead = std::clamp(readAhead, static_cast<int64_t>(2 * m_blockSize),
+                           static_cast<int64_t>(m_front));
+}
+
+CCacheStrategy* CSegmentedCache::CreateNew()
+{
+  return new CSegmentedCache(m_front, m_back);
+}
+
+size_t CSegmentedCache::GetSegmentCount() const
+{
+  std::unique_lock lock(m_sync);
+  return m_segments.size();
+}
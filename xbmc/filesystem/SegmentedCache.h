@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace XFILE
+{
+
+/*!
+ * \brief Memory cache keeping several ranges (segments) of the source.
+ *
+ * The memory is split in fixed size blocks. Only one segment, the active one, is filled and read
+ * from at a time. A seek outside of the active segment starts a new segment instead of throwing
+ * the cached data away, so seeking back to a previously read position, e.g. when skipping between
+ * chapters, is served from memory. Blocks are recycled from the history of the active segment
+ * first and then from the tail of the least recently used segment.
+ *
+ * How far the active segment is filled ahead of the read position is set with SetReadAhead(), the
+ * rest of the memory is used to keep history.
+ */
+class CSegmentedCache : public CCacheStrategy
+{
+public:
+  /*!
+   * \param front maximum forward buffer size
+   * \param back guaranteed back buffer size of the active segment
+   */
+  CSegmentedCache(size_t front, size_t back);
+  ~CSegmentedCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* buf, size_t len) override;
+  int ReadFromCache(char* buf, size_t len) override;
+  int64_t WaitForData(uint32_t minimum, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t pos) override;
+  bool Reset(int64_t pos) override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  void SetReadAhead(int64_t readAhead) override;
+
+  CCacheStrategy* CreateNew() override;
+
+  size_t GetSegmentCount() const;
+
+  static constexpr size_t MAX_SEGMENTS = 8;
+
+private:
+  struct Segment
+  {
+    int64_t base = 0; /**< file position of the first byte of the first block */
+    int64_t start = 0; /**< file position of the first valid byte */
+    int64_t end = 0; /**< file position after the last valid byte */
+    std::deque<uint8_t*> blocks;
+    uint64_t lastUsed = 0;
+
+    bool Contains(int64_t pos) const { return pos >= start && pos <= end; }
+  };
+
+  Segment& Active() { return m_segments[m_active]; }
+  size_t GetDroppableHistory() const;
+  bool AppendBlock();
+  void DropTailBlock(Segment& segment);
+  void RemoveSegment(size_t index);
+  void RemoveCoveredSegments();
+
+  const size_t m_front;
+  const size_t m_back;
+  const size_t m_blockSize;
+  std::unique_ptr<uint8_t[]> m_buf;
+  std::vector<uint8_t*> m_freeBlocks;
+  std::vector<Segment> m_segments;
+  size_t m_active = 0;
+  int64_t m_cur = 0; /**< current reading index in file, within the active segment */
+  int64_t m_readAhead;
+  uint64_t m_useCounter = 0;
+  mutable CCriticalSection m_sync;
+  CEvent m_written;
+};
+
+} // namespace XFILE
@@ -9,8 +9,18 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "URL.h"
+#include "filesystem/Directory.h"
 #include "filesystem/DirectoryCache.h"
+#include "filesystem/File.h"
 #include "filesystem/IDirectory.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -512,3 +522,235 @@ TEST_F(TestDirectoryCache, GetDirectoryReturnValue)
   EXPECT_FALSE(notFound);
   EXPECT_EQ(0, emptyRetrieved.Size());
 }
+
+class TestPersistentDirectoryCache : public TestDirectoryCache
+{
+protected:
+  void SetUp() override
+  {
+    TestDirectoryCache::SetUp();
+    path = URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"),
+                                     "TestPersistentDirectoryCache/");
+    source = URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"),
+                                       "TestPersistentDirectoryCacheSource/");
+    ASSERT_TRUE(CDirectory::Create(path));
+    ASSERT_TRUE(CDirectory::Create(source));
+    cache->SetPersistentPath(path);
+  }
+
+  void TearDown() override
+  {
+    TestDirectoryCache::TearDown();
+    CDirectory::RemoveRecursive(path);
+    CDirectory::RemoveRecursive(source);
+  }
+
+  // a new cache, as after a restart
+  std::unique_ptr<CDirectoryCache> Restart() const
+  {
+    auto restarted = std::make_unique<CDirectoryCache>();
+    restarted->SetPersistentPath(path);
+    return restarted;
+  }
+
+  static void WriteFile(const std::string& file, const std::string& data)
+  {
+    CFile out;
+    ASSERT_TRUE(out.OpenForWrite(file, true));
+    EXPECT_EQ(static_cast<ssize_t>(data.size()), out.Write(data.data(), data.size()));
+    out.Close();
+  }
+
+  // a directory on the source holding files and a subfolder, listed
+  std::string CreateSourceDirectory(const std::string& name, int files, CFileItemList& items) const
+  {
+    const std::string dir = URIUtils::AddFileToFolder(source, name + "/");
+    EXPECT_TRUE(CDirectory::Create(dir));
+    EXPECT_TRUE(CDirectory::Create(URIUtils::AddFileToFolder(dir, "subdir/")));
+    for (int i = 0; i < files; ++i)
+      WriteFile(URIUtils::AddFileToFolder(dir, StringUtils::Format("file{}.mkv", i)), "movie");
+    EXPECT_TRUE(CDirectory::GetDirectory(dir, items, "", DIR_FLAG_BYPASS_CACHE));
+    return dir;
+  }
+
+  std::string path;
+  std::string source;
+};
+
+TEST_F(TestPersistentDirectoryCache, Persistable)
+{
+  EXPECT_TRUE(cache->IsPersistable(CURL("smb://server/share/")));
+  EXPECT_TRUE(cache->IsPersistable(CURL("nfs://server/export/")));
+  EXPECT_TRUE(cache->IsPersistable(CURL("upnp://uuid/1/")));
+  EXPECT_FALSE(cache->IsPersistable(CURL("ftp://test/directory/")));
+  EXPECT_FALSE(cache->IsPersistable(CURL("/home/user/videos/")));
+
+  cache->SetPersistentPath("");
+  EXPECT_FALSE(cache->IsPersistable(CURL("smb://server/share/")));
+  EXPECT_FALSE(CDirectoryCache::GetDirectoryStamp(CURL("upnp://uuid/1/")).IsValid());
+}
+
+TEST_F(TestPersistentDirectoryCache, RoundTrip)
+{
+  CFileItemList items;
+  const std::string dir = CreateSourceDirectory("directory", 1, items);
+  ASSERT_EQ(2, items.Size());
+
+  const DirectoryStamp stamp = CDirectoryCache::GetDirectoryStamp(CURL(dir));
+  ASSERT_TRUE(stamp.IsValid());
+  cache->PersistDirectory(CURL(dir), items, stamp);
+
+  auto restarted = Restart();
+  CFileItemList retrieved;
+  ASSERT_TRUE(restarted->GetPersistedDirectory(CURL(dir), retrieved, stamp));
+  ASSERT_EQ(2, retrieved.Size());
+  const auto file = retrieved.Get(URIUtils::AddFileToFolder(dir, "file0.mkv"));
+  ASSERT_NE(nullptr, file);
+  EXPECT_EQ(5, file->GetSize());
+  EXPECT_FALSE(file->IsFolder());
+  const auto subdir = retrieved.Get(URIUtils::AddFileToFolder(dir, "subdir/"));
+  ASSERT_NE(nullptr, subdir);
+  EXPECT_TRUE(subdir->IsFolder());
+
+  // the path without the trailing slash is the same directory
+  std::string withoutSlash = dir;
+  URIUtils::RemoveSlashAtEnd(withoutSlash);
+  retrieved.Clear();
+  EXPECT_TRUE(restarted->GetPersistedDirectory(CURL(withoutSlash), retrieved, stamp));
+
+  const DirectoryCacheStats stats = restarted->GetStats();
+  EXPECT_EQ(2u, stats.persistentHits);
+  EXPECT_EQ(0u, stats.persistentStale);
+  EXPECT_EQ(0u, stats.persistentMisses);
+}
+
+TEST_F(TestPersistentDirectoryCache, Validation)
+{
+  CFileItemList items;
+  const std::string dir = CreateSourceDirectory("directory", 2, items);
+  const DirectoryStamp stamp = CDirectoryCache::GetDirectoryStamp(CURL(dir));
+  cache->PersistDirectory(CURL(dir), items, stamp);
+
+  CFileItemList retrieved;
+  EXPECT_FALSE(
+      cache->GetPersistedDirectory(CURL(dir), retrieved, {stamp.mtime + 60, stamp.size}));
+  EXPECT_FALSE(cache->GetPersistedDirectory(CURL(dir), retrieved, {}));
+  EXPECT_FALSE(cache->GetPersistedDirectory(CURL(source + "other/"), retrieved, stamp));
+  EXPECT_EQ(0, retrieved.Size());
+  EXPECT_TRUE(cache->GetPersistedDirectory(CURL(dir), retrieved, stamp));
+
+  // rewriting a file leaves the directory as it was, only the entry tells
+  WriteFile(URIUtils::AddFileToFolder(dir, "file1.mkv"), "a longer movie");
+  ASSERT_TRUE(stamp == CDirectoryCache::GetDirectoryStamp(CURL(dir)));
+  retrieved.Clear();
+  EXPECT_TRUE(cache->GetPersistedDirectory(CURL(dir), retrieved, stamp));
+  ASSERT_EQ(items.Size(), retrieved.Size());
+  for (const auto& item : retrieved)
+  {
+    EXPECT_EQ(!StringUtils::EndsWith(item->GetPath(), "file1.mkv"),
+              CDirectoryCache::IsEntryCurrent(*item))
+        << item->GetPath();
+  }
+
+  const DirectoryCacheStats stats = cache->GetStats();
+  EXPECT_EQ(2u, stats.persistentHits);
+  EXPECT_EQ(2u, stats.persistentStale);
+  EXPECT_EQ(1u, stats.persistentMisses);
+}
+
+TEST_F(TestPersistentDirectoryCache, Unvalidated)
+{
+  CURL url("upnp://uuid/1/");
+  CFileItemList items;
+  AddFile(items, CURL("upnp://uuid/1/2"));
+  cache->PersistDirectory(url, items, {});
+
+  // media servers can't tell whether they changed, the listing is used for a day
+  CFileItemList retrieved;
+  EXPECT_TRUE(cache->GetPersistedDirectory(url, retrieved, {}));
+  EXPECT_EQ(1, retrieved.Size());
+}
+
+TEST_F(TestPersistentDirectoryCache, ClearDirectory)
+{
+  const CURL url("smb://server/share/directory/");
+  CFileItemList items;
+  AddFile(items, CURL("smb://server/share/directory/file1.mkv"));
+  cache->SetDirectory(url, items, CacheType::ONCE);
+  cache->PersistDirectory(url, items, {});
+
+  cache->ClearDirectory(url);
+
+  CFileItemList retrieved;
+  EXPECT_FALSE(Restart()->GetPersistedDirectory(url, retrieved, {}));
+}
+
+TEST_F(TestPersistentDirectoryCache, Prune)
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    const CURL url(StringUtils::Format("upnp://uuid/{}/", i));
+    CFileItemList items;
+    AddFile(items, CURL(StringUtils::Format("upnp://uuid/{}/1", i)));
+    cache->PersistDirectory(url, items, {});
+  }
+  // left behind by a crash while storing a listing
+  WriteFile(URIUtils::AddFileToFolder(path, "00000000.dc.0x1234.tmp"), "partial");
+
+  const auto countFiles = [this]
+  {
+    CFileItemList files;
+    CDirectory::GetDirectory(path, files, "", DIR_FLAG_BYPASS_CACHE);
+    return files.Size();
+  };
+  ASSERT_EQ(4, countFiles());
+
+  // young and small enough
+  cache->PrunePersistedDirectories(std::chrono::hours(1), 1024 * 1024);
+  EXPECT_EQ(4, countFiles());
+
+  cache->PrunePersistedDirectories(std::chrono::hours(1), 1);
+  EXPECT_EQ(0, countFiles());
+
+  CFileItemList retrieved;
+  EXPECT_FALSE(cache->GetPersistedDirectory(CURL("upnp://uuid/0/"), retrieved, {}));
+}
+
+/*!
+ Loads the persisted listings of a share with a folder per movie after a restart, each validated
+ against the source. Not part of the default run, compare the time with the round trip(s) needed
+ to list a directory on a share, usually 1-10 ms.
+ */
+TEST_F(TestPersistentDirectoryCache, DISABLED_ColdStart)
+{
+  constexpr int dirs = 100;
+  constexpr int filesPerDir = 20;
+
+  std::vector<std::pair<std::string, DirectoryStamp>> persisted;
+  for (int i = 0; i < dirs; ++i)
+  {
+    CFileItemList items;
+    const std::string dir =
+        CreateSourceDirectory(StringUtils::Format("Movie {} (2020)", i), filesPerDir, items);
+    const DirectoryStamp stamp = CDirectoryCache::GetDirectoryStamp(CURL(dir));
+    cache->PersistDirectory(CURL(dir), items, stamp);
+    persisted.emplace_back(dir, stamp);
+  }
+
+  auto restarted = Restart();
+  const auto start = std::chrono::steady_clock::now();
+  int loaded = 0;
+  for (const auto& [dir, stamp] : persisted)
+  {
+    CFileItemList items;
+    if (restarted->GetPersistedDirectory(CURL(dir), items, stamp) &&
+        items.Size() == filesPerDir + 1)
+      loaded++;
+  }
+  const std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(dirs, loaded);
+  RecordProperty("ColdStartMs", static_cast<int>(elapsed.count()));
+  RecordProperty("UsPerDirectory", static_cast<int>(elapsed.count() * 1000 / dirs));
+}
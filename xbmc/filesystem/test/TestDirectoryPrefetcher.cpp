@@ -0,0 +1,208 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItemList.h"
+#include "filesystem/Directory.h"
+#include "filesystem/DirectoryPrefetcher.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+/*!
+ * \brief Prefetcher for a local tree that behaves like a share: every stat and listing costs a
+ * round trip. Keeps track of how many requests were in flight at once.
+ */
+class CLatencyPrefetcher : public CDirectoryPrefetcher
+{
+public:
+  CLatencyPrefetcher(unsigned int maxPerHost, std::chrono::milliseconds latency)
+    : CDirectoryPrefetcher("", DIR_FLAG_DEFAULTS, maxPerHost), m_latency(latency)
+  {
+  }
+
+  unsigned int GetListings() const { return m_listings; }
+  unsigned int GetMaxInFlight() const { return m_maxInFlight; }
+
+  /*!
+   * \brief Hold every round trip until the given number of them were in flight at once, or until
+   * the timeout. The maximum in flight then tells if the prefetcher overlaps its requests.
+   */
+  void WaitForInFlight(unsigned int count) { m_waitForInFlight = count; }
+
+protected:
+  int64_t GetTime(const std::string& path) override
+  {
+    RoundTrip();
+    return CDirectoryPrefetcher::GetTime(path);
+  }
+
+  bool GetDirectory(const std::string& path, CFileItemList& items) override
+  {
+    m_listings++;
+    RoundTrip();
+    return CDirectoryPrefetcher::GetDirectory(path, items);
+  }
+
+private:
+  void RoundTrip()
+  {
+    const unsigned int inFlight = ++m_inFlight;
+    unsigned int max = m_maxInFlight;
+    while (inFlight > max && !m_maxInFlight.compare_exchange_weak(max, inFlight))
+      ;
+    if (m_waitForInFlight > 0)
+    {
+      std::unique_lock lock(m_waitMutex);
+      m_waitCondition.notify_all();
+      m_waitCondition.wait_for(lock, 10s,
+                               [this] { return m_maxInFlight >= m_waitForInFlight; });
+    }
+    std::this_thread::sleep_for(m_latency);
+    m_inFlight--;
+  }
+
+  const std::chrono::milliseconds m_latency;
+  std::atomic<unsigned int> m_listings{0};
+  std::atomic<unsigned int> m_inFlight{0};
+  std::atomic<unsigned int> m_maxInFlight{0};
+  unsigned int m_waitForInFlight{0};
+  std::mutex m_waitMutex;
+  std::condition_variable m_waitCondition;
+};
+
+class TestDirectoryPrefetcher : public ::testing::Test
+{
+protected:
+  // a movie library: a folder per movie with a few files in it
+  void SetUp() override
+  {
+    root = URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"),
+                                     "TestDirectoryPrefetcher");
+    ASSERT_TRUE(CDirectory::Create(root));
+    for (int i = 0; i < DIRS; ++i)
+    {
+      const std::string dir =
+          URIUtils::AddFileToFolder(root, StringUtils::Format("Movie {} (2020)", i));
+      ASSERT_TRUE(CDirectory::Create(dir));
+      for (const char* file : {"movie.mkv", "movie.nfo", "poster.jpg"})
+      {
+        CFile output;
+        ASSERT_TRUE(output.OpenForWrite(URIUtils::AddFileToFolder(dir, file), true));
+        output.Close();
+      }
+      std::string path = dir;
+      URIUtils::AddSlashAtEnd(path);
+      requests.push_back({path, 0});
+    }
+  }
+
+  void TearDown() override { CDirectory::RemoveRecursive(root); }
+
+  static constexpr int DIRS = 64;
+  std::string root;
+  std::vector<CDirectoryPrefetcher::Request> requests;
+  std::atomic<bool> stop{false};
+};
+} // namespace
+
+TEST_F(TestDirectoryPrefetcher, ResultsInRequestOrder)
+{
+  CLatencyPrefetcher prefetcher(4, 1ms);
+  const std::vector<CDirectoryPrefetcher::Result> results = prefetcher.Fetch(requests, {}, stop);
+
+  ASSERT_EQ(requests.size(), results.size());
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    EXPECT_EQ(requests[i].path, results[i].path);
+    EXPECT_NE(0, results[i].time);
+    ASSERT_TRUE(results[i].listed);
+    EXPECT_EQ(3, results[i].items->Size());
+  }
+  EXPECT_LE(prefetcher.GetMaxInFlight(), 4u);
+}
+
+TEST_F(TestDirectoryPrefetcher, OnlyListsWhatIsNeeded)
+{
+  // directories with a known time aren't stat'ed
+  requests[0].time = 42;
+
+  CLatencyPrefetcher prefetcher(4, 0ms);
+  const auto needsListing = [](const std::string& path, int64_t time)
+  { return time != 42 && StringUtils::EndsWith(path, "0 (2020)/"); };
+  const std::vector<CDirectoryPrefetcher::Result> results =
+      prefetcher.Fetch(requests, needsListing, stop);
+
+  EXPECT_EQ(42, results[0].time);
+  EXPECT_FALSE(results[0].listed);
+  EXPECT_FALSE(results[1].listed);
+  EXPECT_EQ(nullptr, results[1].items);
+  EXPECT_TRUE(results[10].listed);
+  EXPECT_EQ(static_cast<unsigned int>(DIRS / 10), prefetcher.GetListings());
+}
+
+TEST_F(TestDirectoryPrefetcher, Stop)
+{
+  stop = true;
+  CLatencyPrefetcher prefetcher(4, 0ms);
+  const std::vector<CDirectoryPrefetcher::Result> results = prefetcher.Fetch(requests, {}, stop);
+
+  ASSERT_EQ(requests.size(), results.size());
+  EXPECT_TRUE(std::ranges::none_of(results, [](const auto& result) { return result.listed; }));
+}
+
+TEST_F(TestDirectoryPrefetcher, OverlapsRoundTrips)
+{
+  CLatencyPrefetcher prefetcher(8, 0ms);
+  prefetcher.WaitForInFlight(8);
+  const std::vector<CDirectoryPrefetcher::Result> results = prefetcher.Fetch(requests, {}, stop);
+
+  EXPECT_TRUE(std::ranges::all_of(results, [](const auto& result) { return result.listed; }));
+  EXPECT_EQ(8u, prefetcher.GetMaxInFlight());
+
+  CLatencyPrefetcher sequential(1, 0ms);
+  sequential.Fetch(requests, {}, stop);
+  EXPECT_EQ(1u, sequential.GetMaxInFlight());
+}
+
+TEST_F(TestDirectoryPrefetcher, DISABLED_Benchmark)
+{
+  // a stat and a listing per movie folder, at a round trip of 5 ms each
+  const auto walk = [this](unsigned int maxPerHost)
+  {
+    CLatencyPrefetcher prefetcher(maxPerHost, 5ms);
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<CDirectoryPrefetcher::Result> results = prefetcher.Fetch(requests, {}, stop);
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(std::ranges::all_of(results, [](const auto& result) { return result.listed; }));
+    EXPECT_LE(prefetcher.GetMaxInFlight(), maxPerHost);
+    return elapsed.count();
+  };
+
+  const double sequential = walk(1);
+  const double parallel = walk(8);
+
+  RecordProperty("SequentialMs", static_cast<int>(sequential));
+  RecordProperty("ParallelMs", static_cast<int>(parallel));
+}
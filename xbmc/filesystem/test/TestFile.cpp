@@ -9,9 +9,13 @@
 #include "filesystem/File.h"
 #include "test/TestUtils.h"
 
+#include <chrono>
+#include <ctime>
 #include <errno.h>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -280,3 +284,136 @@ TEST(TestFile, ReadLine)
   // Read after EOF
   ASSERT_FALSE(file.ReadLine(line));
 }
+
+#if defined(TARGET_POSIX)
+TEST(TestFile, MemoryMapped)
+{
+  const std::string path = XBMC_REF_FILE_PATH("/xbmc/filesystem/test/reffile.txt");
+  XFILE::CFile reference;
+  std::vector<uint8_t> expected;
+  ASSERT_LT(0, reference.LoadFile(path, expected));
+
+  XFILE::CFile file;
+  ASSERT_TRUE(file.Open(path, XFILE::READ_MEMORY_MAP));
+  EXPECT_EQ(static_cast<int64_t>(expected.size()), file.GetLength());
+
+  char buf[100];
+  EXPECT_EQ(100, file.Read(buf, sizeof(buf)));
+  EXPECT_EQ(0, memcmp(expected.data(), buf, sizeof(buf)));
+  EXPECT_EQ(100, file.GetPosition());
+
+  EXPECT_EQ(200, file.Seek(100, SEEK_CUR));
+  EXPECT_EQ(10, file.Read(buf, 10));
+  EXPECT_EQ(0, memcmp(expected.data() + 200, buf, 10));
+
+  EXPECT_EQ(static_cast<int64_t>(expected.size()) - 10, file.Seek(-10, SEEK_END));
+  EXPECT_EQ(10, file.Read(buf, sizeof(buf)));
+  EXPECT_EQ(0, file.Read(buf, sizeof(buf)));
+}
+
+TEST(TestFile, MemoryMappedTruncated)
+{
+  constexpr size_t fileSize = 1024 * 1024;
+
+  XFILE::CFile* temp;
+  ASSERT_NE(nullptr, temp = XBMC_CREATETEMPFILE(""));
+  const std::string path = XBMC_TEMPFILEPATH(temp);
+  temp->Close();
+  std::vector<uint8_t> data(fileSize);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<uint8_t>(i * 7);
+  ASSERT_TRUE(temp->OpenForWrite(path, true));
+  ASSERT_EQ(static_cast<ssize_t>(fileSize), temp->Write(data.data(), data.size()));
+  temp->Close();
+
+  XFILE::CFile file;
+  ASSERT_TRUE(file.Open(path, XFILE::READ_NO_CACHE | XFILE::READ_MEMORY_MAP));
+  std::vector<uint8_t> buffer(64 * 1024);
+  ASSERT_EQ(static_cast<ssize_t>(buffer.size()), file.Read(buffer.data(), buffer.size()));
+  EXPECT_EQ(0, memcmp(data.data(), buffer.data(), buffer.size()));
+
+  // reading the pages that are gone would fault if they were still read through the mapping
+  ASSERT_TRUE(temp->OpenForWrite(path, true));
+  ASSERT_EQ(100, temp->Write(data.data(), 100));
+  temp->Close();
+  EXPECT_EQ(0, file.Read(buffer.data(), buffer.size()));
+
+  EXPECT_EQ(50, file.Seek(50, SEEK_SET));
+  EXPECT_EQ(50, file.Read(buffer.data(), buffer.size()));
+  EXPECT_EQ(0, memcmp(data.data() + 50, buffer.data(), 50));
+
+  file.Close();
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(temp));
+}
+
+TEST(TestFile, DISABLED_MemoryMappedThroughput)
+{
+  constexpr size_t fileSize = 64 * 1024 * 1024;
+  // the size FFmpeg's AVIO context reads with
+  constexpr size_t readSize = 32 * 1024;
+
+  XFILE::CFile* temp;
+  ASSERT_NE(nullptr, temp = XBMC_CREATETEMPFILE(""));
+  const std::string path = XBMC_TEMPFILEPATH(temp);
+  temp->Close();
+  {
+    std::vector<uint8_t> data(fileSize);
+    for (size_t i = 0; i < data.size(); ++i)
+      data[i] = static_cast<uint8_t>(i * 7);
+    ASSERT_TRUE(temp->OpenForWrite(path, true));
+    ASSERT_EQ(static_cast<ssize_t>(fileSize), temp->Write(data.data(), data.size()));
+    temp->Close();
+  }
+
+  std::vector<uint8_t> buffer(readSize);
+  // touch every cache line like a demuxer parsing the data would
+  const auto consume = [](std::span<const uint8_t> data)
+  {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < data.size(); i += 64)
+      sum += data[i];
+    return sum;
+  };
+
+  const auto measure = [&](unsigned int flags, const char* name)
+  {
+    XFILE::CFile file;
+    ASSERT_TRUE(file.Open(path, flags));
+
+    // the page cache is warm after the first pass, so this compares the read paths only
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      ASSERT_EQ(0, file.Seek(0, SEEK_SET));
+      uint64_t checksum = 0;
+      size_t total = 0;
+      const auto start = std::chrono::steady_clock::now();
+      const std::clock_t cpuStart = std::clock();
+      while (true)
+      {
+        const ssize_t read = file.Read(buffer.data(), buffer.size());
+        if (read <= 0)
+          break;
+        checksum += consume(std::span(buffer.data(), read));
+        total += read;
+      }
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      const double cpu = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+      EXPECT_EQ(fileSize, total);
+      EXPECT_NE(0u, checksum);
+
+      if (pass == 1)
+      {
+        const double gib = static_cast<double>(total) / (1024 * 1024 * 1024);
+        RecordProperty(std::string(name) + "MiBPerSecond",
+                       static_cast<int>(gib * 1024 / elapsed.count()));
+        RecordProperty(std::string(name) + "CpuMsPerGiB", static_cast<int>(cpu * 1000 / gib));
+      }
+    }
+  };
+
+  measure(XFILE::READ_NO_CACHE, "Read");
+  measure(XFILE::READ_NO_CACHE | XFILE::READ_MEMORY_MAP, "MappedRead");
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(temp));
+}
+#endif
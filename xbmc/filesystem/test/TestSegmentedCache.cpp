@@ -0,0 +1,281 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "URL.h"
+#include "filesystem/CircularCache.h"
+#include "filesystem/File.h"
+#include "filesystem/IFile.h"
+#include "filesystem/SegmentedCache.h"
+#include "test/TestUtils.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+uint8_t GetByte(int64_t pos)
+{
+  return static_cast<uint8_t>(pos ^ (pos >> 8) ^ (pos >> 16));
+}
+
+std::vector<char> CreateData(int64_t pos, size_t size)
+{
+  std::vector<char> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<char>(GetByte(pos + i));
+  return data;
+}
+
+/*!
+ * \brief Local file standing in for a file on a network share: the first read after a seek costs
+ * a round trip and reads are limited to a given bandwidth.
+ */
+class CLatencyFile : public IFile
+{
+public:
+  CLatencyFile(std::chrono::milliseconds latency, uint32_t bytesPerSecond)
+    : m_latency(latency), m_bytesPerSecond(bytesPerSecond)
+  {
+  }
+
+  bool Open(const CURL& url) override { return m_file.Open(url, READ_NO_CACHE); }
+  void Close() override { m_file.Close(); }
+  bool Exists(const CURL& url) override { return CFile::Exists(url); }
+  int Stat(const CURL& url, struct __stat64* buffer) override { return CFile::Stat(url, buffer); }
+  int64_t GetPosition() override { return m_file.GetPosition(); }
+  int64_t GetLength() override { return m_file.GetLength(); }
+
+  ssize_t Read(void* bufPtr, size_t bufSize) override
+  {
+    std::chrono::microseconds delay(static_cast<int64_t>(bufSize) * 1000000 / m_bytesPerSecond);
+    if (m_seeked)
+    {
+      delay += m_latency;
+      m_roundTrips++;
+    }
+    m_seeked = false;
+    std::this_thread::sleep_for(delay);
+
+    const ssize_t read = m_file.Read(bufPtr, bufSize);
+    if (read > 0)
+      m_bytesRead += read;
+    return read;
+  }
+
+  int64_t Seek(int64_t iFilePosition, int iWhence = SEEK_SET) override
+  {
+    if (iWhence != SEEK_SET || iFilePosition != m_file.GetPosition())
+      m_seeked = true;
+    return m_file.Seek(iFilePosition, iWhence);
+  }
+
+  unsigned int GetRoundTrips() const { return m_roundTrips; }
+  int64_t GetBytesRead() const { return m_bytesRead; }
+
+private:
+  CFile m_file;
+  const std::chrono::milliseconds m_latency;
+  const uint32_t m_bytesPerSecond;
+  bool m_seeked = false;
+  unsigned int m_roundTrips = 0;
+  int64_t m_bytesRead = 0;
+};
+
+/*!
+ * \brief Reads through a cache strategy the way CFileCache does, filling it from the source
+ * whenever it runs dry. Returns false if the data doesn't match the source.
+ */
+bool ReadThroughCache(CCacheStrategy& cache, IFile& source, int64_t pos, size_t size)
+{
+  constexpr size_t chunkSize = 128 * 1024;
+
+  if (cache.Seek(pos) != pos)
+  {
+    source.Seek(cache.CachedDataEndPosIfSeekTo(pos));
+    cache.Reset(pos);
+  }
+
+  std::vector<char> buffer(chunkSize);
+  const std::vector<char> expected = CreateData(pos, size);
+  size_t done = 0;
+  while (done < size)
+  {
+    const int read = cache.ReadFromCache(buffer.data(), std::min(size - done, buffer.size()));
+    if (read > 0)
+    {
+      if (memcmp(expected.data() + done, buffer.data(), read) != 0)
+        return false;
+      done += read;
+      continue;
+    }
+    if (read != CACHE_RC_WOULD_BLOCK)
+      return false;
+
+    const size_t maxWrite = cache.GetMaxWriteSize(chunkSize);
+    const ssize_t filled = source.Read(buffer.data(), maxWrite);
+    if (filled <= 0 || cache.WriteToCache(buffer.data(), filled) != filled)
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+TEST(TestSegmentedCache, ReadWrite)
+{
+  CSegmentedCache cache(6 * 1024, 2 * 1024);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  const std::vector<char> data = CreateData(0, 4000);
+  EXPECT_EQ(4000u, cache.GetMaxWriteSize(4000));
+  EXPECT_EQ(4000, cache.WriteToCache(data.data(), data.size()));
+  EXPECT_EQ(4000, cache.WaitForData(0, 0ms));
+
+  std::vector<char> buffer(4000);
+  size_t read = 0;
+  while (read < buffer.size())
+  {
+    const int ret = cache.ReadFromCache(buffer.data() + read, buffer.size() - read);
+    ASSERT_GT(ret, 0);
+    read += ret;
+  }
+  EXPECT_EQ(data, buffer);
+  EXPECT_EQ(CACHE_RC_WOULD_BLOCK, cache.ReadFromCache(buffer.data(), 1));
+
+  cache.EndOfInput();
+  EXPECT_EQ(0, cache.ReadFromCache(buffer.data(), 1));
+}
+
+TEST(TestSegmentedCache, KeepsSegmentsAcrossSeeks)
+{
+  CSegmentedCache cache(6 * 1024, 2 * 1024);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  std::vector<char> data = CreateData(0, 2000);
+  ASSERT_EQ(2000, cache.WriteToCache(data.data(), data.size()));
+
+  // a seek outside of the cache starts a new segment and keeps the old one
+  EXPECT_EQ(CACHE_RC_ERROR, cache.Seek(1000000));
+  EXPECT_TRUE(cache.Reset(1000000));
+  data = CreateData(1000000, 2000);
+  ASSERT_EQ(2000, cache.WriteToCache(data.data(), data.size()));
+  EXPECT_EQ(2u, cache.GetSegmentCount());
+  EXPECT_TRUE(cache.IsCachedPosition(1000));
+  EXPECT_EQ(2000, cache.CachedDataEndPosIfSeekTo(1000));
+
+  // seeking back into the old segment needs a reset, which only swaps segments
+  EXPECT_EQ(CACHE_RC_ERROR, cache.Seek(1000));
+  EXPECT_FALSE(cache.Reset(1000));
+  EXPECT_EQ(0, cache.CachedDataStartPos());
+  EXPECT_EQ(2000, cache.CachedDataEndPos());
+
+  char byte;
+  ASSERT_EQ(1, cache.ReadFromCache(&byte, 1));
+  EXPECT_EQ(static_cast<char>(GetByte(1000)), byte);
+
+  // writes continue the active segment
+  data = CreateData(2000, 100);
+  ASSERT_EQ(100, cache.WriteToCache(data.data(), data.size()));
+  EXPECT_EQ(2100, cache.CachedDataEndPos());
+}
+
+TEST(TestSegmentedCache, EvictsLeastRecentlyUsed)
+{
+  // 8 blocks of 1 KiB
+  CSegmentedCache cache(6 * 1024, 2 * 1024);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+  std::vector<char> buffer(3 * 1024);
+
+  for (int64_t pos : {0, 100000, 200000})
+  {
+    cache.Reset(pos);
+    const std::vector<char> data = CreateData(pos, 3 * 1024);
+    ASSERT_EQ(3 * 1024, cache.WriteToCache(data.data(), data.size()));
+    while (cache.ReadFromCache(buffer.data(), buffer.size()) > 0)
+      ;
+  }
+
+  // the third segment took the tail of the first one
+  EXPECT_EQ(3u, cache.GetSegmentCount());
+  EXPECT_TRUE(cache.IsCachedPosition(1024));
+  EXPECT_FALSE(cache.IsCachedPosition(2500));
+  EXPECT_EQ(100000 + 3 * 1024, cache.CachedDataEndPosIfSeekTo(100000));
+}
+
+TEST(TestSegmentedCache, ReadAhead)
+{
+  CSegmentedCache cache(6 * 1024, 2 * 1024);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+  EXPECT_EQ(6u * 1024, cache.GetMaxWriteSize(16 * 1024));
+
+  cache.SetReadAhead(3000);
+  EXPECT_EQ(3000u, cache.GetMaxWriteSize(16 * 1024));
+  const std::vector<char> data = CreateData(0, 4000);
+  EXPECT_EQ(3000, cache.WriteToCache(data.data(), data.size()));
+  EXPECT_EQ(0u, cache.GetMaxWriteSize(16 * 1024));
+
+  char buffer[1000];
+  ASSERT_EQ(1000, cache.ReadFromCache(buffer, sizeof(buffer)));
+  EXPECT_EQ(1000u, cache.GetMaxWriteSize(16 * 1024));
+}
+
+TEST(TestSegmentedCache, ChapterSkipsOverSlowSource)
+{
+  constexpr size_t fileSize = 32 * 1024 * 1024;
+  constexpr size_t cacheFront = 6 * 1024 * 1024;
+  constexpr size_t cacheBack = 2 * 1024 * 1024;
+
+  CFile* temp;
+  ASSERT_NE(nullptr, temp = XBMC_CREATETEMPFILE(""));
+  const std::string path = XBMC_TEMPFILEPATH(temp);
+  temp->Close();
+  {
+    const std::vector<char> data = CreateData(0, fileSize);
+    ASSERT_TRUE(temp->OpenForWrite(path, true));
+    ASSERT_EQ(static_cast<ssize_t>(fileSize), temp->Write(data.data(), data.size()));
+    temp->Close();
+  }
+
+  // play the start of a few chapters, skipping back and forth between them
+  constexpr int64_t chapter = 4 * 1024 * 1024;
+  constexpr size_t play = 1024 * 1024;
+  const std::vector<int64_t> chapters = {0, 3, 0, 3, 5, 3, 0, 5};
+
+  const auto replay = [&](CCacheStrategy& cache, const char* name, unsigned int& roundTrips)
+  {
+    CLatencyFile source(20ms, 256 * 1024 * 1024);
+    ASSERT_TRUE(source.Open(CURL(path)));
+    ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+    for (int64_t i : chapters)
+      EXPECT_TRUE(ReadThroughCache(cache, source, i * chapter, play));
+
+    RecordProperty(std::string(name) + "RoundTrips", source.GetRoundTrips());
+    RecordProperty(std::string(name) + "SourceKiB", static_cast<int>(source.GetBytesRead() / 1024));
+    cache.Close();
+    roundTrips = source.GetRoundTrips();
+  };
+
+  unsigned int circularRoundTrips = 0;
+  CCircularCache circular(cacheFront, cacheBack);
+  replay(circular, "Circular", circularRoundTrips);
+  unsigned int segmentedRoundTrips = 0;
+  CSegmentedCache segmented(cacheFront, cacheBack);
+  replay(segmented, "Segmented", segmentedRoundTrips);
+
+  // every chapter is only fetched once, the first one without a seek
+  EXPECT_EQ(2u, segmentedRoundTrips);
+  EXPECT_EQ(7u, circularRoundTrips);
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(temp));
+}
@@ -13,9 +13,299 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <string.h>
 using namespace XFILE;
 
+namespace
+{
+struct Color
+{
+  float r;
+  float g;
+  float b;
+};
+
+// the 16 texels of a 4x4 block in BGRA byte order, row by row
+using Block = std::array<std::array<uint8_t, 4>, 16>;
+
+void ReadBlock(const unsigned char* pixels,
+               unsigned int pitch,
+               unsigned int width,
+               unsigned int height,
+               unsigned int x,
+               unsigned int y,
+               Block& block)
+{
+  for (unsigned int j = 0; j < 4; ++j)
+  {
+    const unsigned char* row = pixels + std::min(y + j, height - 1) * pitch;
+    for (unsigned int i = 0; i < 4; ++i)
+      memcpy(block[j * 4 + i].data(), row + std::min(x + i, width - 1) * 4, 4);
+  }
+}
+
+Color Lerp(const Color& a, const Color& b, float t)
+{
+  return {a.r + (b.r - a.r) * t, a.g + (b.g - a.g) * t, a.b + (b.b - a.b) * t};
+}
+
+float Distance(const Color& a, const Color& b)
+{
+  const float r = a.r - b.r;
+  const float g = a.g - b.g;
+  const float b2 = a.b - b.b;
+  return r * r + g * g + b2 * b2;
+}
+
+uint16_t To565(const Color& color)
+{
+  const auto quantize = [](float value, int max)
+  { return std::clamp(static_cast<int>(value * max / 255.0f + 0.5f), 0, max); };
+  return static_cast<uint16_t>(quantize(color.r, 31) << 11 | quantize(color.g, 63) << 5 |
+                               quantize(color.b, 31));
+}
+
+Color From565(uint16_t color)
+{
+  const int r = color >> 11 & 0x1F;
+  const int g = color >> 5 & 0x3F;
+  const int b = color & 0x1F;
+  return {static_cast<float>(r << 3 | r >> 2), static_cast<float>(g << 2 | g >> 4),
+          static_cast<float>(b << 3 | b >> 2)};
+}
+
+/*!
+ \brief Quantize the endpoints and pick the nearest of the four palette colors for every texel.
+ c0 ends up above c1, which selects the four color mode. Equal endpoints would select the three
+ color mode with transparent black at index 3, so they use index 0 only.
+ \return the packed indices, error is the summed squared distance to the chosen colors.
+ */
+uint32_t SelectIndices(const Color (&texels)[16],
+                       const Color& a,
+                       const Color& b,
+                       uint16_t& c0,
+                       uint16_t& c1,
+                       float& error)
+{
+  c0 = To565(a);
+  c1 = To565(b);
+  if (c0 < c1)
+    std::swap(c0, c1);
+
+  const Color color0 = From565(c0);
+  const Color color1 = From565(c1);
+  error = 0.0f;
+  if (c0 == c1)
+  {
+    for (const Color& texel : texels)
+      error += Distance(texel, color0);
+    return 0;
+  }
+
+  const Color palette[4] = {color0, color1, Lerp(color0, color1, 1.0f / 3.0f),
+                            Lerp(color0, color1, 2.0f / 3.0f)};
+  uint32_t indices = 0;
+  for (unsigned int i = 0; i < 16; ++i)
+  {
+    unsigned int best = 0;
+    float bestDistance = Distance(texels[i], palette[0]);
+    for (unsigned int p = 1; p < 4; ++p)
+    {
+      const float distance = Distance(texels[i], palette[p]);
+      if (distance < bestDistance)
+      {
+        best = p;
+        bestDistance = distance;
+      }
+    }
+    indices |= best << (i * 2);
+    error += bestDistance;
+  }
+  return indices;
+}
+
+/*!
+ \brief Endpoints along the principal axis of the block, inset a little to reduce the error
+ of the interpolated colors.
+ */
+void FitEndpoints(const Color (&texels)[16], Color& a, Color& b)
+{
+  Color mean{};
+  for (const Color& texel : texels)
+  {
+    mean.r += texel.r / 16.0f;
+    mean.g += texel.g / 16.0f;
+    mean.b += texel.b / 16.0f;
+  }
+
+  float rr = 0, rg = 0, rb = 0, gg = 0, gb = 0, bb = 0;
+  for (const Color& texel : texels)
+  {
+    const float r = texel.r - mean.r;
+    const float g = texel.g - mean.g;
+    const float b2 = texel.b - mean.b;
+    rr += r * r;
+    rg += r * g;
+    rb += r * b2;
+    gg += g * g;
+    gb += g * b2;
+    bb += b2 * b2;
+  }
+
+  // power iteration converges on the axis with the largest variance
+  Color axis{1.0f, 1.0f, 1.0f};
+  for (int i = 0; i < 8; ++i)
+  {
+    const Color next{axis.r * rr + axis.g * rg + axis.b * rb,
+                     axis.r * rg + axis.g * gg + axis.b * gb,
+                     axis.r * rb + axis.g * gb + axis.b * bb};
+    const float length = std::max({std::fabs(next.r), std::fabs(next.g), std::fabs(next.b)});
+    if (length < 1e-6f)
+      break;
+    axis = {next.r / length, next.g / length, next.b / length};
+  }
+
+  float minProjection = std::numeric_limits<float>::max();
+  float maxProjection = std::numeric_limits<float>::lowest();
+  for (const Color& texel : texels)
+  {
+    const float projection = texel.r * axis.r + texel.g * axis.g + texel.b * axis.b;
+    if (projection < minProjection)
+    {
+      minProjection = projection;
+      b = texel;
+    }
+    if (projection > maxProjection)
+    {
+      maxProjection = projection;
+      a = texel;
+    }
+  }
+
+  const Color inset{(a.r - b.r) / 16.0f, (a.g - b.g) / 16.0f, (a.b - b.b) / 16.0f};
+  a = {a.r - inset.r, a.g - inset.g, a.b - inset.b};
+  b = {b.r + inset.r, b.g + inset.g, b.b + inset.b};
+}
+
+/*!
+ \brief Least squares endpoints for the chosen indices.
+ \return false if the indices don't constrain both endpoints.
+ */
+bool RefineEndpoints(const Color (&texels)[16], uint32_t indices, Color& a, Color& b)
+{
+  // weight of the first endpoint for each index
+  constexpr float weights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+
+  float aa = 0, ab = 0, bb = 0;
+  Color ax{}, bx{};
+  for (unsigned int i = 0; i < 16; ++i)
+  {
+    const float w = weights[(indices >> (i * 2)) & 3];
+    const float v = 1.0f - w;
+    aa += w * w;
+    ab += w * v;
+    bb += v * v;
+    ax = {ax.r + w * texels[i].r, ax.g + w * texels[i].g, ax.b + w * texels[i].b};
+    bx = {bx.r + v * texels[i].r, bx.g + v * texels[i].g, bx.b + v * texels[i].b};
+  }
+
+  const float determinant = aa * bb - ab * ab;
+  if (std::fabs(determinant) < 1e-6f)
+    return false;
+
+  const float scale = 1.0f / determinant;
+  a = {(bb * ax.r - ab * bx.r) * scale, (bb * ax.g - ab * bx.g) * scale,
+       (bb * ax.b - ab * bx.b) * scale};
+  b = {(aa * bx.r - ab * ax.r) * scale, (aa * bx.g - ab * ax.g) * scale,
+       (aa * bx.b - ab * ax.b) * scale};
+  return true;
+}
+
+void WriteLE(uint8_t* output, uint64_t value, unsigned int bytes)
+{
+  for (unsigned int i = 0; i < bytes; ++i)
+    output[i] = static_cast<uint8_t>(value >> (i * 8));
+}
+
+void EncodeColorBlock(const Block& block, uint8_t* output)
+{
+  Color texels[16];
+  for (unsigned int i = 0; i < 16; ++i)
+    texels[i] = {static_cast<float>(block[i][2]), static_cast<float>(block[i][1]),
+                 static_cast<float>(block[i][0])};
+
+  Color a;
+  Color b;
+  FitEndpoints(texels, a, b);
+
+  uint16_t c0;
+  uint16_t c1;
+  float error;
+  uint32_t indices = SelectIndices(texels, a, b, c0, c1, error);
+
+  uint16_t refined0;
+  uint16_t refined1;
+  float refinedError;
+  if (error > 0.0f && RefineEndpoints(texels, indices, a, b))
+  {
+    const uint32_t refinedIndices = SelectIndices(texels, a, b, refined0, refined1, refinedError);
+    if (refinedError < error)
+    {
+      indices = refinedIndices;
+      c0 = refined0;
+      c1 = refined1;
+    }
+  }
+
+  WriteLE(output, c0, 2);
+  WriteLE(output + 2, c1, 2);
+  WriteLE(output + 4, indices, 4);
+}
+
+void EncodeAlphaBlock(const Block& block, uint8_t* output)
+{
+  uint8_t minAlpha = 255;
+  uint8_t maxAlpha = 0;
+  for (const auto& texel : block)
+  {
+    minAlpha = std::min(minAlpha, texel[3]);
+    maxAlpha = std::max(maxAlpha, texel[3]);
+  }
+
+  // alpha0 above alpha1 selects the eight value mode, equal values decode as alpha0 at index 0
+  uint64_t indices = 0;
+  if (maxAlpha > minAlpha)
+  {
+    int palette[8] = {maxAlpha, minAlpha};
+    for (int i = 2; i < 8; ++i)
+      palette[i] = ((8 - i) * maxAlpha + (i - 1) * minAlpha + 3) / 7;
+
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+      uint64_t best = 0;
+      int bestDistance = 256;
+      for (unsigned int p = 0; p < 8; ++p)
+      {
+        const int distance = std::abs(palette[p] - block[i][3]);
+        if (distance < bestDistance)
+        {
+          best = p;
+          bestDistance = distance;
+        }
+      }
+      indices |= best << (i * 3);
+    }
+  }
+
+  output[0] = maxAlpha;
+  output[1] = minAlpha;
+  WriteLE(output + 2, indices, 6);
+}
+} // namespace
+
 CDDSImage::CDDSImage()
 {
   m_data = NULL;
@@ -86,8 +376,11 @@ bool CDDSImage::ReadFile(const std::string &inputFile)
     return false;
   if (!GetFormat())
     return false;  // not supported
+  if (m_desc.linearSize < GetStorageRequirements(m_desc.width, m_desc.height, GetFormat()))
+    return false;
 
   // allocate our data
+  delete[] m_data;
   m_data = new unsigned char[m_desc.linearSize];
   if (!m_data)
     return false;
@@ -100,6 +393,60 @@ bool CDDSImage::ReadFile(const std::string &inputFile)
   return true;
 }
 
+bool CDDSImage::Compress(unsigned int width,
+                         unsigned int height,
+                         unsigned int pitch,
+                         const unsigned char* pixels,
+                         XB_FMT format)
+{
+  if (format != XB_FMT_DXT1 && format != XB_FMT_DXT5)
+    return false;
+  if (!width || !height || !pixels)
+    return false;
+
+  Allocate(width, height, format);
+
+  unsigned char* output = m_data;
+  Block block;
+  for (unsigned int y = 0; y < height; y += 4)
+  {
+    for (unsigned int x = 0; x < width; x += 4)
+    {
+      ReadBlock(pixels, pitch, width, height, x, y, block);
+      if (format == XB_FMT_DXT5)
+      {
+        EncodeAlphaBlock(block, output);
+        output += 8;
+      }
+      EncodeColorBlock(block, output);
+      output += 8;
+    }
+  }
+  return true;
+}
+
+bool CDDSImage::WriteFile(const std::string& outputFile) const
+{
+  if (!m_data)
+    return false;
+
+  CFile file;
+  if (!file.OpenForWrite(outputFile, true))
+    return false;
+
+  if (file.Write("DDS ", 4) != 4 ||
+      file.Write(&m_desc, sizeof(m_desc)) != static_cast<ssize_t>(sizeof(m_desc)) ||
+      file.Write(m_data, m_desc.linearSize) != static_cast<ssize_t>(m_desc.linearSize))
+  {
+    file.Close();
+    CFile::Delete(outputFile);
+    return false;
+  }
+
+  file.Close();
+  return true;
+}
+
 unsigned int CDDSImage::GetStorageRequirements(unsigned int width,
                                                unsigned int height,
                                                XB_FMT format)
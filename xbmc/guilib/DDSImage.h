@@ -28,6 +28,24 @@ public:
 
   bool ReadFile(const std::string &file);
 
+  /*!
+   \brief Compress an image into DXT blocks on the CPU
+   Edge blocks of images that aren't a multiple of 4 in size repeat the last row and column.
+   \param width width of the image in pixels
+   \param height height of the image in pixels
+   \param pitch bytes per row of pixels
+   \param pixels image in XB_FMT_A8R8G8B8 (BGRA) byte order
+   \param format XB_FMT_DXT1 for opaque images, XB_FMT_DXT5 to keep the alpha channel
+   \return true on success, false if the format is not supported
+   */
+  bool Compress(unsigned int width,
+                unsigned int height,
+                unsigned int pitch,
+                const unsigned char* pixels,
+                XB_FMT format);
+
+  bool WriteFile(const std::string& file) const;
+
 private:
   void Allocate(unsigned int width, unsigned int height, XB_FMT format);
   static const char* GetFourCC(XB_FMT format);
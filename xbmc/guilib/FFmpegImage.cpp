@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 extern "C"
 {
@@ -116,6 +117,43 @@ static int64_t mem_file_seek(void *h, int64_t pos, int whence)
   return mbuf->pos;
 }
 
+namespace
+{
+// the EXIF orientation (1-8) from the payload of an APP1 segment, 0 if there is none
+unsigned int GetExifOrientation(const uint8_t* data, size_t size)
+{
+  constexpr uint8_t exifHeader[] = {'E', 'x', 'i', 'f', '\0', '\0'};
+  if (size < sizeof(exifHeader) + 8 || std::memcmp(data, exifHeader, sizeof(exifHeader)) != 0)
+    return 0;
+
+  const uint8_t* tiff = data + sizeof(exifHeader);
+  const size_t tiffSize = size - sizeof(exifHeader);
+  const bool littleEndian = tiff[0] == 'I' && tiff[1] == 'I';
+  if (!littleEndian && !(tiff[0] == 'M' && tiff[1] == 'M'))
+    return 0;
+
+  const auto read16 = [tiff, littleEndian](size_t pos) -> unsigned int
+  { return littleEndian ? tiff[pos] | tiff[pos + 1] << 8 : tiff[pos] << 8 | tiff[pos + 1]; };
+  const auto read32 = [&read16, littleEndian](size_t pos) -> size_t
+  {
+    return littleEndian ? read16(pos) | static_cast<size_t>(read16(pos + 2)) << 16
+                        : static_cast<size_t>(read16(pos)) << 16 | read16(pos + 2);
+  };
+
+  const size_t ifd = read32(4);
+  if (ifd + 2 > tiffSize)
+    return 0;
+  const unsigned int entries = read16(ifd);
+  for (unsigned int i = 0; i < entries && ifd + 2 + (i + 1) * 12 <= tiffSize; ++i)
+  {
+    const size_t entry = ifd + 2 + i * 12;
+    if (read16(entry) == 0x0112) // orientation, a SHORT stored in the value field
+      return read16(entry + 8);
+  }
+  return 0;
+}
+} // namespace
+
 CFFmpegImage::CFFmpegImage(const std::string& strMimeType) : m_strMimeType(strMimeType)
 {
   m_hasAlpha = false;
@@ -279,6 +317,24 @@ bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
     return false;
   }
 
+  // let the DCT skip what would be scaled away later, decoding at 1/2, 1/4 or 1/8 resolution
+  if (codec && codec->id == AV_CODEC_ID_MJPEG && m_decodeWidth > 0 && m_decodeHeight > 0)
+  {
+    unsigned int width = 0;
+    unsigned int height = 0;
+    unsigned int orientation = 0;
+    if (GetJpegSize(buffer, bufSize, width, height, orientation))
+    {
+      // orientations 5-8 turn the image by 90 degrees once decoded
+      const bool turned = orientation >= 5 && orientation <= 8;
+      m_codec_ctx->lowres =
+          GetDecodeLowres(width, height, turned ? m_decodeHeight : m_decodeWidth,
+                          turned ? m_decodeWidth : m_decodeHeight, codec->max_lowres);
+      m_originalWidth = width;
+      m_originalHeight = height;
+    }
+  }
+
   if (avcodec_open2(m_codec_ctx, codec, NULL) < 0)
   {
     avformat_close_input(&m_fctx);
@@ -337,8 +393,12 @@ AVFrame* CFFmpegImage::ExtractFrame()
 
   m_height = frame->height;
   m_width = frame->width;
-  m_originalWidth = m_width;
-  m_originalHeight = m_height;
+  // when decoded at a reduced resolution the source size was taken from the header
+  if (m_codec_ctx->lowres == 0)
+  {
+    m_originalWidth = m_width;
+    m_originalHeight = m_height;
+  }
 
   const AVPixFmtDescriptor* pixDescriptor = av_pix_fmt_desc_get(static_cast<AVPixelFormat>(frame->format));
   if (pixDescriptor && ((pixDescriptor->flags & (AV_PIX_FMT_FLAG_ALPHA | AV_PIX_FMT_FLAG_PAL)) != 0))
@@ -566,6 +626,95 @@ void CFFmpegImage::SetColorMetadata(const ImageColorMetadata& color)
   m_color = color;
 }
 
+void CFFmpegImage::SetDecodeSize(unsigned int width, unsigned int height)
+{
+  m_decodeWidth = width;
+  m_decodeHeight = height;
+}
+
+bool CFFmpegImage::GetJpegSize(const uint8_t* buffer,
+                               size_t bufSize,
+                               unsigned int& width,
+                               unsigned int& height,
+                               unsigned int& orientation)
+{
+  if (bufSize < 4 || buffer[0] != 0xFF || buffer[1] != 0xD8)
+    return false;
+
+  orientation = 0;
+
+  size_t pos = 2;
+  while (pos + 4 <= bufSize)
+  {
+    if (buffer[pos] != 0xFF)
+      return false;
+
+    const uint8_t marker = buffer[pos + 1];
+    if (marker == 0xFF) // fill byte
+    {
+      pos++;
+      continue;
+    }
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) // TEM and RSTn carry no length
+    {
+      pos += 2;
+      continue;
+    }
+
+    // SOF0-2 are the Huffman coded DCT frames, other frame types can't be decoded at lowres
+    if (marker >= 0xC0 && marker <= 0xC2)
+    {
+      if (pos + 9 > bufSize)
+        return false;
+      height = (buffer[pos + 5] << 8) | buffer[pos + 6];
+      width = (buffer[pos + 7] << 8) | buffer[pos + 8];
+      return width > 0 && height > 0;
+    }
+    const bool otherFrame = marker >= 0xC3 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 &&
+                            marker != 0xCC;
+    if (otherFrame || marker == 0xD9 || marker == 0xDA)
+      return false;
+
+    const size_t length = (buffer[pos + 2] << 8) | buffer[pos + 3];
+    if (length < 2)
+      return false;
+    if (marker == 0xE1 && orientation == 0 && pos + 2 + length <= bufSize)
+      orientation = GetExifOrientation(buffer + pos + 4, length - 2);
+    pos += 2 + length;
+  }
+  return false;
+}
+
+int CFFmpegImage::GetDecodeLowres(unsigned int width,
+                                  unsigned int height,
+                                  unsigned int decodeWidth,
+                                  unsigned int decodeHeight,
+                                  int maxLowres)
+{
+  if (width == 0 || height == 0 || decodeWidth == 0 || decodeHeight == 0)
+    return 0;
+
+  // whether a reduced image still holds the image fit into the box, in integers as the decoder
+  // rounds the reduced size up
+  const auto covers = [=](uint64_t reducedWidth, uint64_t reducedHeight)
+  {
+    return (reducedWidth >= decodeWidth ||
+            reducedWidth * height >= static_cast<uint64_t>(decodeHeight) * width) &&
+           (reducedHeight >= decodeHeight ||
+            reducedHeight * width >= static_cast<uint64_t>(decodeWidth) * height);
+  };
+
+  int lowres = 0;
+  while (lowres < std::min(maxLowres, 3))
+  {
+    const unsigned int divisor = 1u << (lowres + 1);
+    if (!covers((width + divisor - 1) / divisor, (height + divisor - 1) / divisor))
+      break;
+    lowres++;
+  }
+  return lowres;
+}
+
 bool CFFmpegImage::CreateThumbnailFromSurface(unsigned char* bufferin, unsigned int width,
                                              unsigned int height, unsigned int format,
                                              unsigned int pitch,
@@ -71,11 +71,33 @@ public:
                                   unsigned int &bufferoutSize) override;
   void ReleaseThumbnailBuffer() override;
   void SetColorMetadata(const ImageColorMetadata& color) override;
+  void SetDecodeSize(unsigned int width, unsigned int height) override;
 
   bool Initialize(unsigned char* buffer, size_t bufSize);
 
   std::shared_ptr<Frame> ReadFrame();
 
+  /*!
+   \brief Read the dimensions from the frame header of a baseline or progressive JPEG file,
+          and the EXIF orientation if it precedes the frame header (0 if not).
+   \return false if the buffer holds no such JPEG or the header could not be found
+   */
+  static bool GetJpegSize(const uint8_t* buffer,
+                          size_t bufSize,
+                          unsigned int& width,
+                          unsigned int& height,
+                          unsigned int& orientation);
+
+  /*!
+   \brief The lowres level (decoding at 1/2^lowres) at which a width x height image still covers
+          decodeWidth x decodeHeight when fit inside it.
+   */
+  static int GetDecodeLowres(unsigned int width,
+                             unsigned int height,
+                             unsigned int decodeWidth,
+                             unsigned int decodeHeight,
+                             int maxLowres);
+
 private:
   static void FreeIOCtx(AVIOContext** ioctx);
   AVFrame* ExtractFrame();
@@ -89,6 +111,10 @@ private:
   // CICP color metadata for the encoded output (fields default to unset).
   ImageColorMetadata m_color;
 
+  // size hint from SetDecodeSize, 0 decodes at full resolution
+  unsigned int m_decodeWidth = 0;
+  unsigned int m_decodeHeight = 0;
+
   MemBuffer m_buf;
 
   AVIOContext* m_ioctx = nullptr;
@@ -11,10 +11,13 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "GUIInfoManager.h"
+#include "GUILargeTextureManager.h"
 #include "GUIListItemLayout.h"
 #include "GUIMessage.h"
 #include "ServiceBroker.h"
+#include "guilib/GUIComponent.h"
 #include "guilib/GUIListItem.h"
+#include "guilib/VirtualItemList.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
 #include "guilib/listproviders/IListProvider.h"
 #include "input/actions/Action.h"
@@ -176,6 +179,9 @@ void CGUIBaseContainer::Process(unsigned int currentTime, CDirtyRegionList &dirt
   int cacheBefore, cacheAfter;
   GetCacheOffsets(cacheBefore, cacheAfter);
 
+  UpdateVirtualItems(CorrectOffset(offset - cacheBefore, 0),
+                     CorrectOffset(offset + m_itemsPerPage + 1 + cacheAfter, 0));
+
   // Free memory not used on screen
   if ((int)m_items.size() > m_itemsPerPage + cacheBefore + cacheAfter)
     FreeMemory(CorrectOffset(offset - cacheBefore, 0), CorrectOffset(offset + m_itemsPerPage + 1 + cacheAfter, 0));
@@ -233,6 +239,20 @@ void CGUIBaseContainer::ProcessItem(float posX,
 {
   if (!m_focusedLayout || !m_layout) return;
 
+  // items outside of the viewport are only processed to preload their images, which should
+  // wait for the ones on screen
+  CGUIComponent* gui = CServiceBroker::GetGUI();
+  bool requestsOffscreen = false;
+  if (gui)
+  {
+    const float itemPos = m_orientation == VERTICAL ? posY : posX;
+    const float itemSize = (focused ? m_focusedLayout : m_layout)->Size(m_orientation);
+    const float viewStart = m_orientation == VERTICAL ? m_posY : m_posX;
+    const float viewEnd = viewStart + (m_orientation == VERTICAL ? m_height : m_width);
+    const bool offscreen = itemPos + itemSize <= viewStart || itemPos >= viewEnd;
+    requestsOffscreen = gui->GetLargeTextureManager().SetRequestsOffscreen(offscreen);
+  }
+
   // set the origin
   CServiceBroker::GetWinSystem()->GetGfxContext().SetOrigin(posX, posY);
 
@@ -278,6 +298,9 @@ void CGUIBaseContainer::ProcessItem(float posX,
   }
 
   CServiceBroker::GetWinSystem()->GetGfxContext().RestoreOrigin();
+
+  if (gui)
+    gui->GetLargeTextureManager().SetRequestsOffscreen(requestsOffscreen);
 }
 
 void CGUIBaseContainer::Render()
@@ -525,8 +548,16 @@ bool CGUIBaseContainer::OnMessage(CGUIMessage& message)
       { // bind our items
         Reset();
         CFileItemList *items = static_cast<CFileItemList*>(message.GetPointer());
-        for (int i = 0; i < items->Size(); i++)
-          m_items.push_back(items->Get(i));
+        if (items->GetVirtualItems())
+        {
+          m_virtualItems = items->GetVirtualItems();
+          m_items.assign(m_virtualItems->Size(), m_virtualItems->GetPlaceholder());
+        }
+        else
+        {
+          for (int i = 0; i < items->Size(); i++)
+            m_items.push_back(items->Get(i));
+        }
         UpdateLayout(true); // true to refresh all items
         UpdateScrollByLetter();
         SelectItem(message.GetParam1());
@@ -787,14 +818,18 @@ std::shared_ptr<CGUIListItem> CGUIBaseContainer::GetListItem(int offset, unsigne
   {
     item %= ((int)m_items.size());
     if (item < 0) item += m_items.size();
-    return m_items[item];
   }
-  else
+  else if (item < 0 || item >= (int)m_items.size())
+    return std::shared_ptr<CGUIListItem>();
+
+  // items out of the window may be asked for by skins, hand them out if they are loaded already,
+  // rendering doesn't wait for the source
+  if (m_virtualItems && m_items[item] == m_virtualItems->GetPlaceholder())
   {
-    if (item >= 0 && item < (int)m_items.size())
-      return m_items[item];
+    if (const auto fileItem = m_virtualItems->GetIfLoaded(item))
+      return fileItem;
   }
-  return std::shared_ptr<CGUIListItem>();
+  return m_items[item];
 }
 
 CGUIListItemLayout *CGUIBaseContainer::GetFocusedLayout() const
@@ -1333,6 +1368,10 @@ void CGUIBaseContainer::Reset()
 {
   m_wasReset = true;
   m_items.clear();
+  m_virtualItems.reset();
+  m_virtualSlots.clear();
+  m_virtualWindow = {-1, -1};
+  m_virtualGeneration = 0;
   m_lastItem.reset();
   ResetAutoScrolling();
   m_lastPageControlOffset.reset();
@@ -1395,6 +1434,76 @@ void CGUIBaseContainer::FreeMemory(int keepStart, int keepEnd)
   }
 }
 
+void CGUIBaseContainer::UpdateVirtualItems(int keepStart, int keepEnd)
+{
+  if (!m_virtualItems || m_items.empty())
+    return;
+
+  const int size = static_cast<int>(m_items.size());
+  keepStart = std::clamp(keepStart, 0, size - 1);
+  keepEnd = std::clamp(keepEnd, 0, size - 1);
+  const unsigned int generation = m_virtualItems->GetGeneration();
+  const bool moved = m_virtualWindow != std::make_pair(keepStart, keepEnd);
+  if (!moved && m_virtualGeneration == generation)
+    return;
+  m_virtualWindow = {keepStart, keepEnd};
+  m_virtualGeneration = generation;
+
+  const auto inWindow = [keepStart, keepEnd](int item)
+  {
+    if (keepStart <= keepEnd)
+      return item >= keepStart && item <= keepEnd;
+    return item >= keepStart || item <= keepEnd; // wrapping
+  };
+
+  // hand back the items that left the window, the virtual list keeps those still paged in
+  const std::shared_ptr<CGUIListItem> placeholder = m_virtualItems->GetPlaceholder();
+  std::erase_if(m_virtualSlots,
+                [&](int item)
+                {
+                  if (inWindow(item))
+                    return false;
+                  m_items[item]->FreeMemory();
+                  m_items[item] = placeholder;
+                  return true;
+                });
+
+  if (moved)
+  {
+    // the list loads a single range, the longer part of a wrapping window
+    if (keepStart <= keepEnd)
+      m_virtualItems->SetVisibleRange(keepStart, keepEnd);
+    else if (size - keepStart > keepEnd + 1)
+      m_virtualItems->SetVisibleRange(keepStart, size - 1);
+    else
+      m_virtualItems->SetVisibleRange(0, keepEnd);
+  }
+
+  // items not loaded yet keep the placeholder, they are picked up once the generation changes
+  const auto materialize = [&](int first, int last)
+  {
+    for (int item = first; item <= last; ++item)
+    {
+      if (m_items[item] != placeholder)
+        continue;
+      if (const auto fileItem = m_virtualItems->GetIfLoaded(item))
+      {
+        m_items[item] = fileItem;
+        m_virtualSlots.push_back(item);
+        SetInvalid();
+      }
+    }
+  };
+
+  if (keepStart <= keepEnd)
+    materialize(keepStart, keepEnd);
+  else
+  {
+    materialize(0, keepEnd);
+    materialize(keepStart, size - 1);
+  }
+}
+
 bool CGUIBaseContainer::InsideLayout(const CGUIListItemLayout *layout, const CPoint &point) const
 {
   if (!layout) return false;
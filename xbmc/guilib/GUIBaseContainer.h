@@ -32,6 +32,7 @@ class IListProvider;
 class TiXmlElement;
 class TiXmlNode;
 class CGUIListItemLayout;
+class CVirtualItemList;
 
 class CGUIBaseContainer : public IGUIContainer
 {
@@ -137,6 +138,11 @@ protected:
   int ScrollCorrectionRange() const;
   inline float Size() const;
   void FreeMemory(int keepStart, int keepEnd);
+  /*! \brief Materialize the virtual items in the window, handing back those that left it.
+   \param keepStart the first item in the window.
+   \param keepEnd the last item in the window, before keepStart when wrapping.
+   */
+  void UpdateVirtualItems(int keepStart, int keepEnd);
   void GetCurrentLayouts();
   CGUIListItemLayout *GetFocusedLayout() const;
 
@@ -152,6 +158,12 @@ protected:
   typedef std::vector<std::shared_ptr<CGUIListItem>>::iterator iItems;
   std::shared_ptr<CGUIListItem> m_lastItem;
 
+  // items bound from a virtual list hold its placeholder until they are in the window
+  std::shared_ptr<CVirtualItemList> m_virtualItems;
+  std::vector<int> m_virtualSlots; ///< items materialized from m_virtualItems
+  std::pair<int, int> m_virtualWindow{-1, -1};
+  unsigned int m_virtualGeneration{0}; ///< CVirtualItemList::GetGeneration() last picked up
+
   int m_pageControl;
   std::optional<int>
       m_lastPageControlOffset; // cached offset to avoid redundant page control messages
@@ -113,14 +113,17 @@ struct CGUIFontCacheHash
 {
   size_t operator()(const CGUIFontCacheKey<Position>& key) const
   {
-    /* Not much effort has gone into choosing this hash function */
-    size_t hash = 0, i;
-    for (i = 0; i < 3 && i < key.m_text.size(); ++i)
-      hash += key.m_text[i];
+    // FNV-1a over the whole text, the labels of a list tend to share their first characters
+    uint64_t hash = 14695981039346656037ULL;
+    for (const character_t ch : key.m_text)
+    {
+      hash ^= ch;
+      hash *= 1099511628211ULL;
+    }
     if (key.m_colors.size())
       hash += key.m_colors[0];
     hash += static_cast<size_t>(MatrixHashContribution(key)); // horrible
-    return hash;
+    return static_cast<size_t>(hash);
   }
 };
 
@@ -0,0 +1,142 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+/*!
+\file GUIFontShapeCache.h
+\brief
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+typedef uint32_t character_t;
+
+/*!
+ \brief Least recently used cache of the results of shaping a text with a font.
+
+ Unlike the vertex caches of CGUIFontCache, entries are keyed on the text and its style only:
+ the color bits of the characters are ignored, as are position, scale and scrolling. The same
+ label drawn focused and unfocused, at any offset of a scrolling list, is thus shaped once.
+
+ Not thread safe, like the rest of the font.
+ */
+template<class Value>
+class CGUIFontShapeCache
+{
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 2048;
+
+  explicit CGUIFontShapeCache(size_t capacity = DEFAULT_CAPACITY)
+    : m_capacity(std::max<size_t>(capacity, 1))
+  {
+  }
+
+  CGUIFontShapeCache(const CGUIFontShapeCache&) = delete;
+  CGUIFontShapeCache& operator=(const CGUIFontShapeCache&) = delete;
+
+  /*! \brief Look up the value of a text, making it the most recently used one.
+   \return the value, nullptr if the text isn't cached.
+   */
+  Value* Find(std::span<const character_t> text)
+  {
+    const auto it = m_index.find(text);
+    if (it == m_index.end())
+    {
+      ++m_misses;
+      return nullptr;
+    }
+
+    ++m_hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return &it->second->m_value;
+  }
+
+  /*! \brief Cache the value of a text not cached yet, evicting the least recently used one if
+   the cache is full.
+   \return the cached value, valid until the next call to Insert() or Clear().
+   */
+  Value& Insert(std::span<const character_t> text, Value value)
+  {
+    if (m_index.size() >= m_capacity)
+    {
+      m_index.erase(std::span<const character_t>(m_entries.back().m_text));
+      m_entries.pop_back();
+    }
+
+    Entry& entry = m_entries.emplace_front();
+    entry.m_text.reserve(text.size());
+    std::ranges::transform(text, std::back_inserter(entry.m_text), Normalize);
+    entry.m_value = std::move(value);
+    m_index.emplace(std::span<const character_t>(entry.m_text), m_entries.begin());
+    return entry.m_value;
+  }
+
+  void Clear()
+  {
+    m_index.clear();
+    m_entries.clear();
+  }
+
+  size_t Size() const { return m_index.size(); }
+  uint64_t GetHits() const { return m_hits; }
+  uint64_t GetMisses() const { return m_misses; }
+
+private:
+  // the color index of a character does not change its shape
+  static constexpr character_t COLOR_MASK = 0x00ff0000;
+
+  static character_t Normalize(character_t ch) { return ch & ~COLOR_MASK; }
+
+  struct Hash
+  {
+    size_t operator()(std::span<const character_t> text) const
+    {
+      // FNV-1a, labels of a list tend to share their first characters
+      uint64_t hash = 14695981039346656037ULL;
+      for (const character_t ch : text)
+      {
+        hash ^= Normalize(ch);
+        hash *= 1099511628211ULL;
+      }
+      return static_cast<size_t>(hash);
+    }
+  };
+
+  struct Equal
+  {
+    bool operator()(std::span<const character_t> a, std::span<const character_t> b) const
+    {
+      return std::ranges::equal(a, b, {}, Normalize, Normalize);
+    }
+  };
+
+  struct Entry
+  {
+    std::vector<character_t> m_text; ///< normalized, referenced by the index
+    Value m_value;
+  };
+
+  size_t m_capacity;
+  std::list<Entry> m_entries; ///< most recently used first
+  std::unordered_map<std::span<const character_t>,
+                     typename std::list<Entry>::iterator,
+                     Hash,
+                     Equal>
+      m_index;
+  uint64_t m_hits{0};
+  uint64_t m_misses{0};
+};
@@ -9,6 +9,7 @@
 #include "GUIFontTTF.h"
 
 #include "GUIFontManager.h"
+#include "GUIFrameProfiler.h"
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "URL.h"
@@ -243,6 +244,7 @@ void CGUIFontTTF::Clear()
   m_posY = 0;
   m_nestedBeginCount = 0;
 
+  m_shapeCache.Clear();
   if (m_hbFont)
     hb_font_destroy(m_hbFont);
   m_hbFont = nullptr;
@@ -271,6 +273,7 @@ bool CGUIFontTTF::Load(
   m_hbFont = hb_ft_font_create(m_face, 0);
   if (!m_hbFont)
     return false;
+  m_shapeCache.Clear();
   /*
    the values used are described below
 
@@ -426,6 +429,8 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
 
   if (dirtyCache)
   {
+    GUIPROFILER_SCOPE("CGUIFontTTF::DrawTextInternal cache miss", "font");
+
     // Try to validate any conflicting alignments
     //! @todo: This validate is the last resort and can result in a bad rendered text
     //! because the alignment it is used also by caller components for other operations
@@ -433,7 +438,7 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
     //! by add validating alignments from each parent caller component
     ValidateAlignments(alignment);
 
-    const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
+    const std::vector<Glyph>& glyphs = GetShapedText(text).m_glyphs;
     m_originX = 0;
     m_originY = 0;
 
@@ -714,8 +719,10 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
 
 float CGUIFontTTF::GetTextWidthInternal(std::span<const character_t> text)
 {
-  const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
-  return GetTextWidthInternal(text, glyphs);
+  ShapedText& shaped = GetShapedText(text);
+  if (shaped.m_width < 0.0f)
+    shaped.m_width = GetTextWidthInternal(text, shaped.m_glyphs);
+  return shaped.m_width;
 }
 
 // this routine assumes a single line (i.e. it was called from GUITextLayout)
@@ -781,6 +788,15 @@ unsigned int CGUIFontTTF::GetMaxFontHeight() const
   return m_maxFontHeight + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
 }
 
+CGUIFontTTF::ShapedText& CGUIFontTTF::GetShapedText(std::span<const character_t> text)
+{
+  if (ShapedText* shaped = m_shapeCache.Find(text))
+    return *shaped;
+
+  GUIPROFILER_SCOPE("CGUIFontTTF::GetShapedText miss", "font");
+  return m_shapeCache.Insert(text, {GetHarfBuzzShapedGlyphs(text)});
+}
+
 std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::GetHarfBuzzShapedGlyphs(
     std::span<const character_t> text)
 {
@@ -71,6 +71,7 @@ struct SVertex
 #endif
 
 #include "GUIFontCache.h"
+#include "GUIFontShapeCache.h"
 
 
 class CGUIFontTTF
@@ -134,6 +135,12 @@ protected:
     character_t m_glyphAndStyle;
   };
 
+  struct ShapedText
+  {
+    std::vector<Glyph> m_glyphs;
+    float m_width{-1.0f}; ///< width of the single line text, negative until measured
+  };
+
   struct RunInfo
   {
     unsigned int m_startOffset;
@@ -149,6 +156,11 @@ protected:
 
   std::vector<Glyph> GetHarfBuzzShapedGlyphs(std::span<const character_t> text);
 
+  /*! \brief Get the shaped glyphs of a text from the shape cache, shaping it on a miss.
+   \return the text, valid until the next text is shaped.
+   */
+  ShapedText& GetShapedText(std::span<const character_t> text);
+
   float GetTextWidthInternal(std::span<const character_t> text);
   float GetTextWidthInternal(std::span<const character_t> text, const std::vector<Glyph>& glyph);
   float GetCharWidthInternal(character_t ch);
@@ -274,6 +286,7 @@ protected:
 
   CGUIFontCache<CGUIFontCacheStaticPosition, CGUIFontCacheStaticValue> m_staticCache;
   CGUIFontCache<CGUIFontCacheDynamicPosition, CGUIFontCacheDynamicValue> m_dynamicCache;
+  CGUIFontShapeCache<ShapedText> m_shapeCache;
 
   CRenderSystemBase* m_renderSystem;
 
@@ -0,0 +1,189 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameProfiler.h"
+
+#include "filesystem/File.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+std::atomic_bool CGUIFrameProfiler::m_enabled{false};
+
+namespace
+{
+constexpr int PROCESS_ID = 1;
+
+double ToMicroseconds(int64_t nanoseconds)
+{
+  return static_cast<double>(nanoseconds) / 1000.0;
+}
+} // namespace
+
+CGUIFrameProfiler& CGUIFrameProfiler::GetInstance()
+{
+  static CGUIFrameProfiler profiler;
+  return profiler;
+}
+
+void CGUIFrameProfiler::Start(size_t eventsPerThread /* = DEFAULT_EVENTS_PER_THREAD */)
+{
+  std::unique_lock lock(m_section);
+  // threads still holding a buffer of the last session pick up a new one with their next event
+  ++m_session;
+  m_buffers.clear();
+  m_eventsPerThread = std::clamp<size_t>(eventsPerThread, 1, MAX_EVENTS_PER_THREAD);
+  m_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+                .count();
+  m_nextThreadId = 1;
+  m_enabled = true;
+  CLog::Log(LOGINFO, "CGUIFrameProfiler: started, keeping {} events per thread",
+            m_eventsPerThread);
+}
+
+void CGUIFrameProfiler::Stop()
+{
+  m_enabled = false;
+  CLog::Log(LOGINFO, "CGUIFrameProfiler: stopped, {} events recorded", GetEventCount());
+}
+
+void CGUIFrameProfiler::RecordDuration(const char* name,
+                                       const char* category,
+                                       Clock::time_point start,
+                                       Clock::time_point end)
+{
+  const int64_t startNs = ToNanoseconds(start);
+  Record({name, category, startNs, ToNanoseconds(end) - startNs, EventType::DURATION});
+}
+
+void CGUIFrameProfiler::RecordCounter(const char* name, int64_t value)
+{
+  if (!IsEnabled())
+    return;
+
+  Record({name, "counter", ToNanoseconds(Clock::now()), value, EventType::COUNTER});
+}
+
+void CGUIFrameProfiler::EndFrame()
+{
+  if (!IsEnabled())
+    return;
+
+  Record({"frame", "gui", ToNanoseconds(Clock::now()), 0, EventType::INSTANT});
+}
+
+void CGUIFrameProfiler::GetChromeTrace(CVariant& trace) const
+{
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  {
+    std::unique_lock lock(m_section);
+    buffers = m_buffers;
+  }
+
+  trace = CVariant(CVariant::VariantTypeObject);
+  trace["displayTimeUnit"] = "ms";
+  CVariant& events = trace["traceEvents"];
+  events = CVariant(CVariant::VariantTypeArray);
+
+  for (const auto& buffer : buffers)
+  {
+    std::unique_lock lock(buffer->section);
+    const size_t capacity = buffer->events.size();
+    for (size_t i = 0; i < buffer->count; ++i)
+    {
+      const Event& event = buffer->events[(buffer->next + capacity - buffer->count + i) % capacity];
+
+      CVariant traceEvent(CVariant::VariantTypeObject);
+      traceEvent["name"] = event.name;
+      traceEvent["cat"] = event.category;
+      traceEvent["ts"] = ToMicroseconds(event.start);
+      traceEvent["pid"] = PROCESS_ID;
+      traceEvent["tid"] = buffer->threadId;
+      switch (event.type)
+      {
+        case EventType::DURATION:
+          traceEvent["ph"] = "X";
+          traceEvent["dur"] = ToMicroseconds(event.value);
+          break;
+        case EventType::COUNTER:
+          traceEvent["ph"] = "C";
+          traceEvent["args"]["value"] = event.value;
+          break;
+        case EventType::INSTANT:
+          traceEvent["ph"] = "i";
+          traceEvent["s"] = "p";
+          break;
+      }
+      events.push_back(std::move(traceEvent));
+    }
+  }
+}
+
+bool CGUIFrameProfiler::SaveChromeTrace(const std::string& path) const
+{
+  CVariant trace;
+  GetChromeTrace(trace);
+
+  std::string json;
+  if (!CJSONVariantWriter::Write(trace, json, true))
+    return false;
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(json.data(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::Log(LOGERROR, "CGUIFrameProfiler: failed to write {}", path);
+    return false;
+  }
+  return true;
+}
+
+size_t CGUIFrameProfiler::GetEventCount() const
+{
+  std::unique_lock lock(m_section);
+  size_t count = 0;
+  for (const auto& buffer : m_buffers)
+  {
+    std::unique_lock bufferLock(buffer->section);
+    count += buffer->count;
+  }
+  return count;
+}
+
+void CGUIFrameProfiler::Record(const Event& event)
+{
+  ThreadBuffer& buffer = GetThreadBuffer();
+  std::unique_lock lock(buffer.section);
+  buffer.events[buffer.next] = event;
+  buffer.next = (buffer.next + 1) % buffer.events.size();
+  buffer.count = std::min(buffer.count + 1, buffer.events.size());
+}
+
+CGUIFrameProfiler::ThreadBuffer& CGUIFrameProfiler::GetThreadBuffer()
+{
+  thread_local std::shared_ptr<ThreadBuffer> buffer;
+  thread_local unsigned int session = 0;
+
+  if (!buffer || session != m_session)
+  {
+    std::unique_lock lock(m_section);
+    buffer = std::make_shared<ThreadBuffer>(m_nextThreadId++, m_eventsPerThread);
+    session = m_session;
+    m_buffers.emplace_back(buffer);
+  }
+  return *buffer;
+}
+
+int64_t CGUIFrameProfiler::ToNanoseconds(Clock::time_point time) const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count() -
+         m_epoch;
+}
@@ -0,0 +1,165 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class CVariant;
+
+/*!
+ \brief Continuous, low overhead profiler of the work done per frame.
+
+ Scoped timers (see GUIPROFILER_SCOPE) and counters are recorded into a ring buffer per thread,
+ keeping the latest events only. The events can be exported in the Chrome trace event format,
+ to be loaded into chrome://tracing or Perfetto.
+
+ While disabled, a timer costs a single relaxed atomic load.
+ */
+class CGUIFrameProfiler
+{
+public:
+  static constexpr size_t DEFAULT_EVENTS_PER_THREAD = 65536;
+  // 40 MiB per thread
+  static constexpr size_t MAX_EVENTS_PER_THREAD = 1048576;
+
+  static CGUIFrameProfiler& GetInstance();
+
+  static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+  /*! \brief Start recording, dropping the events recorded before.
+   \param eventsPerThread the number of latest events kept per thread, at most
+   MAX_EVENTS_PER_THREAD.
+   */
+  void Start(size_t eventsPerThread = DEFAULT_EVENTS_PER_THREAD);
+  void Stop();
+
+  using Clock = std::chrono::steady_clock;
+
+  /*! \brief Record a completed timer.
+   \param name the name of the timer, has to outlive the profiler (string literal).
+   \param category the category of the timer, has to outlive the profiler (string literal).
+   */
+  void RecordDuration(const char* name,
+                      const char* category,
+                      Clock::time_point start,
+                      Clock::time_point end);
+
+  /*! \brief Record the value of a counter.
+   \param name the name of the counter, has to outlive the profiler (string literal).
+   */
+  void RecordCounter(const char* name, int64_t value);
+
+  /*! \brief Mark the end of a frame.
+   */
+  void EndFrame();
+
+  /*! \brief Get the recorded events in the Chrome trace event format.
+   \param trace the object holding the events in "traceEvents".
+   */
+  void GetChromeTrace(CVariant& trace) const;
+
+  /*! \brief Write the recorded events in the Chrome trace event format.
+   \param path the file to write.
+   \return true on success, false otherwise.
+   */
+  bool SaveChromeTrace(const std::string& path) const;
+
+  size_t GetEventCount() const;
+
+private:
+  CGUIFrameProfiler() = default;
+  ~CGUIFrameProfiler() = default;
+  CGUIFrameProfiler(const CGUIFrameProfiler&) = delete;
+  CGUIFrameProfiler& operator=(const CGUIFrameProfiler&) = delete;
+
+  enum class EventType : uint8_t
+  {
+    DURATION,
+    COUNTER,
+    INSTANT,
+  };
+
+  struct Event
+  {
+    const char* name;
+    const char* category;
+    int64_t start; ///< ns since the profiler was started
+    int64_t value; ///< duration in ns, or the value of a counter
+    EventType type;
+  };
+
+  // only written by its thread, the lock is uncontended unless the events are exported
+  struct ThreadBuffer
+  {
+    ThreadBuffer(int id, size_t capacity) : threadId(id), events(capacity) {}
+
+    const int threadId;
+    mutable CCriticalSection section;
+    std::vector<Event> events;
+    size_t next{0};
+    size_t count{0};
+  };
+
+  void Record(const Event& event);
+  ThreadBuffer& GetThreadBuffer();
+  int64_t ToNanoseconds(Clock::time_point time) const;
+
+  static std::atomic_bool m_enabled;
+
+  mutable CCriticalSection m_section;
+  std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+  std::atomic<unsigned int> m_session{0};
+  size_t m_eventsPerThread{DEFAULT_EVENTS_PER_THREAD};
+  std::atomic<int64_t> m_epoch{0}; ///< start of the session, ns since the clock's epoch
+  int m_nextThreadId{1};
+};
+
+/*!
+ \brief Times the enclosing scope, if the frame profiler is enabled.
+ */
+class CGUIProfileScope
+{
+public:
+  CGUIProfileScope(const char* name, const char* category) : m_name(name), m_category(category)
+  {
+    if (CGUIFrameProfiler::IsEnabled())
+    {
+      m_active = true;
+      m_start = CGUIFrameProfiler::Clock::now();
+    }
+  }
+
+  ~CGUIProfileScope()
+  {
+    if (m_active)
+      CGUIFrameProfiler::GetInstance().RecordDuration(m_name, m_category, m_start,
+                                                      CGUIFrameProfiler::Clock::now());
+  }
+
+  CGUIProfileScope(const CGUIProfileScope&) = delete;
+  CGUIProfileScope& operator=(const CGUIProfileScope&) = delete;
+
+private:
+  const char* m_name;
+  const char* m_category;
+  bool m_active{false};
+  CGUIFrameProfiler::Clock::time_point m_start;
+};
+
+#define GUIPROFILER_CONCAT_INNER(a, b) a##b
+#define GUIPROFILER_CONCAT(a, b) GUIPROFILER_CONCAT_INNER(a, b)
+#define GUIPROFILER_SCOPE(name, category) \
+  CGUIProfileScope GUIPROFILER_CONCAT(guiProfileScope, __LINE__)(name, category)
@@ -10,6 +10,7 @@
 
 #include "GUIAudioManager.h"
 #include "GUIDialog.h"
+#include "GUIFrameProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIPassword.h"
 #include "GUITexture.h"
@@ -1263,6 +1264,7 @@ bool RenderOrderSortFunction(const std::shared_ptr<CGUIWindow>& first,
 void CGUIWindowManager::Process(unsigned int currentTime)
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
+  GUIPROFILER_SCOPE("CGUIWindowManager::Process", "gui");
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
   m_dirtyregions.clear();
@@ -1404,6 +1406,7 @@ void CGUIWindowManager::RenderEx() const
 bool CGUIWindowManager::Render()
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
+  GUIPROFILER_SCOPE("CGUIWindowManager::Render", "gui");
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
   int bufferAge = CServiceBroker::GetWinSystem()->GetBufferAge();
@@ -135,11 +135,13 @@ std::unique_ptr<CTexture> CTexture::LoadFromFileInMemory(unsigned char* buffer,
                                                          const std::string& mimeType,
                                                          unsigned int idealWidth,
                                                          unsigned int idealHeight,
-                                                         CAspectRatio::AspectRatio aspectRatio)
+                                                         CAspectRatio::AspectRatio aspectRatio,
+                                                         unsigned int decodeWidth,
+                                                         unsigned int decodeHeight)
 {
   std::unique_ptr<CTexture> texture = CTexture::CreateTexture();
   if (texture->LoadFromFileInMem(buffer, bufferSize, mimeType, idealWidth, idealHeight,
-                                 aspectRatio))
+                                 aspectRatio, decodeWidth, decodeHeight))
     return texture;
   return {};
 }
@@ -153,12 +155,25 @@ bool CTexture::LoadFromFileInternal(const std::string& texturePath,
   if (URIUtils::HasExtension(texturePath, ".dds"))
   { // special case for DDS images
     CDDSImage image;
-    if (image.ReadFile(texturePath))
+    if (!image.ReadFile(texturePath))
+      return false;
+
+    // compressed blocks are uploaded as is
+    switch (image.GetFormat())
     {
-      Update(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(), image.GetData(), false);
-      return true;
+      case XB_FMT_DXT1:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGB8, KD_TEX_ALPHA_OPAQUE, KD_TEX_SWIZ_RGBA);
+      case XB_FMT_DXT3:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGB8_A4, KD_TEX_ALPHA_STRAIGHT, KD_TEX_SWIZ_RGBA);
+      case XB_FMT_DXT5:
+        return UploadFromMemory(image.GetWidth(), image.GetHeight(), 0, image.GetData(),
+                                KD_TEX_FMT_S3TC_RGBA8, KD_TEX_ALPHA_STRAIGHT, KD_TEX_SWIZ_RGBA);
+      default:
+        Update(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(), image.GetData(), false);
+        return true;
     }
-    return false;
   }
 
   // Read image into memory to use our vfs
@@ -223,13 +238,16 @@ bool CTexture::LoadFromFileInMem(unsigned char* buffer,
                                  const std::string& mimeType,
                                  unsigned int idealWidth,
                                  unsigned int idealHeight,
-                                 CAspectRatio::AspectRatio aspectRatio)
+                                 CAspectRatio::AspectRatio aspectRatio,
+                                 unsigned int decodeWidth,
+                                 unsigned int decodeHeight)
 {
   if (!buffer || !size)
     return false;
 
   IImage* pImage = ImageFactory::CreateLoaderFromMimeType(mimeType);
-  if (!LoadIImage(pImage, buffer, size, idealWidth, idealHeight, aspectRatio))
+  if (!LoadIImage(pImage, buffer, size, idealWidth, idealHeight, aspectRatio, decodeWidth,
+                  decodeHeight))
   {
     delete pImage;
     return false;
@@ -243,12 +261,17 @@ bool CTexture::LoadIImage(IImage* pImage,
                           unsigned int bufSize,
                           unsigned int idealWidth,
                           unsigned int idealHeight,
-                          CAspectRatio::AspectRatio aspectRatio)
+                          CAspectRatio::AspectRatio aspectRatio,
+                          unsigned int decodeWidth,
+                          unsigned int decodeHeight)
 {
   if (pImage == nullptr)
     return false;
 
   unsigned int maxTextureSize = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
+  if (decodeWidth > 0 && decodeHeight > 0)
+    pImage->SetDecodeSize(std::min(decodeWidth, maxTextureSize),
+                          std::min(decodeHeight, maxTextureSize));
   if (!pImage->LoadImageFromMemory(buffer, bufSize, maxTextureSize, maxTextureSize))
     return false;
 
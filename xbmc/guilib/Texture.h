@@ -64,6 +64,9 @@ public:
    \param idealWidth the ideal width of the texture (defaults to 0, no ideal width).
    \param idealHeight the ideal height of the texture (defaults to 0, no ideal height).
    \param aspectRatio the aspect ratio mode of the texture (defaults to "center").
+   \param decodeWidth width of the box the image will later be fit into (defaults to 0, full size).
+   \param decodeHeight height of the box the image will later be fit into (defaults to 0, full size).
+   The loader may decode at a reduced resolution as long as the image still covers that box.
    \return a CTexture std::unique_ptr to the created texture - nullptr if the texture failed to load.
    */
   static std::unique_ptr<CTexture> LoadFromFileInMemory(
@@ -72,7 +75,9 @@ public:
       const std::string& mimeType,
       unsigned int idealWidth = 0,
       unsigned int idealHeight = 0,
-      CAspectRatio::AspectRatio aspectRatio = CAspectRatio::CENTER);
+      CAspectRatio::AspectRatio aspectRatio = CAspectRatio::CENTER,
+      unsigned int decodeWidth = 0,
+      unsigned int decodeHeight = 0);
 
   bool LoadFromMemory(unsigned int width,
                       unsigned int height,
@@ -146,7 +151,9 @@ protected:
                          const std::string& mimeType,
                          unsigned int idealWidth,
                          unsigned int idealHeight,
-                         CAspectRatio::AspectRatio aspectRatio);
+                         CAspectRatio::AspectRatio aspectRatio,
+                         unsigned int decodeWidth = 0,
+                         unsigned int decodeHeight = 0);
   bool LoadFromFileInternal(const std::string& texturePath,
                             unsigned int idealWidth,
                             unsigned int idealHeight,
@@ -157,5 +164,7 @@ protected:
                   unsigned int bufSize,
                   unsigned int idealWidth,
                   unsigned int idealHeight,
-                  CAspectRatio::AspectRatio aspectRatio);
+                  CAspectRatio::AspectRatio aspectRatio,
+                  unsigned int decodeWidth = 0,
+                  unsigned int decodeHeight = 0);
 };
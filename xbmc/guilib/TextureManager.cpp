@@ -8,6 +8,7 @@
 
 #include "TextureManager.h"
 
+#include "GUIFrameProfiler.h"
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "URL.h"
@@ -339,6 +340,8 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
   if (checkBundleOnly && bundle == -1)
     return emptyTexture;
 
+  GUIPROFILER_SCOPE("CGUITextureManager::Load", "texture");
+
   //Lock here, we will do stuff that could break rendering
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
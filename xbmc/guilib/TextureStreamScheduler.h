@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/*!
+ \ingroup textures
+ \brief Orders pending texture loads by on-screen visibility and meters uploads per frame.
+
+ Requests are refreshed every frame they are still wanted. Pop() hands out on-screen requests
+ before off-screen ones and, within each, the most recently refreshed first, so that loads for
+ items a fast scroll has already passed wait behind the ones now in view. Requests refreshed in
+ the same frame keep their queue order.
+
+ Not thread safe, the owner serializes access.
+
+ \sa CGUILargeTextureManager
+ */
+template<typename T>
+class CTextureStreamScheduler
+{
+public:
+  /*!
+   \param uploadLimit bytes that may be uploaded per frame, 0 for no limit.
+   */
+  explicit CTextureStreamScheduler(size_t uploadLimit = 0) : m_uploadLimit(uploadLimit) {}
+
+  void SetUploadLimit(size_t uploadLimit) { m_uploadLimit = uploadLimit; }
+
+  /*!
+   \brief Queue a request, or refresh it if it is queued already.
+   \param item the request
+   \param visible whether the requester is on-screen
+   \param frame the current frame, must not decrease between calls
+   */
+  void Queue(const T& item, bool visible, unsigned int frame)
+  {
+    if (!Touch(item, visible, frame))
+      m_queue.push_back({item, visible, frame});
+  }
+
+  /*!
+   \brief Refresh a queued request.
+   \return false if the request is not queued.
+   */
+  bool Touch(const T& item, bool visible, unsigned int frame)
+  {
+    const auto it = std::ranges::find(m_queue, item, &Request::item);
+    if (it == m_queue.end())
+      return false;
+
+    // one on-screen request in a frame wins over off-screen ones
+    it->visible = it->frame == frame ? it->visible || visible : visible;
+    it->frame = frame;
+    return true;
+  }
+
+  /*!
+   \brief Drop a queued request.
+   \return false if the request is not queued.
+   */
+  bool Remove(const T& item)
+  {
+    const auto it = std::ranges::find(m_queue, item, &Request::item);
+    if (it == m_queue.end())
+      return false;
+    m_queue.erase(it);
+    return true;
+  }
+
+  /*!
+   \brief Take the request to load next.
+   \return false if none is queued.
+   */
+  bool Pop(T& item)
+  {
+    if (m_queue.empty())
+      return false;
+
+    auto best = m_queue.begin();
+    for (auto it = std::next(best); it != m_queue.end(); ++it)
+    {
+      if (it->visible != best->visible ? it->visible : it->frame > best->frame)
+        best = it;
+    }
+    item = best->item;
+    m_queue.erase(best);
+    return true;
+  }
+
+  bool IsEmpty() const { return m_queue.empty(); }
+  size_t Size() const { return m_queue.size(); }
+
+  /*!
+   \brief Account for a texture to upload this frame.
+
+   On-screen textures may use the whole limit, off-screen ones only the first half of it. The
+   first texture of a frame always fits, so that textures larger than the limit still load.
+
+   \param bytes size of the texture
+   \param visible whether the requester is on-screen
+   \param frame the current frame
+   \return true if the texture should be uploaded this frame.
+   */
+  bool ReserveUpload(size_t bytes, bool visible, unsigned int frame)
+  {
+    if (frame != m_uploadFrame)
+    {
+      m_uploadFrame = frame;
+      m_uploadBytes = 0;
+    }
+
+    if (m_uploadLimit && m_uploadBytes)
+    {
+      const size_t limit = visible ? m_uploadLimit : m_uploadLimit / 2;
+      if (m_uploadBytes + bytes > limit)
+        return false;
+    }
+    m_uploadBytes += bytes;
+    return true;
+  }
+
+private:
+  struct Request
+  {
+    T item;
+    bool visible;
+    unsigned int frame;
+  };
+
+  std::vector<Request> m_queue;
+  size_t m_uploadLimit;
+  unsigned int m_uploadFrame{0};
+  size_t m_uploadBytes{0};
+};
@@ -0,0 +1,311 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VirtualItemList.h"
+
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "jobs/JobManager.h"
+
+#include <algorithm>
+#include <mutex>
+
+CVirtualItemList::CVirtualItemList(std::unique_ptr<IVirtualItemSource> source,
+                                   int pageSize /* = DEFAULT_PAGE_SIZE */,
+                                   int maxPages /* = DEFAULT_MAX_PAGES */)
+  : m_pageSize(std::max(pageSize, 1)),
+    m_maxPages(std::max(maxPages, 3)),
+    m_placeholder(std::make_shared<CFileItem>()),
+    m_source(std::move(source))
+{
+}
+
+CVirtualItemList::~CVirtualItemList() = default;
+
+bool CVirtualItemList::Open()
+{
+  std::unique_lock sourceLock(m_sourceSection);
+  auto first = std::make_shared<Page>();
+  int total = 0;
+  if (!m_source->GetRows(0, m_pageSize, first->rows, total))
+    return false;
+  first->detailed.resize(first->rows.size(), false);
+
+  std::unique_lock lock(m_section);
+  m_size = std::max(total, static_cast<int>(first->rows.size()));
+  m_pages.clear();
+  m_pages.try_emplace(0, std::move(first));
+  return true;
+}
+
+int CVirtualItemList::Size() const
+{
+  std::unique_lock lock(m_section);
+  return m_size;
+}
+
+std::shared_ptr<CFileItem> CVirtualItemList::Get(int index)
+{
+  if (index < 0 || index >= Size())
+    return {};
+
+  const std::shared_ptr<Page> page = LoadPage(index / m_pageSize);
+  const size_t row = index % m_pageSize;
+  if (!page || row >= page->rows.size())
+    return {};
+
+  FillDetails(*page, row);
+  return page->rows[row];
+}
+
+std::shared_ptr<CFileItem> CVirtualItemList::GetIfLoaded(int index) const
+{
+  std::unique_lock lock(m_section);
+  if (index < 0 || index >= m_size)
+    return {};
+
+  const auto it = m_pages.find(index / m_pageSize);
+  const size_t row = index % m_pageSize;
+  if (it == m_pages.end() || row >= it->second->rows.size() || !it->second->detailed[row])
+    return {};
+  return it->second->rows[row];
+}
+
+bool CVirtualItemList::GetAll(std::vector<std::shared_ptr<CFileItem>>& items)
+{
+  std::unique_lock sourceLock(m_sourceSection);
+  int total = 0;
+  if (!m_source->GetRows(0, Size(), items, total))
+    return false;
+
+  // filled as the items on screen are, so they look the same once the list is materialized
+  for (const auto& item : items)
+    m_source->FillDetails(*item);
+  return true;
+}
+
+void CVirtualItemList::SetVisibleRange(int first, int last)
+{
+  {
+    std::unique_lock lock(m_section);
+    m_firstVisible = std::max(first, 0);
+    m_lastVisible = std::min(last, m_size - 1);
+    if (m_firstVisible > m_lastVisible)
+      return;
+
+    DropPages(0);
+
+    int page;
+    size_t row;
+    if (m_loading || !FindWork(page, row))
+      return;
+    m_loading = true;
+  }
+
+  std::weak_ptr<CVirtualItemList> weak = weak_from_this();
+  if (weak.expired())
+  {
+    // not shared, nothing can pick up items loaded in the background
+    while (LoadNext())
+      ;
+    return;
+  }
+
+  ScheduleLoad(
+      [weak]
+      {
+        while (const auto list = weak.lock())
+        {
+          if (!list->LoadNext())
+            break;
+        }
+      });
+}
+
+unsigned int CVirtualItemList::GetGeneration() const
+{
+  std::unique_lock lock(m_section);
+  return m_generation;
+}
+
+size_t CVirtualItemList::GetPageCount() const
+{
+  std::unique_lock lock(m_section);
+  return m_pages.size();
+}
+
+size_t CVirtualItemList::GetDetailedCount() const
+{
+  std::unique_lock lock(m_section);
+  size_t count = 0;
+  for (const auto& [index, page] : m_pages)
+    count += std::ranges::count(page->detailed, true);
+  return count;
+}
+
+void CVirtualItemList::ScheduleLoad(std::function<void()> load)
+{
+  const std::shared_ptr<CJobManager> jobManager = CServiceBroker::GetJobManager();
+  if (jobManager)
+    jobManager->Submit(std::move(load));
+  else
+    load();
+}
+
+std::shared_ptr<CVirtualItemList::Page> CVirtualItemList::LoadPage(int page)
+{
+  {
+    std::unique_lock lock(m_section);
+    if (const auto it = m_pages.find(page); it != m_pages.end())
+      return it->second;
+  }
+
+  std::unique_lock sourceLock(m_sourceSection);
+  {
+    // loaded by another thread meanwhile
+    std::unique_lock lock(m_section);
+    if (const auto it = m_pages.find(page); it != m_pages.end())
+      return it->second;
+  }
+
+  auto fetched = std::make_shared<Page>();
+  int total = 0;
+  if (!m_source->GetRows(page * m_pageSize, m_pageSize, fetched->rows, total))
+    return {};
+  fetched->detailed.resize(fetched->rows.size(), false);
+
+  std::unique_lock lock(m_section);
+  m_pages.try_emplace(page, fetched);
+  DropPages(m_maxPages);
+  return fetched;
+}
+
+void CVirtualItemList::FillDetails(Page& page, size_t row)
+{
+  {
+    std::unique_lock lock(m_section);
+    if (page.detailed[row])
+      return;
+  }
+
+  std::unique_lock sourceLock(m_sourceSection);
+  {
+    std::unique_lock lock(m_section);
+    if (page.detailed[row])
+      return;
+  }
+
+  m_source->FillDetails(*page.rows[row]);
+
+  std::unique_lock lock(m_section);
+  page.detailed[row] = true;
+}
+
+bool CVirtualItemList::FindWork(int& page, size_t& row) const
+{
+  if (m_firstVisible > m_lastVisible)
+    return false;
+
+  const int firstPage = m_firstVisible / m_pageSize;
+  const int lastPage = m_lastVisible / m_pageSize;
+
+  // the pages of the visible items first, then their details, then the neighbouring pages
+  for (page = firstPage; page <= lastPage; ++page)
+  {
+    if (!m_pages.contains(page))
+    {
+      row = NO_ROW;
+      return true;
+    }
+  }
+
+  for (int index = m_firstVisible; index <= m_lastVisible; ++index)
+  {
+    page = index / m_pageSize;
+    row = index % m_pageSize;
+    const Page& visible = *m_pages.at(page);
+    if (row < visible.detailed.size() && !visible.detailed[row])
+      return true;
+  }
+
+  row = NO_ROW;
+  for (page = std::max(firstPage - 1, 0); page <= lastPage + 1; ++page)
+  {
+    if (page * m_pageSize < m_size && !m_pages.contains(page))
+      return true;
+  }
+  return false;
+}
+
+bool CVirtualItemList::LoadNext()
+{
+  int page;
+  size_t row;
+  {
+    std::unique_lock lock(m_section);
+    if (!FindWork(page, row))
+    {
+      m_loading = false;
+      return false;
+    }
+  }
+
+  if (row == NO_ROW)
+  {
+    if (!LoadPage(page))
+    {
+      // don't retry a failing source over and over, the next scroll does
+      std::unique_lock lock(m_section);
+      m_loading = false;
+      return false;
+    }
+  }
+  else
+  {
+    std::shared_ptr<Page> visible;
+    {
+      std::unique_lock lock(m_section);
+      if (const auto it = m_pages.find(page); it != m_pages.end())
+        visible = it->second;
+    }
+    if (visible)
+      FillDetails(*visible, row);
+  }
+
+  std::unique_lock lock(m_section);
+  m_generation++;
+  return true;
+}
+
+void CVirtualItemList::DropPages(size_t keep)
+{
+  // the pages of the visible items and their neighbours are kept
+  const bool visible = m_firstVisible <= m_lastVisible;
+  const int firstPage = m_firstVisible / m_pageSize - 1;
+  const int lastPage = m_lastVisible / m_pageSize + 1;
+
+  while (m_pages.size() > keep)
+  {
+    auto farthest = m_pages.end();
+    int distance = 0;
+    for (auto it = m_pages.begin(); it != m_pages.end(); ++it)
+    {
+      const int pageDistance = !visible ? 1
+                               : it->first < firstPage ? firstPage - it->first
+                                                       : it->first - lastPage;
+      if (pageDistance > distance)
+      {
+        distance = pageDistance;
+        farthest = it;
+      }
+    }
+    if (farthest == m_pages.end())
+      break;
+    m_pages.erase(farthest);
+  }
+}
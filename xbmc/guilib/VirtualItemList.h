@@ -0,0 +1,173 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "utils/SortUtils.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+class CFileItem;
+
+/*!
+ \ingroup listproviders
+ \brief A source of rows for a CVirtualItemList, e.g. a library view paged from the database.
+ */
+class IVirtualItemSource
+{
+public:
+  virtual ~IVirtualItemSource() = default;
+
+  /*! \brief Fetch a page of lightweight rows, with just enough to label and sort them.
+   Called from a background job while loading pages, never at the same time as FillDetails().
+   \param start the first row to fetch.
+   \param count the number of rows to fetch, fewer are returned at the end of the list.
+   \param rows [out] the rows.
+   \param total [out] the number of rows in the whole list.
+   \return true on success, false otherwise.
+   */
+  virtual bool GetRows(int start,
+                       int count,
+                       std::vector<std::shared_ptr<CFileItem>>& rows,
+                       int& total) = 0;
+
+  /*! \brief Fill the full details of a row about to be shown, e.g. its art.
+   \param item the row fetched by GetRows().
+   */
+  virtual void FillDetails(CFileItem& item) = 0;
+
+  /*! \brief The order the rows are fetched in, SortBy::NONE if unknown. */
+  virtual SortDescription GetSortDescription() const { return {}; }
+};
+
+/*!
+ \ingroup listproviders
+ \brief A list too large to hold in memory, whose items are materialized around the ones on screen.
+
+ The pages holding the visible rows and their neighbours are fetched from the source in the
+ background, and only the visible rows get their full details filled, so showing the list never
+ waits for the source. Pages out of the visible window are dropped again, so the memory used
+ depends on the page size, not on the size of the list.
+
+ A container showing the list holds a placeholder item for every row that isn't loaded yet, see
+ GetPlaceholder() and GetIfLoaded(). Lists are shared between the window and its container,
+ create them with std::make_shared().
+ */
+class CVirtualItemList : public std::enable_shared_from_this<CVirtualItemList>
+{
+public:
+  static constexpr int DEFAULT_PAGE_SIZE = 100;
+  static constexpr int DEFAULT_MAX_PAGES = 12;
+
+  /*! \brief Create a list over a source of rows.
+   \param source the source of rows.
+   \param pageSize the number of rows fetched at once.
+   \param maxPages the number of pages kept in memory when items out of the visible window are
+   fetched with Get(), the visible pages and their neighbours are always kept.
+   */
+  explicit CVirtualItemList(std::unique_ptr<IVirtualItemSource> source,
+                            int pageSize = DEFAULT_PAGE_SIZE,
+                            int maxPages = DEFAULT_MAX_PAGES);
+  virtual ~CVirtualItemList();
+
+  /*! \brief Fetch the first page, which tells the size of the list.
+   \return true on success, false if the source failed.
+   */
+  bool Open();
+
+  /*! \brief The number of items in the list. */
+  int Size() const;
+
+  /*! \brief Get an item with its full details, fetching it now if needed.
+   Waits for the source, containers use GetIfLoaded() instead.
+   \param index the index of the item.
+   \return the item, empty pointer if out of range or the source failed.
+   */
+  std::shared_ptr<CFileItem> Get(int index);
+
+  /*! \brief Get an item if it is in memory with its full details, without waiting for the source.
+   \param index the index of the item.
+   \return the item, empty pointer if it isn't loaded (yet).
+   */
+  std::shared_ptr<CFileItem> GetIfLoaded(int index) const;
+
+  /*! \brief Fetch all items of the list at once with their full details, e.g. to turn it into a
+   plain list. The items are fetched in a single request to the source and aren't kept by the
+   list. Waits for the source, so run it in a job, see CFileItemList::MaterializeVirtualItems().
+   \param items [out] the items.
+   \return true on success, false if the source failed.
+   */
+  bool GetAll(std::vector<std::shared_ptr<CFileItem>>& items);
+
+  /*! \brief Tell the list which items are visible or about to be.
+   The pages out of the window are dropped, and the pages holding the visible items and their
+   neighbours are loaded in the background, see GetGeneration().
+   \param first the first visible item.
+   \param last the last visible item.
+   */
+  void SetVisibleRange(int first, int last);
+
+  /*! \brief A counter increased whenever items were loaded in the background.
+   Containers compare it to know when to pick up newly loaded items with GetIfLoaded().
+   */
+  unsigned int GetGeneration() const;
+
+  /*! \brief The order the items are in, SortBy::NONE if unknown. */
+  SortDescription GetSortDescription() const { return m_source->GetSortDescription(); }
+
+  /*! \brief The item containers show in place of the items not materialized. */
+  const std::shared_ptr<CFileItem>& GetPlaceholder() const { return m_placeholder; }
+
+  /*! \brief The number of pages in memory. */
+  size_t GetPageCount() const;
+
+  /*! \brief The number of items in memory with their full details. */
+  size_t GetDetailedCount() const;
+
+protected:
+  /*! \brief Run the loading of pages in the background, on the job manager by default.
+   \param load the function loading the pages.
+   */
+  virtual void ScheduleLoad(std::function<void()> load);
+
+private:
+  struct Page
+  {
+    std::vector<std::shared_ptr<CFileItem>> rows;
+    std::vector<bool> detailed;
+  };
+
+  static constexpr size_t NO_ROW = static_cast<size_t>(-1);
+
+  std::shared_ptr<Page> LoadPage(int page);
+  void FillDetails(Page& page, size_t row);
+  bool FindWork(int& page, size_t& row) const;
+  bool LoadNext();
+  void DropPages(size_t keep);
+
+  const int m_pageSize;
+  const size_t m_maxPages;
+  const std::shared_ptr<CFileItem> m_placeholder;
+
+  mutable CCriticalSection m_section;
+  // held by shared pointer, pages may be dropped while they are being loaded or filled
+  std::map<int, std::shared_ptr<Page>> m_pages;
+  int m_size{0};
+  int m_firstVisible{0};
+  int m_lastVisible{-1};
+  bool m_loading{false};
+  unsigned int m_generation{0};
+
+  // only one caller uses the source at a time
+  CCriticalSection m_sourceSection;
+  std::unique_ptr<IVirtualItemSource> m_source;
+};
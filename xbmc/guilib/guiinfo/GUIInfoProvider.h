@@ -11,6 +11,8 @@
 #include "cores/VideoPlayer/Interface/StreamInfo.h"
 #include "guilib/guiinfo/IGUIInfoProvider.h"
 
+#include <atomic>
+
 namespace KODI::GUILIB::GUIINFO
 {
 
@@ -40,10 +42,23 @@ public:
     m_subtitleInfo = subtitleInfo;
   }
 
+  bool TracksChanges(const CGUIInfo& info) const override { return false; }
+
+  unsigned int GetChangeRevision() const override { return m_changeRevision; }
+
 protected:
+  /*!
+   * @brief Publish a change of the values tracked by the provider. Also while getting a value
+   * that can't be determined yet, so that it is evaluated again rather than kept.
+   */
+  void NotifyChanged() const { ++m_changeRevision; }
+
   VideoStreamInfo m_videoInfo;
   AudioStreamInfo m_audioInfo;
   SubtitleStreamInfo m_subtitleInfo;
+
+private:
+  mutable std::atomic<unsigned int> m_changeRevision{0};
 };
 
 } // namespace KODI::GUILIB::GUIINFO
@@ -124,6 +124,13 @@ bool CGUIInfoProviders::GetBool(bool& value,
   return false;
 }
 
+const IGUIInfoProvider* CGUIInfoProviders::GetChangeTracker(const CGUIInfo& info) const
+{
+  const auto it = std::ranges::find_if(m_providers, [&info](const IGUIInfoProvider* provider)
+                                       { return provider->TracksChanges(info); });
+  return it != m_providers.end() ? *it : nullptr;
+}
+
 void CGUIInfoProviders::UpdateAVInfo(const AudioStreamInfo& audioInfo,
                                      const VideoStreamInfo& videoInfo,
                                      const SubtitleStreamInfo& subtitleInfo) const
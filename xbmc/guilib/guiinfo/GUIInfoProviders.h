@@ -100,6 +100,13 @@ public:
                int contextWindow,
                const CGUIInfo& info) const;
 
+  /*!
+   * @brief Get the provider publishing the changes of a GUIInfoManager bool value.
+   * @param info The GUI info (label id + additional data).
+   * @return The provider, nullptr if the changes of the value aren't published.
+   */
+  const IGUIInfoProvider* GetChangeTracker(const CGUIInfo& info) const;
+
   /*!
    * @brief Set new audio/video/subtitle stream info data at all registered providers.
    * @param audioInfo New audio stream info.
@@ -140,6 +147,12 @@ public:
    */
   CLibraryGUIInfo& GetLibraryInfoProvider() { return m_libraryGUIInfo; }
 
+  /*!
+   * @brief Get the skin guiinfo provider.
+   * @return The skin guiinfo provider.
+   */
+  CSkinGUIInfo& GetSkinInfoProvider() { return m_skinGUIInfo; }
+
 private:
   std::vector<IGUIInfoProvider*> m_providers;
 
@@ -98,6 +98,22 @@ public:
   virtual void UpdateAVInfo(const AudioStreamInfo& audioInfo,
                             const VideoStreamInfo& videoInfo,
                             const SubtitleStreamInfo& subtitleInfo) = 0;
+
+  /*!
+   * @brief Check whether the provider publishes the changes of a GUIInfoManager bool value it
+   * owns, so that conditions depending on it only need to be evaluated again once
+   * GetChangeRevision() has changed rather than every frame. Values depending on a list item or
+   * on the context window can't be tracked.
+   * @param info The GUI info (label id + additional data).
+   * @return True if changes of the value are published, false otherwise.
+   */
+  virtual bool TracksChanges(const CGUIInfo& info) const = 0;
+
+  /*!
+   * @brief Get the revision of the values whose changes the provider publishes.
+   * @return The revision, which changes whenever any of these values may have changed.
+   */
+  virtual unsigned int GetChangeRevision() const = 0;
 };
 
 } // namespace KODI::GUILIB::GUIINFO
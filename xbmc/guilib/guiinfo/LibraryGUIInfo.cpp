@@ -68,8 +68,9 @@ void CLibraryGUIInfo::SetLibraryBool(int condition, bool value)
       m_libraryHasBoxsets = value ? 1 : 0;
       break;
     default:
-      break;
+      return;
   }
+  NotifyChanged();
 }
 
 void CLibraryGUIInfo::ResetLibraryBools()
@@ -83,6 +84,7 @@ void CLibraryGUIInfo::ResetLibraryBools()
   m_libraryHasCompilations = -1;
   m_libraryHasBoxsets = -1;
   m_libraryRoleCounts.clear();
+  NotifyChanged();
 }
 
 bool CLibraryGUIInfo::InitCurrentItem(CFileItem* item)
@@ -107,6 +109,38 @@ bool CLibraryGUIInfo::GetInt(int& value,
   return false;
 }
 
+template<typename Database>
+bool CLibraryGUIInfo::OpenDatabase(Database& db) const
+{
+  if (db.Open())
+    return true;
+
+  // nothing got cached, don't let the conditions keep the value reported meanwhile
+  NotifyChanged();
+  return false;
+}
+
+bool CLibraryGUIInfo::TracksChanges(const CGUIInfo& info) const
+{
+  // the library content is cached, until set or reset on library updates
+  switch (info.GetInfo())
+  {
+    case LIBRARY_HAS_MUSIC:
+    case LIBRARY_HAS_MOVIES:
+    case LIBRARY_HAS_MOVIE_SETS:
+    case LIBRARY_HAS_TVSHOWS:
+    case LIBRARY_HAS_MUSICVIDEOS:
+    case LIBRARY_HAS_SINGLES:
+    case LIBRARY_HAS_COMPILATIONS:
+    case LIBRARY_HAS_BOXSETS:
+    case LIBRARY_HAS_VIDEO:
+    case LIBRARY_HAS_ROLE:
+      return true;
+    default:
+      return false;
+  }
+}
+
 bool CLibraryGUIInfo::GetBool(bool& value,
                               const CGUIListItem* gitem,
                               int contextWindow,
@@ -122,7 +156,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (m_libraryHasMusic < 0)
       { // query
         CMusicDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           m_libraryHasMusic = (db.GetSongsCount() > 0) ? 1 : 0;
           db.Close();
@@ -136,7 +170,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (m_libraryHasMovies < 0)
       {
         CVideoDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           m_libraryHasMovies = db.HasContent(VideoDbContentType::MOVIES) ? 1 : 0;
           db.Close();
@@ -150,7 +184,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (m_libraryHasMovieSets < 0)
       {
         CVideoDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           m_libraryHasMovieSets = db.HasSets() ? 1 : 0;
           db.Close();
@@ -164,7 +198,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (m_libraryHasTVShows < 0)
       {
         CVideoDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           m_libraryHasTVShows = db.HasContent(VideoDbContentType::TVSHOWS) ? 1 : 0;
           db.Close();
@@ -178,7 +212,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (m_libraryHasMusicVideos < 0)
       {
         CVideoDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           m_libraryHasMusicVideos = db.HasContent(VideoDbContentType::MUSICVIDEOS) ? 1 : 0;
           db.Close();
@@ -192,7 +226,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (m_libraryHasSingles < 0)
       {
         CMusicDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           m_libraryHasSingles = (db.GetSinglesCount() > 0) ? 1 : 0;
           db.Close();
@@ -206,7 +240,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (m_libraryHasCompilations < 0)
       {
         CMusicDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           m_libraryHasCompilations = (db.GetCompilationAlbumsCount() > 0) ? 1 : 0;
           db.Close();
@@ -220,7 +254,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (m_libraryHasBoxsets < 0)
       {
         CMusicDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           m_libraryHasBoxsets = (db.GetBoxsetsCount() > 0) ? 1 : 0;
           db.Close();
@@ -252,7 +286,7 @@ bool CLibraryGUIInfo::GetBool(bool& value,
       if (artistcount < 0)
       {
         CMusicDatabase db;
-        if (db.Open())
+        if (OpenDatabase(db))
         {
           artistcount = db.GetArtistCountForRole(strRole);
           db.Close();
@@ -40,12 +40,20 @@ public:
                const CGUIListItem* item,
                int contextWindow,
                const CGUIInfo& info) const override;
+  bool TracksChanges(const CGUIInfo& info) const override;
 
   bool GetLibraryBool(int condition) const;
   void SetLibraryBool(int condition, bool value);
   void ResetLibraryBools();
 
 private:
+  /*!
+   * @brief Open the database to query a library value from.
+   * @return false if it can't be opened, the value is then evaluated again rather than kept.
+   */
+  template<typename Database>
+  bool OpenDatabase(Database& db) const;
+
   mutable int m_libraryHasMusic;
   mutable int m_libraryHasMovies;
   mutable int m_libraryHasTVShows;
@@ -119,6 +119,20 @@ bool CSkinGUIInfo::GetInt(int& value,
   return false;
 }
 
+bool CSkinGUIInfo::TracksChanges(const CGUIInfo& info) const
+{
+  // skin settings are only changed through CSkinSettings, which publishes the changes
+  switch (info.GetInfo())
+  {
+    case SKIN_BOOL:
+    case SKIN_STRING_IS_EQUAL:
+    case SKIN_STRING:
+      return true;
+    default:
+      return false;
+  }
+}
+
 bool CSkinGUIInfo::GetBool(bool& value,
                            const CGUIListItem* gitem,
                            int contextWindow,
@@ -36,6 +36,12 @@ public:
                const CGUIListItem* item,
                int contextWindow,
                const CGUIInfo& info) const override;
+  bool TracksChanges(const CGUIInfo& info) const override;
+
+  /*!
+   * @brief Publish a change of the skin settings, to be called whenever one is set or reset.
+   */
+  void OnSkinSettingsChanged() { NotifyChanged(); }
 };
 
 } // namespace KODI::GUILIB::GUIINFO
@@ -72,6 +72,15 @@ public:
    */
   virtual void SetColorMetadata(const ImageColorMetadata& color) {}
 
+  /*!
+   \brief Allow the loader to decode at a reduced resolution, as long as the decoded image still
+          covers width x height when fit inside it. Must be called before LoadImageFromMemory.
+          Default no-op; only decoders that can scale while decoding override this.
+   \param width The width of the box the image will be fit into
+   \param height The height of the box the image will be fit into
+   */
+  virtual void SetDecodeSize(unsigned int width, unsigned int height) {}
+
   unsigned int Width() const              { return m_width; }
   unsigned int Height() const             { return m_height; }
   unsigned int originalWidth() const      { return m_originalWidth; }
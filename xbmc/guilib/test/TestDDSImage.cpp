@@ -0,0 +1,305 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "guilib/DDSImage.h"
+#include "guilib/FFmpegImage.h"
+#include "test/TestUtils.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// BGRA gradients with some noise and an alpha ramp
+std::vector<uint8_t> MakeImage(unsigned int width, unsigned int height, unsigned int seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> noise(0, 7);
+  std::vector<uint8_t> pixels(width * height * 4);
+  for (unsigned int y = 0; y < height; ++y)
+  {
+    for (unsigned int x = 0; x < width; ++x)
+    {
+      uint8_t* pixel = &pixels[(y * width + x) * 4];
+      pixel[0] = static_cast<uint8_t>((x * 255 / width) ^ noise(generator));
+      pixel[1] = static_cast<uint8_t>((y * 255 / height) ^ noise(generator));
+      pixel[2] = static_cast<uint8_t>(((x + y) * 255 / (width + height)) ^ noise(generator));
+      pixel[3] = static_cast<uint8_t>(y * 255 / height);
+    }
+  }
+  return pixels;
+}
+
+// decodes a color block as specified for BC1, three color mode included
+void DecodeColorBlock(const uint8_t* block, uint8_t* dest, unsigned int destPitch)
+{
+  const uint16_t c0 = block[0] | block[1] << 8;
+  const uint16_t c1 = block[2] | block[3] << 8;
+  uint8_t palette[4][4] = {};
+  for (int i = 0; i < 2; ++i)
+  {
+    const uint16_t c = i ? c1 : c0;
+    const int r = c >> 11 & 0x1F;
+    const int g = c >> 5 & 0x3F;
+    const int b = c & 0x1F;
+    palette[i][0] = static_cast<uint8_t>(b << 3 | b >> 2);
+    palette[i][1] = static_cast<uint8_t>(g << 2 | g >> 4);
+    palette[i][2] = static_cast<uint8_t>(r << 3 | r >> 2);
+    palette[i][3] = 0xFF;
+  }
+  for (int c = 0; c < 3; ++c)
+  {
+    if (c0 > c1)
+    {
+      palette[2][c] = static_cast<uint8_t>((2 * palette[0][c] + palette[1][c] + 1) / 3);
+      palette[3][c] = static_cast<uint8_t>((palette[0][c] + 2 * palette[1][c] + 1) / 3);
+    }
+    else
+      palette[2][c] = static_cast<uint8_t>((palette[0][c] + palette[1][c]) / 2);
+  }
+  palette[2][3] = 0xFF;
+  palette[3][3] = c0 > c1 ? 0xFF : 0;
+
+  for (unsigned int i = 0; i < 16; ++i)
+    memcpy(dest + (i / 4) * destPitch + (i % 4) * 4, palette[block[4 + i / 4] >> (i % 4 * 2) & 3],
+           4);
+}
+
+void DecodeAlphaBlock(const uint8_t* block, uint8_t* dest, unsigned int destPitch)
+{
+  int palette[8] = {block[0], block[1]};
+  for (int i = 2; i < 8; ++i)
+  {
+    if (block[0] > block[1])
+      palette[i] = ((8 - i) * block[0] + (i - 1) * block[1] + 3) / 7;
+    else if (i < 6)
+      palette[i] = ((6 - i) * block[0] + (i - 1) * block[1] + 2) / 5;
+    else
+      palette[i] = i == 6 ? 0 : 255;
+  }
+
+  uint64_t indices = 0;
+  for (int i = 0; i < 6; ++i)
+    indices |= static_cast<uint64_t>(block[2 + i]) << (i * 8);
+  for (unsigned int i = 0; i < 16; ++i)
+    dest[(i / 4) * destPitch + (i % 4) * 4 + 3] =
+        static_cast<uint8_t>(palette[indices >> (i * 3) & 7]);
+}
+
+// decodes into a BGRA image padded to whole blocks
+std::vector<uint8_t> Decompress(const CDDSImage& image)
+{
+  const unsigned int width = (image.GetWidth() + 3) & ~3u;
+  const unsigned int height = (image.GetHeight() + 3) & ~3u;
+  const bool alpha = image.GetFormat() == XB_FMT_DXT5;
+  std::vector<uint8_t> pixels(width * height * 4);
+  const unsigned char* block = image.GetData();
+  for (unsigned int y = 0; y < height; y += 4)
+  {
+    for (unsigned int x = 0; x < width; x += 4)
+    {
+      uint8_t* dest = &pixels[(y * width + x) * 4];
+      if (alpha)
+      {
+        DecodeColorBlock(block + 8, dest, width * 4);
+        DecodeAlphaBlock(block, dest, width * 4);
+        block += 16;
+      }
+      else
+      {
+        DecodeColorBlock(block, dest, width * 4);
+        block += 8;
+      }
+    }
+  }
+  return pixels;
+}
+
+// peak signal to noise ratio of the given channels, in dB
+double PSNR(const std::vector<uint8_t>& source,
+            unsigned int width,
+            unsigned int height,
+            const std::vector<uint8_t>& decoded,
+            unsigned int firstChannel,
+            unsigned int channels)
+{
+  const unsigned int decodedWidth = (width + 3) & ~3u;
+  double error = 0.0;
+  for (unsigned int y = 0; y < height; ++y)
+  {
+    for (unsigned int x = 0; x < width; ++x)
+    {
+      for (unsigned int c = firstChannel; c < firstChannel + channels; ++c)
+      {
+        const double diff = static_cast<double>(source[(y * width + x) * 4 + c]) -
+                            decoded[(y * decodedWidth + x) * 4 + c];
+        error += diff * diff;
+      }
+    }
+  }
+  const double mse = error / (width * height * channels);
+  return mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 100.0;
+}
+} // namespace
+
+TEST(TestDDSImage, RejectsUnsupportedFormats)
+{
+  const std::vector<uint8_t> pixels = MakeImage(8, 8, 1);
+  CDDSImage image;
+  EXPECT_FALSE(image.Compress(8, 8, 8 * 4, pixels.data(), XB_FMT_DXT3));
+  EXPECT_FALSE(image.Compress(8, 8, 8 * 4, pixels.data(), XB_FMT_A8R8G8B8));
+  EXPECT_FALSE(image.Compress(0, 8, 0, pixels.data(), XB_FMT_DXT1));
+}
+
+TEST(TestDDSImage, CompressOpaque)
+{
+  // not a multiple of the block size
+  constexpr unsigned int WIDTH = 70;
+  constexpr unsigned int HEIGHT = 45;
+  const std::vector<uint8_t> pixels = MakeImage(WIDTH, HEIGHT, 2);
+
+  CDDSImage image;
+  ASSERT_TRUE(image.Compress(WIDTH, HEIGHT, WIDTH * 4, pixels.data(), XB_FMT_DXT1));
+  EXPECT_EQ(WIDTH, image.GetWidth());
+  EXPECT_EQ(HEIGHT, image.GetHeight());
+  EXPECT_EQ(XB_FMT_DXT1, image.GetFormat());
+  EXPECT_EQ(18u * 12u * 8u, image.GetSize());
+
+  const std::vector<uint8_t> decoded = Decompress(image);
+  EXPECT_GT(PSNR(pixels, WIDTH, HEIGHT, decoded, 0, 3), 30.0);
+}
+
+TEST(TestDDSImage, CompressAlpha)
+{
+  constexpr unsigned int WIDTH = 64;
+  constexpr unsigned int HEIGHT = 64;
+  const std::vector<uint8_t> pixels = MakeImage(WIDTH, HEIGHT, 3);
+
+  CDDSImage image;
+  ASSERT_TRUE(image.Compress(WIDTH, HEIGHT, WIDTH * 4, pixels.data(), XB_FMT_DXT5));
+  EXPECT_EQ(XB_FMT_DXT5, image.GetFormat());
+  EXPECT_EQ(16u * 16u * 16u, image.GetSize());
+
+  const std::vector<uint8_t> decoded = Decompress(image);
+  EXPECT_GT(PSNR(pixels, WIDTH, HEIGHT, decoded, 0, 3), 30.0);
+  EXPECT_GT(PSNR(pixels, WIDTH, HEIGHT, decoded, 3, 1), 40.0);
+}
+
+TEST(TestDDSImage, CompressSolidBlocks)
+{
+  // equal endpoints must not select the three color mode with its transparent index
+  std::vector<uint8_t> pixels(16 * 4, 0x80);
+  CDDSImage image;
+  ASSERT_TRUE(image.Compress(4, 4, 16, pixels.data(), XB_FMT_DXT1));
+  const std::vector<uint8_t> decoded = Decompress(image);
+  for (unsigned int i = 0; i < 16; ++i)
+    EXPECT_EQ(0xFF, decoded[i * 4 + 3]);
+}
+
+TEST(TestDDSImage, WriteAndRead)
+{
+  constexpr unsigned int WIDTH = 70;
+  constexpr unsigned int HEIGHT = 45;
+  const std::vector<uint8_t> pixels = MakeImage(WIDTH, HEIGHT, 4);
+
+  CDDSImage image;
+  ASSERT_TRUE(image.Compress(WIDTH, HEIGHT, WIDTH * 4, pixels.data(), XB_FMT_DXT5));
+
+  XFILE::CFile* file = XBMC_CREATETEMPFILE(".dds");
+  ASSERT_NE(nullptr, file);
+  file->Close();
+  ASSERT_TRUE(image.WriteFile(XBMC_TEMPFILEPATH(file)));
+
+  CDDSImage loaded;
+  EXPECT_TRUE(loaded.ReadFile(XBMC_TEMPFILEPATH(file)));
+  EXPECT_EQ(WIDTH, loaded.GetWidth());
+  EXPECT_EQ(HEIGHT, loaded.GetHeight());
+  EXPECT_EQ(XB_FMT_DXT5, loaded.GetFormat());
+  ASSERT_EQ(image.GetSize(), loaded.GetSize());
+  EXPECT_EQ(0, memcmp(image.GetData(), loaded.GetData(), image.GetSize()));
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(file));
+}
+
+/*!
+ Loads a poster sized thumbnail the way the texture loader does, from a cached JPEG that has to
+ be decoded and from a cached DDS that is uploaded as is.
+ */
+TEST(TestDDSImage, DISABLED_LoadTimePerThumbnail)
+{
+  constexpr unsigned int WIDTH = 480;
+  constexpr unsigned int HEIGHT = 720;
+  constexpr int ITERATIONS = 50;
+  std::vector<uint8_t> pixels = MakeImage(WIDTH, HEIGHT, 5);
+
+  CFFmpegImage encoder("image/jpeg");
+  unsigned char* output = nullptr;
+  unsigned int outputSize = 0;
+  ASSERT_TRUE(encoder.CreateThumbnailFromSurface(pixels.data(), WIDTH, HEIGHT, XB_FMT_A8R8G8B8,
+                                                 WIDTH * 4, "thumb.jpg", output, outputSize));
+  const std::vector<uint8_t> jpeg(output, output + outputSize);
+  encoder.ReleaseThumbnailBuffer();
+
+  XFILE::CFile* jpegFile = XBMC_CREATETEMPFILE(".jpg");
+  ASSERT_NE(nullptr, jpegFile);
+  jpegFile->Close();
+  ASSERT_TRUE(jpegFile->OpenForWrite(XBMC_TEMPFILEPATH(jpegFile), true));
+  ASSERT_EQ(static_cast<ssize_t>(jpeg.size()), jpegFile->Write(jpeg.data(), jpeg.size()));
+  jpegFile->Close();
+
+  const auto compressStart = std::chrono::steady_clock::now();
+  CDDSImage compressed;
+  ASSERT_TRUE(compressed.Compress(WIDTH, HEIGHT, WIDTH * 4, pixels.data(), XB_FMT_DXT1));
+  const std::chrono::duration<double, std::micro> compressTime =
+      std::chrono::steady_clock::now() - compressStart;
+
+  XFILE::CFile* ddsFile = XBMC_CREATETEMPFILE(".dds");
+  ASSERT_NE(nullptr, ddsFile);
+  ddsFile->Close();
+  ASSERT_TRUE(compressed.WriteFile(XBMC_TEMPFILEPATH(ddsFile)));
+
+  std::vector<uint8_t> decoded(WIDTH * HEIGHT * 4);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; ++i)
+  {
+    std::vector<uint8_t> buffer;
+    XFILE::CFile file;
+    ASSERT_GT(file.LoadFile(XBMC_TEMPFILEPATH(jpegFile), buffer), 0);
+    CFFmpegImage image("image/jpeg");
+    ASSERT_TRUE(image.LoadImageFromMemory(buffer.data(), buffer.size(), 0, 0));
+    ASSERT_TRUE(image.Decode(decoded.data(), WIDTH, HEIGHT, WIDTH * 4, XB_FMT_A8R8G8B8));
+  }
+  const std::chrono::duration<double, std::micro> jpegTime =
+      std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; ++i)
+  {
+    CDDSImage image;
+    ASSERT_TRUE(image.ReadFile(XBMC_TEMPFILEPATH(ddsFile)));
+  }
+  const std::chrono::duration<double, std::micro> ddsTime =
+      std::chrono::steady_clock::now() - start;
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(jpegFile));
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(ddsFile));
+
+  RecordProperty("JpegBytes", static_cast<int>(jpeg.size()));
+  RecordProperty("DdsBytes", static_cast<int>(compressed.GetSize()));
+  RecordProperty("CompressUs", std::to_string(compressTime.count()));
+  RecordProperty("JpegLoadUsPerThumbnail", std::to_string(jpegTime.count() / ITERATIONS));
+  RecordProperty("DdsLoadUsPerThumbnail", std::to_string(ddsTime.count() / ITERATIONS));
+}
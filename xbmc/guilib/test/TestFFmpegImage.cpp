@@ -0,0 +1,204 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/FFmpegImage.h"
+#include "guilib/TextureFormats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// SOI, an APP0 segment, then a baseline frame header of 3000x2000
+const std::vector<uint8_t> JPEG_HEADER = {0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x04, 0x4A, 0x46,
+                                          0xFF, 0xC0, 0x00, 0x11, 0x08, 0x07, 0xD0, 0x0B,
+                                          0xB8, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01};
+
+std::vector<uint8_t> EncodeJpeg(unsigned int width, unsigned int height, unsigned int seed)
+{
+  // gradients with some noise, so that the encoder has detail to keep
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> noise(0, 31);
+  std::vector<uint8_t> pixels(width * height * 4);
+  for (unsigned int y = 0; y < height; ++y)
+  {
+    for (unsigned int x = 0; x < width; ++x)
+    {
+      uint8_t* pixel = &pixels[(y * width + x) * 4];
+      pixel[0] = static_cast<uint8_t>((x * 255 / width) ^ noise(generator));
+      pixel[1] = static_cast<uint8_t>((y * 255 / height) ^ noise(generator));
+      pixel[2] = static_cast<uint8_t>((x + y + seed * 40) & 0xFF);
+      pixel[3] = 0xFF;
+    }
+  }
+
+  CFFmpegImage encoder("image/jpeg");
+  unsigned char* output = nullptr;
+  unsigned int outputSize = 0;
+  std::vector<uint8_t> jpeg;
+  if (encoder.CreateThumbnailFromSurface(pixels.data(), width, height, XB_FMT_A8R8G8B8, width * 4,
+                                         "corpus.jpg", output, outputSize))
+    jpeg.assign(output, output + outputSize);
+  encoder.ReleaseThumbnailBuffer();
+  return jpeg;
+}
+
+bool DecodeJpeg(std::vector<uint8_t>& jpeg,
+                unsigned int decodeWidth,
+                unsigned int decodeHeight,
+                unsigned int& width,
+                unsigned int& height)
+{
+  CFFmpegImage image("image/jpeg");
+  image.SetDecodeSize(decodeWidth, decodeHeight);
+  if (!image.LoadImageFromMemory(jpeg.data(), jpeg.size(), 0, 0))
+    return false;
+
+  width = image.Width();
+  height = image.Height();
+  std::vector<uint8_t> pixels(width * height * 4);
+  return image.Decode(pixels.data(), width, height, width * 4, XB_FMT_A8R8G8B8);
+}
+} // namespace
+
+TEST(TestFFmpegImage, GetJpegSize)
+{
+  unsigned int width = 0;
+  unsigned int height = 0;
+  unsigned int orientation = 0;
+  EXPECT_TRUE(CFFmpegImage::GetJpegSize(JPEG_HEADER.data(), JPEG_HEADER.size(), width, height,
+                                        orientation));
+  EXPECT_EQ(3000u, width);
+  EXPECT_EQ(2000u, height);
+  EXPECT_EQ(0u, orientation);
+
+  // cut off inside the frame header
+  EXPECT_FALSE(CFFmpegImage::GetJpegSize(JPEG_HEADER.data(), 14, width, height, orientation));
+
+  // lossless frames can't be decoded at a reduced resolution
+  std::vector<uint8_t> lossless = JPEG_HEADER;
+  lossless[9] = 0xC3;
+  EXPECT_FALSE(
+      CFFmpegImage::GetJpegSize(lossless.data(), lossless.size(), width, height, orientation));
+
+  const uint8_t png[] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+  EXPECT_FALSE(CFFmpegImage::GetJpegSize(png, sizeof(png), width, height, orientation));
+}
+
+TEST(TestFFmpegImage, GetJpegSizeReadsOrientation)
+{
+  // an APP1 segment with a little endian EXIF IFD holding the orientation only
+  std::vector<uint8_t> jpeg = {0xFF, 0xD8, 0xFF, 0xE1, 0x00, 0x1E, 'E',  'x',  'i',  'f',  0x00,
+                               0x00, 'I',  'I',  0x2A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00,
+                               0x12, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+                               0x00};
+  jpeg.insert(jpeg.end(), JPEG_HEADER.begin() + 8, JPEG_HEADER.end());
+
+  unsigned int width = 0;
+  unsigned int height = 0;
+  unsigned int orientation = 0;
+  EXPECT_TRUE(CFFmpegImage::GetJpegSize(jpeg.data(), jpeg.size(), width, height, orientation));
+  EXPECT_EQ(3000u, width);
+  EXPECT_EQ(2000u, height);
+  EXPECT_EQ(6u, orientation);
+}
+
+TEST(TestFFmpegImage, GetDecodeLowres)
+{
+  // 4k fanart into the 1080p fanart box decodes at half size
+  EXPECT_EQ(1, CFFmpegImage::GetDecodeLowres(3840, 2160, 1920, 1080, 3));
+  // a poster only has to keep its height
+  EXPECT_EQ(1, CFFmpegImage::GetDecodeLowres(2000, 3000, 1920, 1080, 3));
+  EXPECT_EQ(3, CFFmpegImage::GetDecodeLowres(8000, 12000, 1920, 1080, 3));
+  EXPECT_EQ(2, CFFmpegImage::GetDecodeLowres(8000, 12000, 1920, 1080, 2));
+  // never below the box, the decoder rounds up
+  EXPECT_EQ(0, CFFmpegImage::GetDecodeLowres(1919, 1079, 1920, 1080, 3));
+  EXPECT_EQ(1, CFFmpegImage::GetDecodeLowres(3839, 2159, 1920, 1080, 3));
+  EXPECT_EQ(0, CFFmpegImage::GetDecodeLowres(3838, 2158, 1920, 1080, 3));
+  // no box, no scaling
+  EXPECT_EQ(0, CFFmpegImage::GetDecodeLowres(3840, 2160, 0, 0, 3));
+}
+
+TEST(TestFFmpegImage, DecodesAtReducedSize)
+{
+  std::vector<uint8_t> jpeg = EncodeJpeg(2000, 3000, 1);
+  ASSERT_FALSE(jpeg.empty());
+
+  unsigned int width = 0;
+  unsigned int height = 0;
+  ASSERT_TRUE(DecodeJpeg(jpeg, 0, 0, width, height));
+  EXPECT_EQ(2000u, width);
+  EXPECT_EQ(3000u, height);
+
+  CFFmpegImage image("image/jpeg");
+  image.SetDecodeSize(1280, 720);
+  ASSERT_TRUE(image.LoadImageFromMemory(jpeg.data(), jpeg.size(), 0, 0));
+  EXPECT_EQ(500u, image.Width());
+  EXPECT_EQ(750u, image.Height());
+  EXPECT_EQ(2000u, image.originalWidth());
+  EXPECT_EQ(3000u, image.originalHeight());
+}
+
+/*!
+ Decodes a corpus of poster and fanart sized images the way the texture cache does for a
+ 1080p fanart box, at full size and reduced size, and with a decoder per core.
+ */
+TEST(TestFFmpegImage, DISABLED_DecodeThroughput)
+{
+  constexpr int IMAGES = 8;
+  std::vector<std::vector<uint8_t>> corpus;
+  for (int i = 0; i < IMAGES; ++i)
+  {
+    corpus.emplace_back(i % 2 ? EncodeJpeg(2000, 3000, i) : EncodeJpeg(3840, 2160, i));
+    ASSERT_FALSE(corpus.back().empty());
+  }
+
+  const auto measure = [&corpus](unsigned int decodeWidth, unsigned int decodeHeight,
+                                 unsigned int threads)
+  {
+    std::atomic_size_t next{0};
+    std::atomic_bool success{true};
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threads; ++i)
+    {
+      workers.emplace_back(
+          [&]
+          {
+            // every image once per thread count, so that the runs compare
+            for (size_t image = next++; image < corpus.size() * threads; image = next++)
+            {
+              std::vector<uint8_t> jpeg = corpus[image % corpus.size()];
+              unsigned int width = 0;
+              unsigned int height = 0;
+              if (!DecodeJpeg(jpeg, decodeWidth, decodeHeight, width, height))
+                success = false;
+            }
+          });
+    }
+    for (std::thread& worker : workers)
+      worker.join();
+    EXPECT_TRUE(success);
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(corpus.size() * threads) / elapsed.count();
+  };
+
+  const unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+  RecordProperty("FullSizeImagesPerSecond", std::to_string(measure(0, 0, 1)));
+  RecordProperty("ReducedImagesPerSecond", std::to_string(measure(1920, 1080, 1)));
+  RecordProperty("ParallelReducedImagesPerSecond", std::to_string(measure(1920, 1080, threads)));
+}
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFontShapeCache.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<character_t> ToText(const std::string& label,
+                                character_t style = 0,
+                                character_t color = 0)
+{
+  std::vector<character_t> text;
+  for (const char ch : label)
+    text.push_back((style << 24) | (color << 16) | static_cast<unsigned char>(ch));
+  return text;
+}
+} // namespace
+
+TEST(TestGUIFontShapeCache, IgnoresColor)
+{
+  CGUIFontShapeCache<int> cache;
+  EXPECT_EQ(nullptr, cache.Find(ToText("Song", 0, 1)));
+  cache.Insert(ToText("Song", 0, 1), 42);
+
+  // focusing the item changes its color only
+  const int* value = cache.Find(ToText("Song", 0, 2));
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ(42, *value);
+
+  // but a bold label is shaped on its own
+  EXPECT_EQ(nullptr, cache.Find(ToText("Song", 1, 1)));
+  EXPECT_EQ(nullptr, cache.Find(ToText("Son", 0, 1)));
+  EXPECT_EQ(1u, cache.GetHits());
+  EXPECT_EQ(3u, cache.GetMisses());
+}
+
+TEST(TestGUIFontShapeCache, EvictsLeastRecentlyUsed)
+{
+  CGUIFontShapeCache<int> cache(2);
+  cache.Insert(ToText("a"), 1);
+  cache.Insert(ToText("b"), 2);
+  ASSERT_NE(nullptr, cache.Find(ToText("a")));
+
+  cache.Insert(ToText("c"), 3);
+  EXPECT_EQ(2u, cache.Size());
+  EXPECT_NE(nullptr, cache.Find(ToText("a")));
+  EXPECT_EQ(nullptr, cache.Find(ToText("b")));
+  EXPECT_NE(nullptr, cache.Find(ToText("c")));
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Size());
+  EXPECT_EQ(nullptr, cache.Find(ToText("a")));
+}
+
+TEST(TestGUIFontShapeCache, DISABLED_ScrollingList)
+{
+  // a list of 5000 songs sharing their first characters, 20 of them visible, scrolled by one
+  // item per frame, the focused one drawn in another color
+  constexpr int items = 5000;
+  constexpr int visible = 20;
+  std::vector<std::string> labels;
+  for (int i = 0; i < items; ++i)
+    labels.push_back("The Artist - Track " + std::to_string(i));
+
+  CGUIFontShapeCache<int> cache;
+  for (int frame = 0; frame + visible <= items; ++frame)
+  {
+    for (int i = frame; i < frame + visible; ++i)
+    {
+      const auto text = ToText(labels[i], 0, i == frame + visible / 2 ? 1 : 0);
+      if (!cache.Find(text))
+        cache.Insert(text, i);
+    }
+  }
+
+  // only the item scrolling into view is shaped
+  EXPECT_EQ(static_cast<uint64_t>(items), cache.GetMisses());
+  const double hitRate =
+      static_cast<double>(cache.GetHits()) / (cache.GetHits() + cache.GetMisses());
+  EXPECT_GT(hitRate, 0.9);
+  RecordProperty("HitRatePercent", static_cast<int>(hitRate * 100));
+}
@@ -0,0 +1,119 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFrameProfiler.h"
+#include "utils/Variant.h"
+
+#include <limits>
+#include <set>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+class TestGUIFrameProfiler : public testing::Test
+{
+protected:
+  ~TestGUIFrameProfiler() override { CGUIFrameProfiler::GetInstance().Stop(); }
+
+  CGUIFrameProfiler& m_profiler{CGUIFrameProfiler::GetInstance()};
+};
+
+TEST_F(TestGUIFrameProfiler, DisabledRecordsNothing)
+{
+  m_profiler.Start();
+  m_profiler.Stop();
+  ASSERT_FALSE(CGUIFrameProfiler::IsEnabled());
+
+  {
+    GUIPROFILER_SCOPE("scope", "test");
+  }
+  m_profiler.RecordCounter("counter", 1);
+  m_profiler.EndFrame();
+
+  EXPECT_EQ(0u, m_profiler.GetEventCount());
+}
+
+TEST_F(TestGUIFrameProfiler, ChromeTrace)
+{
+  m_profiler.Start();
+  {
+    GUIPROFILER_SCOPE("outer", "test");
+    GUIPROFILER_SCOPE("inner", "test");
+  }
+  m_profiler.RecordCounter("counter", 42);
+  m_profiler.EndFrame();
+  EXPECT_EQ(4u, m_profiler.GetEventCount());
+
+  CVariant trace;
+  m_profiler.GetChromeTrace(trace);
+  ASSERT_TRUE(trace["traceEvents"].isArray());
+  const CVariant& events = trace["traceEvents"];
+  ASSERT_EQ(4u, events.size());
+
+  // scopes are recorded when they end
+  EXPECT_EQ("inner", events[0]["name"].asString());
+  EXPECT_EQ("outer", events[1]["name"].asString());
+  for (unsigned int i = 0; i < 2; ++i)
+  {
+    EXPECT_EQ("X", events[i]["ph"].asString());
+    EXPECT_EQ("test", events[i]["cat"].asString());
+    EXPECT_GE(events[i]["dur"].asDouble(), 0.0);
+  }
+  EXPECT_LE(events[1]["ts"].asDouble(), events[0]["ts"].asDouble());
+  EXPECT_GE(events[1]["dur"].asDouble(), events[0]["dur"].asDouble());
+
+  EXPECT_EQ("C", events[2]["ph"].asString());
+  EXPECT_EQ(42, events[2]["args"]["value"].asInteger());
+  EXPECT_EQ("i", events[3]["ph"].asString());
+  EXPECT_EQ("frame", events[3]["name"].asString());
+}
+
+TEST_F(TestGUIFrameProfiler, LimitsEventsPerThread)
+{
+  // a buffer of that many events can't be allocated
+  m_profiler.Start(std::numeric_limits<size_t>::max());
+  m_profiler.RecordCounter("counter", 1);
+  EXPECT_EQ(1u, m_profiler.GetEventCount());
+}
+
+TEST_F(TestGUIFrameProfiler, KeepsLatestEvents)
+{
+  m_profiler.Start(4);
+  for (int i = 0; i < 10; ++i)
+    m_profiler.RecordCounter("counter", i);
+  EXPECT_EQ(4u, m_profiler.GetEventCount());
+
+  CVariant trace;
+  m_profiler.GetChromeTrace(trace);
+  const CVariant& events = trace["traceEvents"];
+  ASSERT_EQ(4u, events.size());
+  for (unsigned int i = 0; i < 4; ++i)
+    EXPECT_EQ(static_cast<int64_t>(6 + i), events[i]["args"]["value"].asInteger());
+
+  // starting again drops them
+  m_profiler.Start(4);
+  EXPECT_EQ(0u, m_profiler.GetEventCount());
+}
+
+TEST_F(TestGUIFrameProfiler, PerThread)
+{
+  m_profiler.Start();
+  m_profiler.RecordCounter("main", 1);
+  std::thread thread([this] { m_profiler.RecordCounter("worker", 2); });
+  thread.join();
+
+  CVariant trace;
+  m_profiler.GetChromeTrace(trace);
+  const CVariant& events = trace["traceEvents"];
+  ASSERT_EQ(2u, events.size());
+
+  std::set<int64_t> threads;
+  for (auto it = events.begin_array(); it != events.end_array(); ++it)
+    threads.insert((*it)["tid"].asInteger());
+  EXPECT_EQ(2u, threads.size());
+}
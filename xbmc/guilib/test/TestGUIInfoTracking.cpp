@@ -0,0 +1,213 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIInfoManager.h"
+#include "guilib/guiinfo/GUIInfo.h"
+#include "guilib/guiinfo/GUIInfoLabels.h"
+#include "guilib/guiinfo/GUIInfoProvider.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::GUILIB::GUIINFO;
+
+namespace
+{
+constexpr int WINDOW = 10000;
+
+// publishes the changes of Player.HasMedia, but not those of Player.HasAudio
+class CFakeInfo : public CGUIInfoProvider
+{
+public:
+  bool InitCurrentItem(CFileItem* item) override { return false; }
+  bool GetLabel(std::string& value,
+                const CFileItem* item,
+                int contextWindow,
+                const CGUIInfo& info,
+                std::string* fallback) const override
+  {
+    return false;
+  }
+  bool GetInt(int& value,
+              const CGUIListItem* item,
+              int contextWindow,
+              const CGUIInfo& info) const override
+  {
+    return false;
+  }
+  bool GetBool(bool& value,
+               const CGUIListItem* item,
+               int contextWindow,
+               const CGUIInfo& info) const override
+  {
+    switch (info.GetInfo())
+    {
+      case PLAYER_HAS_MEDIA:
+        ++m_trackedEvaluations;
+        // like a library value while its database can't be opened
+        if (!m_available)
+          NotifyChanged();
+        value = m_tracked && m_available;
+        return true;
+      case PLAYER_HAS_AUDIO:
+        ++m_untrackedEvaluations;
+        value = m_untracked;
+        return true;
+      default:
+        return false;
+    }
+  }
+  bool TracksChanges(const CGUIInfo& info) const override
+  {
+    return info.GetInfo() == PLAYER_HAS_MEDIA;
+  }
+
+  void SetTracked(bool value)
+  {
+    m_tracked = value;
+    NotifyChanged();
+  }
+
+  bool m_untracked{false};
+  bool m_available{true};
+  mutable int m_trackedEvaluations{0};
+  mutable int m_untrackedEvaluations{0};
+
+private:
+  bool m_tracked{false};
+};
+} // namespace
+
+class TestGUIInfoTracking : public testing::Test
+{
+protected:
+  TestGUIInfoTracking() { m_infoManager.GetInfoProviders().RegisterProvider(&m_fakeInfo, false); }
+  ~TestGUIInfoTracking() override { m_infoManager.GetInfoProviders().UnregisterProvider(&m_fakeInfo); }
+
+  CFakeInfo m_fakeInfo;
+  CGUIInfoManager m_infoManager;
+};
+
+TEST_F(TestGUIInfoTracking, EvaluatedOnlyOnChange)
+{
+  const auto info = m_infoManager.Register("Player.HasMedia");
+  ASSERT_NE(nullptr, info);
+  ASSERT_FALSE(info->GetDependencies().empty());
+
+  EXPECT_FALSE(info->Get(WINDOW));
+  EXPECT_EQ(1, m_fakeInfo.m_trackedEvaluations);
+
+  for (int frame = 0; frame < 10; ++frame)
+  {
+    m_infoManager.ResetCache();
+    EXPECT_FALSE(info->Get(WINDOW));
+  }
+  EXPECT_EQ(1, m_fakeInfo.m_trackedEvaluations);
+
+  m_fakeInfo.SetTracked(true);
+  m_infoManager.ResetCache();
+  EXPECT_TRUE(info->Get(WINDOW));
+  EXPECT_EQ(2, m_fakeInfo.m_trackedEvaluations);
+
+  // clearing the manager has all of them evaluated again
+  m_infoManager.Clear();
+  m_infoManager.ResetCache();
+  EXPECT_TRUE(info->Get(WINDOW));
+  EXPECT_EQ(3, m_fakeInfo.m_trackedEvaluations);
+}
+
+TEST_F(TestGUIInfoTracking, EvaluatedWhileUnavailable)
+{
+  const auto info = m_infoManager.Register("Player.HasMedia");
+  ASSERT_NE(nullptr, info);
+  m_fakeInfo.SetTracked(true);
+  m_fakeInfo.m_available = false;
+
+  for (int frame = 0; frame < 3; ++frame)
+  {
+    m_infoManager.ResetCache();
+    EXPECT_FALSE(info->Get(WINDOW));
+  }
+  EXPECT_EQ(3, m_fakeInfo.m_trackedEvaluations);
+
+  // the value is evaluated once more once available, and kept from then on
+  m_fakeInfo.m_available = true;
+  for (int frame = 0; frame < 3; ++frame)
+  {
+    m_infoManager.ResetCache();
+    EXPECT_TRUE(info->Get(WINDOW));
+  }
+  EXPECT_EQ(4, m_fakeInfo.m_trackedEvaluations);
+}
+
+TEST_F(TestGUIInfoTracking, UntrackedEvaluatedEveryFrame)
+{
+  const auto info = m_infoManager.Register("Player.HasAudio");
+  ASSERT_NE(nullptr, info);
+  EXPECT_TRUE(info->GetDependencies().empty());
+
+  for (int frame = 0; frame < 10; ++frame)
+  {
+    m_fakeInfo.m_untracked = frame % 2 == 1;
+    m_infoManager.ResetCache();
+    EXPECT_EQ(frame % 2 == 1, info->Get(WINDOW));
+  }
+  EXPECT_EQ(10, m_fakeInfo.m_untrackedEvaluations);
+}
+
+TEST_F(TestGUIInfoTracking, Expressions)
+{
+  const auto tracked = m_infoManager.Register("!Player.HasMedia + !Player.HasMedia");
+  const auto mixed = m_infoManager.Register("Player.HasMedia | Player.HasAudio");
+  ASSERT_NE(nullptr, tracked);
+  ASSERT_NE(nullptr, mixed);
+  EXPECT_FALSE(tracked->GetDependencies().empty());
+  EXPECT_TRUE(mixed->GetDependencies().empty());
+
+  EXPECT_TRUE(tracked->Get(WINDOW));
+  EXPECT_FALSE(mixed->Get(WINDOW));
+
+  m_fakeInfo.m_untracked = true;
+  m_infoManager.ResetCache();
+  EXPECT_TRUE(tracked->Get(WINDOW));
+  EXPECT_TRUE(mixed->Get(WINDOW));
+
+  m_fakeInfo.SetTracked(true);
+  m_infoManager.ResetCache();
+  EXPECT_FALSE(tracked->Get(WINDOW));
+  EXPECT_TRUE(mixed->Get(WINDOW));
+
+  // the leaf shared by both is evaluated once per change
+  EXPECT_EQ(2, m_fakeInfo.m_trackedEvaluations);
+}
+
+TEST_F(TestGUIInfoTracking, EvaluationStats)
+{
+  m_infoManager.SetEvaluationStatsEnabled(true);
+  const auto tracked = m_infoManager.Register("Player.HasMedia");
+  const auto untracked = m_infoManager.Register("Player.HasAudio");
+
+  tracked->Get(WINDOW);
+  untracked->Get(WINDOW);
+  m_infoManager.ResetCache();
+  m_infoManager.FinishEvaluationStats();
+
+  tracked->Get(WINDOW);
+  untracked->Get(WINDOW);
+  m_infoManager.ResetCache();
+  m_infoManager.FinishEvaluationStats();
+
+  const auto stats = m_infoManager.GetEvaluationStats();
+  ASSERT_EQ(1u, stats.size());
+  EXPECT_EQ(1u, stats.at(WINDOW).evaluated);
+  EXPECT_EQ(1u, stats.at(WINDOW).skipped);
+
+  m_infoManager.SetEvaluationStatsEnabled(false);
+  EXPECT_TRUE(m_infoManager.GetEvaluationStats().empty());
+}
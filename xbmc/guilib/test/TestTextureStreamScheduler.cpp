@@ -0,0 +1,287 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/TextureStreamScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestTextureStreamScheduler, PopsVisibleFirst)
+{
+  CTextureStreamScheduler<int> scheduler;
+  scheduler.Queue(1, false, 1);
+  scheduler.Queue(2, true, 1);
+  scheduler.Queue(3, false, 2);
+
+  int item = 0;
+  ASSERT_TRUE(scheduler.Pop(item));
+  EXPECT_EQ(2, item);
+  ASSERT_TRUE(scheduler.Pop(item));
+  EXPECT_EQ(3, item);
+  ASSERT_TRUE(scheduler.Pop(item));
+  EXPECT_EQ(1, item);
+  EXPECT_FALSE(scheduler.Pop(item));
+  EXPECT_TRUE(scheduler.IsEmpty());
+}
+
+TEST(TestTextureStreamScheduler, PopsMostRecentFirst)
+{
+  CTextureStreamScheduler<int> scheduler;
+  // requested in the same frame, in the order containers process their items
+  scheduler.Queue(1, true, 1);
+  scheduler.Queue(2, true, 1);
+  scheduler.Queue(3, true, 2);
+
+  int item = 0;
+  ASSERT_TRUE(scheduler.Pop(item));
+  EXPECT_EQ(3, item);
+  ASSERT_TRUE(scheduler.Pop(item));
+  EXPECT_EQ(1, item);
+  ASSERT_TRUE(scheduler.Pop(item));
+  EXPECT_EQ(2, item);
+}
+
+TEST(TestTextureStreamScheduler, TouchAndRemove)
+{
+  CTextureStreamScheduler<int> scheduler;
+  scheduler.Queue(1, true, 1);
+  scheduler.Queue(2, true, 1);
+  EXPECT_EQ(2u, scheduler.Size());
+
+  // still wanted, but scrolled off-screen
+  EXPECT_TRUE(scheduler.Touch(1, false, 2));
+  EXPECT_TRUE(scheduler.Touch(2, true, 2));
+  // an on-screen request in the same frame wins
+  EXPECT_TRUE(scheduler.Touch(1, true, 3));
+  EXPECT_TRUE(scheduler.Touch(1, false, 3));
+  EXPECT_FALSE(scheduler.Touch(3, true, 3));
+
+  // queueing again only refreshes
+  scheduler.Queue(2, false, 4);
+  EXPECT_EQ(2u, scheduler.Size());
+
+  int item = 0;
+  ASSERT_TRUE(scheduler.Pop(item));
+  EXPECT_EQ(1, item);
+
+  EXPECT_TRUE(scheduler.Remove(2));
+  EXPECT_FALSE(scheduler.Remove(2));
+  EXPECT_TRUE(scheduler.IsEmpty());
+}
+
+TEST(TestTextureStreamScheduler, MetersUploads)
+{
+  CTextureStreamScheduler<int> scheduler(1000);
+  EXPECT_TRUE(scheduler.ReserveUpload(400, true, 1));
+  EXPECT_TRUE(scheduler.ReserveUpload(400, true, 1));
+  EXPECT_FALSE(scheduler.ReserveUpload(400, true, 1));
+  EXPECT_TRUE(scheduler.ReserveUpload(200, true, 1));
+
+  // the first texture of a frame always fits, off-screen ones get half the budget
+  EXPECT_TRUE(scheduler.ReserveUpload(4000, false, 2));
+  EXPECT_FALSE(scheduler.ReserveUpload(1, true, 2));
+  EXPECT_TRUE(scheduler.ReserveUpload(400, false, 3));
+  EXPECT_FALSE(scheduler.ReserveUpload(400, false, 3));
+  EXPECT_TRUE(scheduler.ReserveUpload(400, true, 3));
+
+  scheduler.SetUploadLimit(0);
+  EXPECT_TRUE(scheduler.ReserveUpload(4000, false, 3));
+}
+
+namespace
+{
+struct ReplayResult
+{
+  int totalFrames{0}; ///< frames items were visible before their image was shown, summed up
+  int maxFrames{0};
+  int shown{0};
+  int missed{0}; ///< scrolled out of view before their image was shown
+};
+
+/*!
+ Replays a scroll through a poster wall the way a panel container drives the large texture
+ manager: items in the viewport and the preloaded rows around it request their image every
+ frame, items leaving the preloaded rows release it. Loaders take a fixed number of frames per
+ image, also for images released while loading, and uploads are metered per frame. Time is counted in frames, so the result doesn't depend
+ on the machine.
+ */
+ReplayResult ReplayScroll(bool prioritized)
+{
+  constexpr int COLUMNS = 7;
+  constexpr int ROWS = 200;
+  constexpr int VIEW_ROWS = 2;
+  constexpr int CACHE_ROWS = 2;
+  constexpr int LOADERS = 4;
+  constexpr int DECODE_FRAMES = 6;
+  constexpr size_t IMAGE_BYTES = 1000;
+
+  // fast scroll down, settle, a few short hops, fast scroll back up, settle
+  std::vector<double> speeds;
+  speeds.insert(speeds.end(), 240, 0.25);
+  speeds.insert(speeds.end(), 90, 0.0);
+  for (int hop = 0; hop < 6; ++hop)
+  {
+    speeds.insert(speeds.end(), 8, 0.125);
+    speeds.insert(speeds.end(), 20, 0.0);
+  }
+  speeds.insert(speeds.end(), 160, -0.25);
+  speeds.insert(speeds.end(), 90, 0.0);
+
+  enum class State
+  {
+    NONE,
+    QUEUED,
+    LOADING,
+    LOADED,
+    SHOWN
+  };
+  struct Item
+  {
+    State state{State::NONE};
+    int remaining{0};
+    int visibleSince{-1};
+  };
+  std::vector<Item> items(COLUMNS * ROWS);
+
+  CTextureStreamScheduler<int> scheduler(2 * IMAGE_BYTES);
+  std::deque<int> fifo;
+  int loading = 0;
+  std::vector<int> abandoned; ///< frames left for loads whose item was released
+  ReplayResult result;
+
+  double top = 0.0;
+  for (int frame = 1; frame <= static_cast<int>(speeds.size()); ++frame)
+  {
+    top = std::clamp(top + speeds[frame - 1], 0.0, static_cast<double>(ROWS - VIEW_ROWS));
+    const int firstVisible = static_cast<int>(std::floor(top));
+    const int lastVisible = static_cast<int>(std::ceil(top + VIEW_ROWS)) - 1;
+    const int firstCached = std::max(0, firstVisible - CACHE_ROWS);
+    const int lastCached = std::min(ROWS - 1, lastVisible + CACHE_ROWS);
+
+    for (int index = 0; index < static_cast<int>(items.size()); ++index)
+    {
+      Item& item = items[index];
+      const int row = index / COLUMNS;
+      const bool cached = row >= firstCached && row <= lastCached;
+      const bool visible = row >= firstVisible && row <= lastVisible;
+
+      if (!cached)
+      {
+        // released by the container
+        if (item.state == State::QUEUED)
+        {
+          if (prioritized)
+            scheduler.Remove(index);
+          else
+            std::erase(fifo, index);
+        }
+        else if (item.state == State::LOADING)
+          abandoned.push_back(item.remaining);
+        if (item.visibleSince >= 0 && item.state != State::SHOWN)
+          result.missed++;
+        item = {};
+        continue;
+      }
+
+      if (visible && item.visibleSince < 0)
+        item.visibleSince = frame;
+      else if (!visible && item.visibleSince >= 0)
+      {
+        if (item.state != State::SHOWN)
+          result.missed++;
+        item.visibleSince = -1;
+      }
+
+      switch (item.state)
+      {
+        case State::NONE:
+          item.state = State::QUEUED;
+          if (prioritized)
+            scheduler.Queue(index, visible, frame);
+          else
+            fifo.push_back(index);
+          break;
+        case State::QUEUED:
+          if (prioritized)
+            scheduler.Touch(index, visible, frame);
+          break;
+        case State::LOADED:
+          if (!prioritized || scheduler.ReserveUpload(IMAGE_BYTES, visible, frame))
+          {
+            item.state = State::SHOWN;
+            if (visible)
+            {
+              const int frames = frame - item.visibleSince;
+              result.totalFrames += frames;
+              result.maxFrames = std::max(result.maxFrames, frames);
+              result.shown++;
+            }
+          }
+          break;
+        default:
+          break;
+      }
+    }
+
+    for (Item& item : items)
+    {
+      if (item.state == State::LOADING && --item.remaining == 0)
+      {
+        item.state = State::LOADED;
+        loading--;
+      }
+    }
+    for (int& remaining : abandoned)
+    {
+      if (--remaining == 0)
+        loading--;
+    }
+    std::erase(abandoned, 0);
+
+    int next = 0;
+    while (loading < LOADERS)
+    {
+      if (prioritized)
+      {
+        if (!scheduler.Pop(next))
+          break;
+      }
+      else
+      {
+        if (fifo.empty())
+          break;
+        next = fifo.front();
+        fifo.pop_front();
+      }
+      items[next].state = State::LOADING;
+      items[next].remaining = DECODE_FRAMES;
+      loading++;
+    }
+  }
+
+  return result;
+}
+} // namespace
+
+TEST(TestTextureStreamScheduler, ScrollReplayFramesToVisible)
+{
+  const ReplayResult requestOrder = ReplayScroll(false);
+  const ReplayResult prioritized = ReplayScroll(true);
+
+  // on-screen images are loaded first, so more of them are shown, and shown sooner
+  ASSERT_GT(prioritized.shown, 0);
+  EXPECT_GE(prioritized.shown, requestOrder.shown);
+  EXPECT_LE(prioritized.missed, requestOrder.missed);
+  EXPECT_LT(prioritized.totalFrames * requestOrder.shown,
+            requestOrder.totalFrames * prioritized.shown);
+  EXPECT_LE(prioritized.maxFrames, requestOrder.maxFrames);
+}
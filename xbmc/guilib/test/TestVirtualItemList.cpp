@@ -0,0 +1,366 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "guilib/VirtualItemList.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+struct SourceStats
+{
+  int queries{0};
+  int rowsFetched{0};
+  int detailsFilled{0};
+};
+
+class CFakeSource : public IVirtualItemSource
+{
+public:
+  CFakeSource(int total, SourceStats& stats, const SortDescription& sorting = {})
+    : m_total(total),
+      m_stats(stats),
+      m_sorting(sorting)
+  {
+  }
+
+  bool GetRows(int start,
+               int count,
+               std::vector<std::shared_ptr<CFileItem>>& rows,
+               int& total) override
+  {
+    m_stats.queries++;
+    for (int i = start; i < std::min(start + count, m_total); ++i)
+    {
+      auto item = std::make_shared<CFileItem>("Song " + std::to_string(i));
+      item->SetPath("musicdb://songs/" + std::to_string(i) + ".flac");
+      rows.push_back(std::move(item));
+      m_stats.rowsFetched++;
+    }
+    total = m_total;
+    return true;
+  }
+
+  void FillDetails(CFileItem& item) override
+  {
+    m_stats.detailsFilled++;
+    item.SetArt("thumb", item.GetPath() + ".jpg");
+  }
+
+  SortDescription GetSortDescription() const override { return m_sorting; }
+
+private:
+  const int m_total;
+  SourceStats& m_stats;
+  const SortDescription m_sorting;
+};
+
+// loads run right away rather than on the job manager
+class CTestVirtualItemList : public CVirtualItemList
+{
+public:
+  using CVirtualItemList::CVirtualItemList;
+
+protected:
+  void ScheduleLoad(std::function<void()> load) override { load(); }
+};
+
+// loads wait until the test runs them, like a busy job manager
+class CDeferredVirtualItemList : public CVirtualItemList
+{
+public:
+  using CVirtualItemList::CVirtualItemList;
+
+  void RunLoads()
+  {
+    std::vector<std::function<void()>> loads;
+    loads.swap(m_loads);
+    for (const auto& load : loads)
+      load();
+  }
+
+  size_t GetPendingLoads() const { return m_loads.size(); }
+
+protected:
+  void ScheduleLoad(std::function<void()> load) override { m_loads.push_back(std::move(load)); }
+
+private:
+  std::vector<std::function<void()>> m_loads;
+};
+
+std::shared_ptr<CTestVirtualItemList> Create(int total,
+                                             SourceStats& stats,
+                                             const SortDescription& sorting = {})
+{
+  auto list = std::make_shared<CTestVirtualItemList>(
+      std::make_unique<CFakeSource>(total, stats, sorting), 50, 6);
+  EXPECT_TRUE(list->Open());
+  return list;
+}
+
+SortDescription SortByTitle()
+{
+  SortDescription sorting;
+  sorting.sortBy = SortBy::TITLE;
+  sorting.sortOrder = SortOrder::ASCENDING;
+  return sorting;
+}
+} // namespace
+
+TEST(TestVirtualItemList, Paging)
+{
+  SourceStats stats;
+  const auto list = Create(1000, stats);
+  EXPECT_EQ(1000, list->Size());
+  EXPECT_EQ(1, stats.queries);
+  EXPECT_EQ(50, stats.rowsFetched);
+  EXPECT_EQ(0u, list->GetDetailedCount());
+
+  const auto item = list->Get(789);
+  ASSERT_NE(nullptr, item);
+  EXPECT_EQ("Song 789", item->GetLabel());
+  EXPECT_EQ("musicdb://songs/789.flac.jpg", item->GetArt("thumb"));
+  EXPECT_EQ(2, stats.queries);
+  EXPECT_EQ(1, stats.detailsFilled);
+
+  // already materialized
+  EXPECT_EQ(item, list->Get(789));
+  EXPECT_EQ(2, stats.queries);
+  EXPECT_EQ(1, stats.detailsFilled);
+
+  EXPECT_EQ(nullptr, list->Get(-1));
+  EXPECT_EQ(nullptr, list->Get(1000));
+}
+
+TEST(TestVirtualItemList, DetailsOnlyNearVisible)
+{
+  SourceStats stats;
+  const auto list = Create(1000, stats);
+
+  list->SetVisibleRange(120, 139);
+  EXPECT_EQ(20, stats.detailsFilled);
+  EXPECT_EQ(20u, list->GetDetailedCount());
+  // page 2 holding the visible items and its neighbours 1 and 3, page 0 from opening is dropped
+  EXPECT_EQ(3u, list->GetPageCount());
+  EXPECT_EQ(200, stats.rowsFetched);
+
+  // scrolling by one item fills the details of that item only
+  list->SetVisibleRange(121, 140);
+  EXPECT_EQ(21, stats.detailsFilled);
+}
+
+TEST(TestVirtualItemList, BoundedMemory)
+{
+  SourceStats stats;
+  const auto list = Create(100000, stats);
+
+  // scroll through the whole list, a screen at a time
+  for (int first = 0; first < list->Size(); first += 20)
+  {
+    list->SetVisibleRange(first, first + 19);
+    EXPECT_LE(list->GetPageCount(), 6u);
+  }
+  EXPECT_LE(list->GetDetailedCount(), 6u * 50);
+  EXPECT_EQ(100000, stats.detailsFilled);
+
+  // jumping back fetches the page again
+  const int queries = stats.queries;
+  ASSERT_NE(nullptr, list->Get(0));
+  EXPECT_EQ(queries + 1, stats.queries);
+}
+
+TEST(TestVirtualItemList, FileItemList)
+{
+  SourceStats stats;
+  CFileItemList items("musicdb://songs/");
+  items.SetVirtualItems(Create(250, stats));
+  EXPECT_EQ(250, items.Size());
+  EXPECT_FALSE(items.IsEmpty());
+  ASSERT_NE(nullptr, items.Get(200));
+  EXPECT_EQ("Song 200", items.Get(200)->GetLabel());
+
+  CFileItemList copy;
+  copy.Assign(items);
+  EXPECT_EQ(items.GetVirtualItems(), copy.GetVirtualItems());
+
+  items.Clear();
+  EXPECT_EQ(nullptr, items.GetVirtualItems());
+  EXPECT_TRUE(items.IsEmpty());
+}
+
+TEST(TestVirtualItemList, GetIfLoadedNeverFetches)
+{
+  SourceStats stats;
+  const auto list = Create(1000, stats);
+
+  // loaded but without details, and not loaded at all
+  EXPECT_EQ(nullptr, list->GetIfLoaded(5));
+  EXPECT_EQ(nullptr, list->GetIfLoaded(500));
+  EXPECT_EQ(nullptr, list->GetIfLoaded(1000));
+  EXPECT_EQ(1, stats.queries);
+  EXPECT_EQ(0, stats.detailsFilled);
+
+  list->SetVisibleRange(0, 9);
+  ASSERT_NE(nullptr, list->GetIfLoaded(5));
+  EXPECT_EQ("musicdb://songs/5.flac.jpg", list->GetIfLoaded(5)->GetArt("thumb"));
+  EXPECT_EQ(nullptr, list->GetIfLoaded(10));
+}
+
+TEST(TestVirtualItemList, LoadsInTheBackground)
+{
+  SourceStats stats;
+  const auto list = std::make_shared<CDeferredVirtualItemList>(
+      std::make_unique<CFakeSource>(1000, stats), 50, 6);
+  ASSERT_TRUE(list->Open());
+
+  // scrolling doesn't wait for the source
+  list->SetVisibleRange(500, 519);
+  EXPECT_EQ(1, stats.queries);
+  EXPECT_EQ(0, stats.detailsFilled);
+  EXPECT_EQ(nullptr, list->GetIfLoaded(510));
+  EXPECT_EQ(0u, list->GetGeneration());
+  EXPECT_EQ(1u, list->GetPendingLoads());
+
+  // a load in progress picks up the new range rather than scheduling another one
+  list->SetVisibleRange(600, 619);
+  EXPECT_EQ(1u, list->GetPendingLoads());
+
+  list->RunLoads();
+  EXPECT_EQ(nullptr, list->GetIfLoaded(510));
+  ASSERT_NE(nullptr, list->GetIfLoaded(610));
+  EXPECT_EQ(20, stats.detailsFilled);
+  EXPECT_EQ(3u, list->GetPageCount());
+  EXPECT_LT(0u, list->GetGeneration());
+
+  // nothing left to do, the next scroll schedules a load again
+  list->SetVisibleRange(601, 620);
+  EXPECT_EQ(1u, list->GetPendingLoads());
+}
+
+TEST(TestVirtualItemList, GetAllItemsBoundedMemory)
+{
+  SourceStats stats;
+  const auto list = Create(10000, stats);
+
+  for (int i = 0; i < list->Size(); ++i)
+  {
+    ASSERT_NE(nullptr, list->Get(i));
+    EXPECT_LE(list->GetPageCount(), 6u);
+  }
+}
+
+TEST(TestVirtualItemList, GetAll)
+{
+  SourceStats stats;
+  const auto list = Create(1000, stats);
+
+  std::vector<std::shared_ptr<CFileItem>> items;
+  ASSERT_TRUE(list->GetAll(items));
+  ASSERT_EQ(1000u, items.size());
+  EXPECT_EQ("Song 999", items.back()->GetLabel());
+  EXPECT_EQ("musicdb://songs/999.flac.jpg", items.back()->GetArt("thumb"));
+  EXPECT_EQ(2, stats.queries);
+  EXPECT_EQ(1000, stats.detailsFilled);
+  EXPECT_EQ(1u, list->GetPageCount());
+}
+
+TEST(TestVirtualItemList, FileItemListCopy)
+{
+  SourceStats stats;
+  CFileItemList items("musicdb://songs/");
+  items.SetVirtualItems(Create(250, stats));
+
+  // the copy shares the virtual list, nothing is fetched
+  CFileItemList copy;
+  copy.Copy(items);
+  EXPECT_EQ(items.GetVirtualItems(), copy.GetVirtualItems());
+  EXPECT_EQ(250, copy.Size());
+  EXPECT_EQ(1, stats.queries);
+}
+
+TEST(TestVirtualItemList, FileItemListMaterializes)
+{
+  SourceStats stats;
+  CFileItemList items("musicdb://songs/");
+  items.SetVirtualItems(Create(250, stats));
+
+  // iterating only sees the plain items, it never waits for the source
+  EXPECT_EQ(items.begin(), items.end());
+  EXPECT_TRUE(items.GetList().empty());
+  EXPECT_FALSE(items.Contains("musicdb://songs/0.flac"));
+  EXPECT_NE(nullptr, items.GetVirtualItems());
+  EXPECT_EQ(1, stats.queries);
+
+  ASSERT_TRUE(items.MaterializeVirtualItems());
+  EXPECT_EQ(nullptr, items.GetVirtualItems());
+  EXPECT_EQ(2, stats.queries);
+
+  int count = 0;
+  for (const auto& item : items)
+  {
+    EXPECT_EQ("Song " + std::to_string(count), item->GetLabel());
+    EXPECT_EQ(item->GetPath() + ".jpg", item->GetArt("thumb"));
+    count++;
+  }
+  EXPECT_EQ(250, count);
+
+  EXPECT_EQ(25u, erase_if(items, [](const auto& item)
+                          { return item->GetPath().ends_with("0.flac"); }));
+  EXPECT_EQ(225, items.Size());
+}
+
+TEST(TestVirtualItemList, FileItemListMaterializesFetchedItems)
+{
+  SourceStats stats;
+  CFileItemList items("musicdb://songs/");
+  items.SetVirtualItems(Create(250, stats));
+
+  // as done when the items were fetched in a job
+  std::vector<std::shared_ptr<CFileItem>> fetched;
+  ASSERT_TRUE(items.GetVirtualItems()->GetAll(fetched));
+  items.MaterializeVirtualItems(std::move(fetched));
+  EXPECT_EQ(nullptr, items.GetVirtualItems());
+  ASSERT_EQ(250, items.Size());
+  EXPECT_EQ("Song 249", items.Get(249)->GetLabel());
+}
+
+TEST(TestVirtualItemList, FileItemListSort)
+{
+  SourceStats stats;
+  CFileItemList items("musicdb://songs/");
+  items.SetVirtualItems(Create(250, stats, SortByTitle()));
+
+  // sorted by the source already
+  EXPECT_TRUE(items.IsVirtualSortedBy(SortByTitle()));
+  items.Sort(SortByTitle());
+  EXPECT_NE(nullptr, items.GetVirtualItems());
+  EXPECT_EQ(1, stats.queries);
+
+  // any other order needs all of the items, which are only fetched when asked for
+  SortDescription descending = SortByTitle();
+  descending.sortOrder = SortOrder::DESCENDING;
+  EXPECT_FALSE(items.IsVirtualSortedBy(descending));
+  items.Sort(descending.sortBy, descending.sortOrder, descending.sortAttributes);
+  EXPECT_NE(nullptr, items.GetVirtualItems());
+  EXPECT_EQ(SortBy::NONE, items.GetSortMethod());
+  EXPECT_EQ(1, stats.queries);
+
+  ASSERT_TRUE(items.MaterializeVirtualItems());
+  items.Sort(descending.sortBy, descending.sortOrder, descending.sortAttributes);
+  EXPECT_EQ(SortBy::TITLE, items.GetSortMethod());
+  EXPECT_EQ(250, items.Size());
+  EXPECT_EQ(2, stats.queries);
+}
@@ -8,8 +8,13 @@
 
 #include "InfoBool.h"
 
+#include "GUIInfoManager.h"
+#include "guilib/GUIFrameProfiler.h"
+#include "guilib/guiinfo/IGUIInfoProvider.h"
 #include "utils/StringUtils.h"
 
+#include <algorithm>
+
 namespace INFO
 {
 InfoBool::InfoBool(const std::string& expression, int context, unsigned int& refreshCounter)
@@ -17,4 +22,46 @@ InfoBool::InfoBool(const std::string& expression, int context, unsigned int& ref
 {
   StringUtils::ToLower(m_expression);
 }
+
+void InfoBool::SetDependencies(
+    const std::vector<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*>& providers)
+{
+  m_dependencies.clear();
+  for (const auto* provider : providers)
+  {
+    if (std::ranges::find(m_dependencies, provider, &Dependency::first) == m_dependencies.end())
+      m_dependencies.emplace_back(provider, provider->GetChangeRevision());
+  }
+  m_generation = 0;
+}
+
+void InfoBool::Evaluate(int contextWindow, const CGUIListItem* item)
+{
+  GUIPROFILER_SCOPE("InfoBool::Evaluate", "guiinfo");
+
+  // take the revisions first, a change while evaluating is caught the next frame
+  if (!item && !m_dependencies.empty())
+  {
+    m_generation = m_infoMgr->GetConditionGeneration();
+    for (auto& [provider, revision] : m_dependencies)
+      revision = provider->GetChangeRevision();
+  }
+
+  Update(contextWindow, item);
+  m_infoMgr->CountEvaluation(contextWindow, true);
+}
+
+void InfoBool::SkipEvaluation(int contextWindow)
+{
+  m_infoMgr->CountEvaluation(contextWindow, false);
+}
+
+bool InfoBool::DependenciesChanged() const
+{
+  if (m_generation != m_infoMgr->GetConditionGeneration())
+    return true;
+
+  return std::ranges::any_of(m_dependencies, [](const Dependency& dependency)
+                             { return dependency.first->GetChangeRevision() != dependency.second; });
+}
 }
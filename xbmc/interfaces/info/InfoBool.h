@@ -10,10 +10,17 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 class CGUIListItem;
 class CGUIInfoManager;
 
+namespace KODI::GUILIB::GUIINFO
+{
+class IGUIInfoProvider;
+}
+
 namespace INFO
 {
 /*!
@@ -36,10 +43,14 @@ public:
   inline bool Get(int contextWindow, const CGUIListItem* item = nullptr)
   {
     if (item && m_listItemDependent)
-      Update(contextWindow, item);
+      Evaluate(contextWindow, item);
     else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
     {
-      Update(contextWindow, nullptr);
+      // conditions whose inputs publish their changes keep their value until one changed
+      if (m_dependencies.empty() || DependenciesChanged())
+        Evaluate(contextWindow, nullptr);
+      else
+        SkipEvaluation(contextWindow);
       m_refreshCounter = m_parentRefreshCounter;
     }
     return m_value;
@@ -68,7 +79,20 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+
+  using Dependency = std::pair<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*, unsigned int>;
+
+  /*! \brief The providers publishing the changes of all inputs of this info bool, with their
+   revision when it was last evaluated. Empty if it has to be evaluated every frame.
+   */
+  const std::vector<Dependency>& GetDependencies() const { return m_dependencies; }
+
 protected:
+  /*! \brief Only evaluate this info bool again once one of the providers published a change.
+   \param providers the providers publishing the changes of all of its inputs.
+   */
+  void SetDependencies(const std::vector<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*>& providers);
+
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
@@ -76,8 +100,14 @@ protected:
   CGUIInfoManager* m_infoMgr;
 
 private:
+  void Evaluate(int contextWindow, const CGUIListItem* item);
+  void SkipEvaluation(int contextWindow);
+  bool DependenciesChanged() const;
+
   unsigned int m_refreshCounter = 0;
   unsigned int &m_parentRefreshCounter;
+  std::vector<Dependency> m_dependencies;
+  unsigned int m_generation = 0; ///< generation of the info manager's conditions when evaluated
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
@@ -11,6 +11,7 @@
 #include "GUIInfoManager.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <stack>
@@ -21,6 +22,12 @@ void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+
+  if (!m_listItemDependent)
+  {
+    if (const auto* provider = m_infoMgr->GetChangeTracker(m_condition))
+      SetDependencies({provider});
+  }
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
@@ -39,6 +46,10 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
     m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
   }
+
+  std::vector<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*> providers;
+  if (!m_listItemDependent && m_expression_tree->GetDependencies(providers))
+    SetDependencies(providers);
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
@@ -72,6 +83,18 @@ bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* i
   return m_invert ^ m_info->Get(contextWindow, item);
 }
 
+bool InfoExpression::InfoLeaf::GetDependencies(
+    std::vector<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*>& providers) const
+{
+  const auto& dependencies = m_info->GetDependencies();
+  if (dependencies.empty())
+    return false;
+
+  for (const auto& dependency : dependencies)
+    providers.emplace_back(dependency.first);
+  return true;
+}
+
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
     node_type_t type,
     const InfoSubexpressionPtr &left,
@@ -115,6 +138,13 @@ bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGU
   return use_and ^ result;
 }
 
+bool InfoExpression::InfoAssociativeGroup::GetDependencies(
+    std::vector<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*>& providers) const
+{
+  return std::ranges::all_of(m_children, [&providers](const InfoSubexpressionPtr& child)
+                             { return child->GetDependencies(providers); });
+}
+
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
  * (AND/OR) are treated as right-associative so that we don't need to make a
  * special case for the unary NOT operator. This has no effect upon the answers
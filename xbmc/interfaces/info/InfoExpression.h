@@ -76,6 +76,11 @@ private:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
     virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
     virtual node_type_t Type() const=0;
+    /*! \brief Collect the providers publishing the changes of all leaves below this node.
+     \return false if any of the leaves has to be evaluated every frame.
+     */
+    virtual bool GetDependencies(
+        std::vector<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*>& providers) const = 0;
   };
 
   typedef std::shared_ptr<InfoSubexpression> InfoSubexpressionPtr;
@@ -87,6 +92,8 @@ private:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
     bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return NODE_LEAF; }
+    bool GetDependencies(
+        std::vector<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*>& providers) const override;
 
   private:
     InfoPtr m_info;
@@ -102,6 +109,8 @@ private:
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
     bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return m_type; }
+    bool GetDependencies(
+        std::vector<const KODI::GUILIB::GUIINFO::IGUIInfoProvider*>& providers) const override;
 
   private:
     node_type_t m_type;
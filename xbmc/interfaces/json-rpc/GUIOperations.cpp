@@ -18,6 +18,7 @@
 #include "application/ApplicationPlayer.h"
 #include "dialogs/GUIDialogKaiToast.h"
 #include "guilib/GUIComponent.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/StereoscopicsManager.h"
 #include "input/WindowTranslator.h"
@@ -171,6 +172,36 @@ JSONRPC_STATUS CGUIOperations::TakeScreenshot(const std::string& method,
   return ACK;
 }
 
+JSONRPC_STATUS CGUIOperations::SetProfiling(const std::string& method,
+                                            ITransportLayer* transport,
+                                            IClient* client,
+                                            const CVariant& parameterObject,
+                                            CVariant& result)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+  const bool enabled = parameterObject["enabled"].isString()
+                           ? !CGUIFrameProfiler::IsEnabled()
+                           : parameterObject["enabled"].asBoolean();
+
+  if (enabled && !CGUIFrameProfiler::IsEnabled())
+    profiler.Start(static_cast<size_t>(parameterObject["eventsperthread"].asUnsignedInteger()));
+  else if (!enabled && CGUIFrameProfiler::IsEnabled())
+    profiler.Stop();
+
+  result = CGUIFrameProfiler::IsEnabled();
+  return OK;
+}
+
+JSONRPC_STATUS CGUIOperations::GetProfile(const std::string& method,
+                                          ITransportLayer* transport,
+                                          IClient* client,
+                                          const CVariant& parameterObject,
+                                          CVariant& result)
+{
+  CGUIFrameProfiler::GetInstance().GetChromeTrace(result);
+  return OK;
+}
+
 JSONRPC_STATUS CGUIOperations::GetPropertyValue(const std::string &property, CVariant &result)
 {
   if (property == "currentwindow")
@@ -36,6 +36,16 @@ namespace JSONRPC
                                          IClient* client,
                                          const CVariant& parameterObject,
                                          CVariant& result);
+    static JSONRPC_STATUS SetProfiling(const std::string& method,
+                                       ITransportLayer* transport,
+                                       IClient* client,
+                                       const CVariant& parameterObject,
+                                       CVariant& result);
+    static JSONRPC_STATUS GetProfile(const std::string& method,
+                                     ITransportLayer* transport,
+                                     IClient* client,
+                                     const CVariant& parameterObject,
+                                     CVariant& result);
 
   private:
     static JSONRPC_STATUS GetPropertyValue(const std::string &property, CVariant &result);
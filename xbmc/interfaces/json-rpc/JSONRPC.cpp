@@ -24,18 +24,80 @@
 #include "input/WindowTranslator.h"
 #include "input/actions/ActionTranslator.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobManager.h"
 #include "playlists/SmartPlayList.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Event.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <string.h>
+#include <utility>
+#include <vector>
 
 using namespace KODI;
 using namespace JSONRPC;
 
+namespace
+{
+//! Number of jobs the calls of a batch are spread over in addition to the receiving thread
+constexpr size_t MAX_BATCH_JOBS = 3;
+
+/*!
+ \brief Calls the given function for every index from 0 to count - 1, spread over the calling
+ thread and up to MAX_BATCH_JOBS jobs, and returns once all calls have returned.
+
+ The calling thread takes part, so the calls complete even if all job workers are busy. Jobs which
+ start after all indices have been taken don't do anything.
+ */
+void ParallelFor(size_t count, const std::function<void(size_t)>& function)
+{
+  const std::shared_ptr<CJobManager> jobManager = CServiceBroker::GetJobManager();
+  if (count < 2 || !jobManager)
+  {
+    for (size_t index = 0; index < count; ++index)
+      function(index);
+    return;
+  }
+
+  struct State
+  {
+    std::function<void(size_t)> function;
+    size_t count;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    CEvent finished;
+  };
+
+  auto state = std::make_shared<State>();
+  state->function = function;
+  state->count = count;
+
+  const auto work = [state]()
+  {
+    size_t index;
+    while ((index = state->next++) < state->count)
+    {
+      state->function(index);
+      if (++state->done == state->count)
+        state->finished.Set();
+    }
+  };
+
+  for (size_t job = 0; job < std::min(count - 1, MAX_BATCH_JOBS); ++job)
+    jobManager->Submit(work, CJob::PRIORITY_HIGH);
+
+  work();
+  state->finished.Wait();
+}
+} // unnamed namespace
+
 bool CJSONRPC::m_initialized = false;
 
 void CJSONRPC::Initialize()
@@ -241,7 +303,20 @@ JSONRPC_STATUS CJSONRPC::NotifyAll(const std::string &method, ITransportLayer *t
 
 std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client)
 {
-  CVariant inputroot, outputroot, result;
+  CVariant outputroot;
+  std::string str;
+  if (MethodCall(inputString, transport, client, outputroot))
+    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+
+  return str;
+}
+
+bool CJSONRPC::MethodCall(const std::string& inputString,
+                          ITransportLayer* transport,
+                          IClient* client,
+                          CVariant& outputroot)
+{
+  CVariant inputroot;
   bool hasResponse = false;
 
   CLog::Log(LOGDEBUG, LOGJSONRPC, "JSONRPC: Incoming request: {}", inputString);
@@ -257,18 +332,7 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
         hasResponse = true;
       }
       else
-      {
-        for (CVariant::const_iterator_array itr = inputroot.begin_array();
-             itr != inputroot.end_array(); ++itr)
-        {
-          CVariant response;
-          if (HandleMethodCall(*itr, response, transport, client))
-          {
-            outputroot.append(response);
-            hasResponse = true;
-          }
-        }
-      }
+        hasResponse = HandleBatch(inputroot, outputroot, transport, client);
     }
     else
       hasResponse = HandleMethodCall(inputroot, outputroot, transport, client);
@@ -280,11 +344,67 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
     hasResponse = true;
   }
 
-  std::string str;
-  if (hasResponse)
-    CJSONVariantWriter::Write(outputroot, str, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+  return hasResponse;
+}
 
-  return str;
+bool CJSONRPC::HandleBatch(const CVariant& requests,
+                           CVariant& responses,
+                           ITransportLayer* transport,
+                           IClient* client)
+{
+  struct BatchCall
+  {
+    CVariant response;
+    bool hasResponse = false;
+  };
+
+  const unsigned int count = requests.size();
+  std::vector<BatchCall> calls(count);
+  const auto call = [&](unsigned int index)
+  {
+    BatchCall& batchCall = calls[index];
+    batchCall.hasResponse = HandleMethodCall(requests[index], batchCall.response, transport, client);
+  };
+
+  // consecutive read-only calls don't depend on each other and are executed in parallel, any
+  // other call is only executed once the calls before it have returned
+  unsigned int begin = 0;
+  while (begin < count)
+  {
+    unsigned int end = begin;
+    while (end < count && IsReadOnlyCall(requests[end]))
+      end++;
+
+    if (end == begin)
+      call(begin++);
+    else
+    {
+      ParallelFor(end - begin, [&](size_t index) { call(begin + index); });
+      begin = end;
+    }
+  }
+
+  bool hasResponse = false;
+  for (BatchCall& batchCall : calls)
+  {
+    if (batchCall.hasResponse)
+    {
+      responses.append(std::move(batchCall.response));
+      hasResponse = true;
+    }
+  }
+
+  return hasResponse;
+}
+
+bool CJSONRPC::IsReadOnlyCall(const CVariant& request)
+{
+  if (!IsProperJSONRPC(request))
+    return false;
+
+  std::string methodName = request["method"].asString();
+  StringUtils::ToLower(methodName);
+  return CJSONServiceDescription::IsReadOnly(methodName);
 }
 
 bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client)
@@ -317,7 +437,7 @@ bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITr
     errorCode = InvalidRequest;
   }
 
-  BuildResponse(request, errorCode, result, response);
+  BuildResponse(request, errorCode, std::move(result), response);
 
   return !isNotification;
 }
@@ -327,7 +447,10 @@ inline bool CJSONRPC::IsProperJSONRPC(const CVariant& inputroot)
   return inputroot.isMember("jsonrpc") && inputroot["jsonrpc"].isString() && inputroot["jsonrpc"] == CVariant("2.0") && inputroot.isMember("method") && inputroot["method"].isString() && (!inputroot.isMember("params") || inputroot["params"].isArray() || inputroot["params"].isObject());
 }
 
-inline void CJSONRPC::BuildResponse(const CVariant& request, JSONRPC_STATUS code, const CVariant& result, CVariant& response)
+inline void CJSONRPC::BuildResponse(const CVariant& request,
+                                    JSONRPC_STATUS code,
+                                    CVariant result,
+                                    CVariant& response)
 {
   response["jsonrpc"] = "2.0";
   response["id"] = request.isMember("id") ? request["id"] : CVariant();
@@ -335,7 +458,8 @@ inline void CJSONRPC::BuildResponse(const CVariant& request, JSONRPC_STATUS code
   switch (code)
   {
     case OK:
-      response["result"] = result;
+      // the result of library listings is large, don't copy it
+      response["result"] = std::move(result);
       break;
     case ACK:
       response["result"] = "OK";
@@ -349,7 +473,7 @@ inline void CJSONRPC::BuildResponse(const CVariant& request, JSONRPC_STATUS code
       response["error"]["code"] = status->status;
       response["error"]["message"] = status->message;
       if (status->hasData && !result.isNull())
-        response["error"]["data"] = result;
+        response["error"]["data"] = std::move(result);
       break;
     }
   }
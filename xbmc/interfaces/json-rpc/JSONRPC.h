@@ -53,6 +53,22 @@ namespace JSONRPC
      */
     static std::string MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client);
 
+    /*
+     \brief Handles an incoming JSON-RPC request without serializing the response
+     \param inputString received JSON-RPC request
+     \param transport Transport protocol on which the request arrived
+     \param client Client which sent the request
+     \param response JSON-RPC response to be sent back to the client
+     \return True if there is a response to be sent back, false for notifications
+
+     Like MethodCall() above, but leaves the serialization of the response to
+     the transport, e.g. to send out large responses while they are serialized.
+     */
+    static bool MethodCall(const std::string& inputString,
+                           ITransportLayer* transport,
+                           IClient* client,
+                           CVariant& response);
+
     static JSONRPC_STATUS Introspect(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Version(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Permission(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
@@ -62,10 +78,30 @@ namespace JSONRPC
     static JSONRPC_STATUS NotifyAll(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
 
   private:
+    /*
+     \brief Handles the requests of a batch call
+     \param requests non-empty array of the requests of the batch
+     \param responses array the responses are appended to, in the order of the requests
+     \param transport Transport protocol on which the requests arrived
+     \param client Client which sent the requests
+     \return True if there is at least one response to be sent back
+
+     Runs of consecutive calls to methods which only read data are executed
+     in parallel on the job manager, any other call is executed on its own
+     once the calls before it have returned.
+     */
+    static bool HandleBatch(const CVariant& requests,
+                            CVariant& responses,
+                            ITransportLayer* transport,
+                            IClient* client);
+    static bool IsReadOnlyCall(const CVariant& request);
     static bool HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client);
     static inline bool IsProperJSONRPC(const CVariant& inputroot);
 
-    inline static void BuildResponse(const CVariant& request, JSONRPC_STATUS code, const CVariant& result, CVariant& response);
+    inline static void BuildResponse(const CVariant& request,
+                                     JSONRPC_STATUS code,
+                                     CVariant result,
+                                     CVariant& response);
 
     static bool m_initialized;
   };
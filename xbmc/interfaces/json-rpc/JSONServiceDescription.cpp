@@ -33,6 +33,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <string_view>
+#include <utility>
 
 using namespace JSONRPC;
 
@@ -184,6 +186,8 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "GUI.GetStereoscopicModes",                     CGUIOperations::GetStereoscopicModes },
   { "GUI.ActivateScreenSaver",                      CGUIOperations::ActivateScreenSaver},
   { "GUI.TakeScreenshot",                           CGUIOperations::TakeScreenshot },
+  { "GUI.SetProfiling",                             CGUIOperations::SetProfiling },
+  { "GUI.GetProfile",                               CGUIOperations::GetProfile },
 
 // PVR operations
   { "PVR.GetProperties",                            CPVROperations::GetProperties },
@@ -622,6 +626,8 @@ bool JSONSchemaTypeDefinition::Parse(const CVariant &value, bool isParameter /*
       if (approved)
         enums.push_back(*enumItr);
     }
+
+    CompileEnums();
   }
 
   if (type != ObjectValue)
@@ -674,21 +680,42 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
                                                CVariant& outputValue,
                                                CVariant& errorData) const
 {
-  if (!name.empty())
-    errorData["name"] = name;
-  SchemaValueTypeToJson(type, errorData["type"]);
+  return check(value, outputValue, &errorData);
+}
+
+JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value, CVariant& outputValue) const
+{
+  return check(value, outputValue, nullptr);
+}
+
+JSONRPC_STATUS JSONSchemaTypeDefinition::check(const CVariant& value,
+                                               CVariant& outputValue,
+                                               CVariant* errorData) const
+{
+  // Without error data a failed check returns right away,
+  // the caller checks again to find out what was wrong
+  if (errorData != nullptr)
+  {
+    if (!name.empty())
+      (*errorData)["name"] = name;
+    SchemaValueTypeToJson(type, (*errorData)["type"]);
+  }
   std::string errorMessage;
 
   // Let's check the type of the provided parameter
   if (!IsType(value, type))
   {
+    if (errorData == nullptr)
+      return InvalidParams;
     errorMessage = StringUtils::Format("Invalid type {} received", ValueTypeToString(value.type()));
-    errorData["message"] = errorMessage.c_str();
+    (*errorData)["message"] = errorMessage.c_str();
     return InvalidParams;
   }
   else if (value.isNull() && !HasType(type, NullValue))
   {
-    errorData["message"] = "Received value is null";
+    if (errorData == nullptr)
+      return InvalidParams;
+    (*errorData)["message"] = "Received value is null";
     return InvalidParams;
   }
 
@@ -698,9 +725,8 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     bool ok = false;
     for (unsigned int unionIndex = 0; unionIndex < unionTypes.size(); unionIndex++)
     {
-      CVariant dummyError;
       CVariant testOutput = outputValue;
-      if (unionTypes.at(unionIndex)->Check(value, testOutput, dummyError) == OK)
+      if (unionTypes.at(unionIndex)->check(value, testOutput, nullptr) == OK)
       {
         ok = true;
         outputValue = testOutput;
@@ -710,7 +736,9 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
 
     if (!ok)
     {
-      errorData["message"] = "Received value does not match any of the union type definitions";
+      if (errorData == nullptr)
+        return InvalidParams;
+      (*errorData)["message"] = "Received value does not match any of the union type definitions";
       return InvalidParams;
     }
   }
@@ -722,15 +750,17 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
   {
     for (unsigned int extendsIndex = 0; extendsIndex < extends.size(); extendsIndex++)
     {
-      JSONRPC_STATUS status = extends.at(extendsIndex)->Check(value, outputValue, errorData);
+      JSONRPC_STATUS status = extends.at(extendsIndex)->check(value, outputValue, errorData);
 
       if (status != OK)
       {
+        if (errorData == nullptr)
+          return status;
         CLog::Log(LOGDEBUG, "JSONRPC: Value does not match extended type {} of type {}",
                   extends.at(extendsIndex)->ID, name);
         errorMessage = StringUtils::Format("value does not match extended type {}",
                                            extends.at(extendsIndex)->ID);
-        errorData["message"] = errorMessage.c_str();
+        (*errorData)["message"] = errorMessage.c_str();
         return status;
       }
     }
@@ -745,6 +775,8 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     // Check the number of items against minItems and maxItems
     if ((minItems > 0 && value.size() < minItems) || (maxItems > 0 && value.size() > maxItems))
     {
+      if (errorData == nullptr)
+        return InvalidParams;
       CLog::Log(
           LOGDEBUG,
           "JSONRPC: Number of array elements does not match minItems and/or maxItems in type {}",
@@ -758,7 +790,7 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
       else
         errorMessage = StringUtils::Format("Only {} array items expected but {} received", maxItems,
                                            value.size());
-      errorData["message"] = errorMessage.c_str();
+      (*errorData)["message"] = errorMessage.c_str();
       return InvalidParams;
     }
 
@@ -772,15 +804,18 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
       for (unsigned int arrayIndex = 0; arrayIndex < value.size(); arrayIndex++)
       {
         CVariant temp;
-        JSONRPC_STATUS status = itemType->Check(value[arrayIndex], temp, errorData["property"]);
-        outputValue.push_back(temp);
+        JSONRPC_STATUS status = itemType->check(
+            value[arrayIndex], temp, errorData ? &(*errorData)["property"] : nullptr);
+        outputValue.push_back(std::move(temp));
         if (status != OK)
         {
+          if (errorData == nullptr)
+            return status;
           CLog::Log(LOGDEBUG, "JSONRPC: Array element at index {} does not match in type {}",
                     arrayIndex, name);
           errorMessage =
               StringUtils::Format("array element at index {} does not match", arrayIndex);
-          errorData["message"] = errorMessage.c_str();
+          (*errorData)["message"] = errorMessage.c_str();
           return status;
         }
       }
@@ -798,9 +833,11 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
       // allowed there is no need to check every element
       if (value.size() < items.size() || (value.size() != items.size() && additionalItems.empty()))
       {
+        if (errorData == nullptr)
+          return InvalidParams;
         CLog::Log(LOGDEBUG, "JSONRPC: One of the array elements does not match in type {}", name);
         errorMessage = StringUtils::Format("{0} array elements expected but {1} received", items.size(), value.size());
-        errorData["message"] = errorMessage.c_str();
+        (*errorData)["message"] = errorMessage.c_str();
         return InvalidParams;
       }
 
@@ -810,9 +847,13 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
       unsigned int arrayIndex;
       for (arrayIndex = 0; arrayIndex < std::min(items.size(), (size_t)value.size()); arrayIndex++)
       {
-        JSONRPC_STATUS status = items.at(arrayIndex)->Check(value[arrayIndex], outputValue[arrayIndex], errorData["property"]);
+        JSONRPC_STATUS status =
+            items.at(arrayIndex)->check(value[arrayIndex], outputValue[arrayIndex],
+                                        errorData ? &(*errorData)["property"] : nullptr);
         if (status != OK)
         {
+          if (errorData == nullptr)
+            return status;
           CLog::Log(
               LOGDEBUG,
               "JSONRPC: Array element at index {} does not match with items schema in type {}",
@@ -831,8 +872,8 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
           bool ok = false;
           for (unsigned int additionalIndex = 0; additionalIndex < additionalItems.size(); additionalIndex++)
           {
-            CVariant dummyError;
-            if (additionalItems.at(additionalIndex)->Check(value[arrayIndex], outputValue[arrayIndex], dummyError) == OK)
+            if (additionalItems.at(additionalIndex)->check(value[arrayIndex],
+                                                           outputValue[arrayIndex], nullptr) == OK)
             {
               ok = true;
               break;
@@ -841,12 +882,14 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
 
           if (!ok)
           {
+            if (errorData == nullptr)
+              return InvalidParams;
             CLog::Log(LOGDEBUG,
                       "JSONRPC: Array contains non-conforming additional items in type {}", name);
             errorMessage = StringUtils::Format(
                 "Array element at index {} does not match the \"additionalItems\" schema",
                 arrayIndex);
-            errorData["message"] = errorMessage.c_str();
+            (*errorData)["message"] = errorMessage.c_str();
             return InvalidParams;
           }
         }
@@ -863,12 +906,14 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
           // If two elements are the same they are not unique
           if (outputValue[checkingIndex] == outputValue[checkedIndex])
           {
+            if (errorData == nullptr)
+              return InvalidParams;
             CLog::Log(LOGDEBUG, "JSONRPC: Not unique array element at index {} and {} in type {}",
                       checkingIndex, checkedIndex, name);
             errorMessage = StringUtils::Format(
                 "Array element at index {} is not unique (same as array element at index {})",
                 checkingIndex, checkedIndex);
-            errorData["message"] = errorMessage.c_str();
+            (*errorData)["message"] = errorMessage.c_str();
             return InvalidParams;
           }
         }
@@ -889,9 +934,13 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     {
       if (value.isMember(propertiesIterator->second->name))
       {
-        JSONRPC_STATUS status = propertiesIterator->second->Check(value[propertiesIterator->second->name], outputValue[propertiesIterator->second->name], errorData["property"]);
+        JSONRPC_STATUS status = propertiesIterator->second->check(
+            value[propertiesIterator->second->name], outputValue[propertiesIterator->second->name],
+            errorData ? &(*errorData)["property"] : nullptr);
         if (status != OK)
         {
+          if (errorData == nullptr)
+            return status;
           CLog::Log(LOGDEBUG, "JSONRPC: Invalid property \"{}\" in type {}",
                     propertiesIterator->second->name, name);
           return status;
@@ -902,9 +951,11 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
         outputValue[propertiesIterator->second->name] = propertiesIterator->second->defaultValue;
       else
       {
-        errorData["property"]["name"] = propertiesIterator->second->name.c_str();
-        errorData["property"]["type"] = SchemaValueTypeToString(propertiesIterator->second->type);
-        errorData["message"] = "Missing property";
+        if (errorData == nullptr)
+          return InvalidParams;
+        (*errorData)["property"]["name"] = propertiesIterator->second->name.c_str();
+        (*errorData)["property"]["type"] = SchemaValueTypeToString(propertiesIterator->second->type);
+        (*errorData)["message"] = "Missing property";
         return InvalidParams;
       }
     }
@@ -932,9 +983,13 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
             continue;
           }
 
-          JSONRPC_STATUS status = additionalProperties->Check(value[iter->first], outputValue[iter->first], errorData["property"]);
+          JSONRPC_STATUS status =
+              additionalProperties->check(value[iter->first], outputValue[iter->first],
+                                          errorData ? &(*errorData)["property"] : nullptr);
           if (status != OK)
           {
+            if (errorData == nullptr)
+              return status;
             CLog::Log(LOGDEBUG, "JSONRPC: Invalid additional property \"{}\" in type {}",
                       iter->first, name);
             return status;
@@ -945,8 +1000,10 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
       // properties are not allowed, we have invalid parameters
       else if (!hasAdditionalProperties || additionalProperties == NULL)
       {
-        errorData["message"] = "Unexpected additional properties received";
-        errorData.erase("property");
+        if (errorData == nullptr)
+          return InvalidParams;
+        (*errorData)["message"] = "Unexpected additional properties received";
+        errorData->erase("property");
         return InvalidParams;
       }
     }
@@ -960,20 +1017,18 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
   // we need to check against those
   if (!enums.empty())
   {
-    bool valid = false;
-    for (const auto& enumItr : enums)
-    {
-      if (enumItr == value)
-      {
-        valid = true;
-        break;
-      }
-    }
+    bool valid;
+    if (value.isString())
+      valid = stringEnums.contains(std::string_view(value.c_str(), value.size()));
+    else
+      valid = std::ranges::find(enums, value) != enums.end();
 
     if (!valid)
     {
+      if (errorData == nullptr)
+        return InvalidParams;
       CLog::Log(LOGDEBUG, "JSONRPC: Value does not match any of the enum values in type {}", name);
-      errorData["message"] = "Received value does not match any of the defined enum values";
+      (*errorData)["message"] = "Received value does not match any of the defined enum values";
       return InvalidParams;
     }
   }
@@ -992,6 +1047,8 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     // Check maximum
         (exclusiveMaximum && numberValue >= maximum) || (!exclusiveMaximum && numberValue > maximum))
     {
+      if (errorData == nullptr)
+        return InvalidParams;
       CLog::Log(LOGDEBUG, "JSONRPC: Value does not lay between minimum and maximum in type {}",
                 name);
       if (value.isDouble())
@@ -1004,16 +1061,18 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
             "Value between {} ({}) and {} ({}) expected but {} received", (int)minimum,
             exclusiveMinimum ? "exclusive" : "inclusive", (int)maximum,
             exclusiveMaximum ? "exclusive" : "inclusive", (int)numberValue);
-      errorData["message"] = errorMessage.c_str();
+      (*errorData)["message"] = errorMessage.c_str();
       return InvalidParams;
     }
     // Check divisibleBy
     if ((HasType(type, IntegerValue) && divisibleBy > 0 && ((int)numberValue % divisibleBy) != 0))
     {
+      if (errorData == nullptr)
+        return InvalidParams;
       CLog::Log(LOGDEBUG, "JSONRPC: Value does not meet divisibleBy requirements in type {}", name);
       errorMessage = StringUtils::Format("Value should be divisible by {} but {} received",
                                          divisibleBy, (int)numberValue);
-      errorData["message"] = errorMessage.c_str();
+      (*errorData)["message"] = errorMessage.c_str();
       return InvalidParams;
     }
   }
@@ -1021,22 +1080,26 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
   // If we have a string, we need to check the length
   if (HasType(type, StringValue) && value.isString())
   {
-    int size = static_cast<int>(value.asString().size());
+    int size = static_cast<int>(value.size());
     if (size < minLength)
     {
+      if (errorData == nullptr)
+        return InvalidParams;
       CLog::Log(LOGDEBUG, "JSONRPC: Value does not meet minLength requirements in type {}", name);
       errorMessage = StringUtils::Format(
           "Value should have a minimum length of {} but has a length of {}", minLength, size);
-      errorData["message"] = errorMessage.c_str();
+      (*errorData)["message"] = errorMessage.c_str();
       return InvalidParams;
     }
 
     if (maxLength >= 0 && size > maxLength)
     {
+      if (errorData == nullptr)
+        return InvalidParams;
       CLog::Log(LOGDEBUG, "JSONRPC: Value does not meet maxLength requirements in type {}", name);
       errorMessage = StringUtils::Format(
           "Value should have a maximum length of {} but has a length of {}", maxLength, size);
-      errorData["message"] = errorMessage.c_str();
+      (*errorData)["message"] = errorMessage.c_str();
       return InvalidParams;
     }
   }
@@ -1204,6 +1267,16 @@ void JSONSchemaTypeDefinition::Print(bool isParameter, bool isGlobal, bool print
   }
 }
 
+void JSONSchemaTypeDefinition::CompileEnums()
+{
+  stringEnums.clear();
+  for (const auto& value : enums)
+  {
+    if (value.isString())
+      stringEnums.emplace(value.asString());
+  }
+}
+
 void JSONSchemaTypeDefinition::ResolveReference()
 {
   // Check and set the reference type before recursing
@@ -1328,6 +1401,8 @@ bool JsonRpcMethod::Parse(const CVariant &value)
   else
     permission = StringToPermission(value.isMember("permission") ? value["permission"].asString() : "");
 
+  sideeffects = value.isMember("sideeffects") && value["sideeffects"].asBoolean();
+
   description = GetString(value["description"], "");
 
   // Check whether there are parameters defined
@@ -1382,31 +1457,40 @@ JSONRPC_STATUS JsonRpcMethod::Check(const CVariant &requestParameters, ITranspor
       // Count the number of actually handled (present)
       // parameters
       unsigned int handled = 0;
+
+      // Loop through all the parameters to check
+      JSONRPC_STATUS status = OK;
+      for (unsigned int i = 0; i < parameters.size() && status == OK; i++)
+        status = checkParameter(requestParameters, parameters.at(i), i, outputParameters, handled,
+                                nullptr);
+
+      // Check if there were unnecessary parameters
+      if (status == OK && handled >= requestParameters.size())
+        return OK;
+
+      // Check again to collect the error data object
+      // and return it in the outputParameters reference
       CVariant errorData = CVariant(CVariant::VariantTypeObject);
       errorData["method"] = name;
 
-      // Loop through all the parameters to check
+      handled = 0;
+      outputParameters = CVariant();
       for (unsigned int i = 0; i < parameters.size(); i++)
       {
-        // Evaluate the current parameter
-        JSONRPC_STATUS status = checkParameter(requestParameters, parameters.at(i), i, outputParameters, handled, errorData);
+        status = checkParameter(requestParameters, parameters.at(i), i, outputParameters, handled,
+                                &errorData);
         if (status != OK)
-        {
-          // Return the error data object in the outputParameters reference
-          outputParameters = errorData;
-          return status;
-        }
+          break;
       }
 
-      // Check if there were unnecessary parameters
-      if (handled < requestParameters.size())
+      if (status == OK)
       {
         errorData["message"] = "Too many parameters";
-        outputParameters = errorData;
-        return InvalidParams;
+        status = InvalidParams;
       }
 
-      return OK;
+      outputParameters = errorData;
+      return status;
     }
     else
       return BadPermission;
@@ -1452,16 +1536,21 @@ JSONRPC_STATUS JsonRpcMethod::checkParameter(const CVariant& requestParameters,
                                              unsigned int position,
                                              CVariant& outputParameters,
                                              unsigned int& handled,
-                                             CVariant& errorData)
+                                             CVariant* errorData)
 {
   // Let's check if the parameter has been provided
   if (ParameterExists(requestParameters, type->name, position))
   {
     // Get the parameter
-    CVariant parameterValue = GetParameter(requestParameters, type->name, position);
+    const CVariant& parameterValue = IsValueMember(requestParameters, type->name)
+                                         ? requestParameters[type->name]
+                                         : requestParameters[position];
 
     // Evaluate the type of the parameter
-    JSONRPC_STATUS status = type->Check(parameterValue, outputParameters[type->name], errorData["stack"]);
+    JSONRPC_STATUS status =
+        errorData != nullptr
+            ? type->Check(parameterValue, outputParameters[type->name], (*errorData)["stack"])
+            : type->Check(parameterValue, outputParameters[type->name]);
     if (status != OK)
       return status;
 
@@ -1475,9 +1564,12 @@ JSONRPC_STATUS JsonRpcMethod::checkParameter(const CVariant& requestParameters,
   // The parameter is required but has not been provided => invalid
   else
   {
-    errorData["stack"]["name"] = type->name;
-    SchemaValueTypeToJson(type->type, errorData["stack"]["type"]);
-    errorData["stack"]["message"] = "Missing parameter";
+    if (errorData != nullptr)
+    {
+      (*errorData)["stack"]["name"] = type->name;
+      SchemaValueTypeToJson(type->type, (*errorData)["stack"]["type"]);
+      (*errorData)["stack"]["message"] = "Missing parameter";
+    }
     return InvalidParams;
   }
 
@@ -1737,6 +1829,7 @@ bool CJSONServiceDescription::AddEnum(const std::string &name, const std::vector
       return false;
   }
   definition->enums.insert(definition->enums.begin(), values.begin(), values.end());
+  definition->CompileEnums();
 
   int schemaType = (int)AnyValue;
   for (unsigned int index = 0; index < types.size(); index++)
@@ -1971,6 +2064,9 @@ JSONRPC_STATUS CJSONServiceDescription::Print(CVariant &result, ITransportLayer
         currentMethod["permission"] = permissions[0];
       else
         currentMethod["permission"] = permissions;
+
+      if (methodIterator->second.sideeffects)
+        currentMethod["sideeffects"] = true;
     }
 
     currentMethod["params"] = CVariant(CVariant::VariantTypeArray);
@@ -2018,6 +2114,13 @@ JSONRPC_STATUS CJSONServiceDescription::CheckCall(const char* const method, cons
   return MethodNotFound;
 }
 
+bool CJSONServiceDescription::IsReadOnly(const std::string& method)
+{
+  CJsonRpcMethodMap::JsonRpcMethodIterator iter = m_actionMap.find(method);
+  return iter != m_actionMap.end() && iter->second.permission == ReadData &&
+         !iter->second.sideeffects;
+}
+
 JSONSchemaTypeDefinitionPtr CJSONServiceDescription::GetType(const std::string &identification)
 {
   std::map<std::string, JSONSchemaTypeDefinitionPtr>::iterator iter = m_types.find(identification);
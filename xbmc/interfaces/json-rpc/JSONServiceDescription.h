@@ -11,8 +11,10 @@
 #include "JSONUtils.h"
 #include "utils/Variant.h"
 
+#include <functional>
 #include <limits>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -38,8 +40,14 @@ namespace JSONRPC
 
     bool Parse(const CVariant &value, bool isParameter = false);
     JSONRPC_STATUS Check(const CVariant& value, CVariant& outputValue, CVariant& errorData) const;
+    /*!
+     \brief Checks the value without collecting error data,
+     which is faster for the common case of a valid value
+     */
+    JSONRPC_STATUS Check(const CVariant& value, CVariant& outputValue) const;
     void Print(bool isParameter, bool isGlobal, bool printDefault, bool printDescriptions, CVariant &output) const;
     void ResolveReference();
+    void CompileEnums();
 
     std::string missingReference;
 
@@ -147,6 +155,12 @@ namespace JSONRPC
      */
     std::vector<CVariant> enums;
 
+    /*!
+     \brief The string values of "enums" for
+     looking up string values quickly
+     */
+    std::set<std::string, std::less<>> stringEnums;
+
     /*!
      \brief List of possible values in an array
      */
@@ -211,6 +225,9 @@ namespace JSONRPC
      \brief Type definition for additional properties
      */
     JSONSchemaTypeDefinitionPtr additionalProperties;
+
+  private:
+    JSONRPC_STATUS check(const CVariant& value, CVariant& outputValue, CVariant* errorData) const;
   };
 
   /*!
@@ -251,6 +268,12 @@ namespace JSONRPC
      to execute the method
      */
     OperationPermission permission = ReadData;
+    /*!
+     \brief Whether the method has side effects
+     although it only needs the ReadData permission
+     (e.g. sending notifications or handing out downloads)
+     */
+    bool sideeffects = false;
     /*!
      \brief Description of the method
      */
@@ -272,7 +295,7 @@ namespace JSONRPC
                                          unsigned int position,
                                          CVariant& outputParameters,
                                          unsigned int& handled,
-                                         CVariant& errorData);
+                                         CVariant* errorData);
   };
 
   /*!
@@ -385,6 +408,17 @@ namespace JSONRPC
      */
     static JSONRPC_STATUS CheckCall(const char* method, const CVariant &requestParameters, ITransportLayer *transport, IClient *client, bool notification, MethodCall &methodCall, CVariant &outputParameters);
 
+    /*!
+     \brief Checks whether the given method only reads data
+     \param method Called method (in lower case)
+     \return True if the method only needs the ReadData permission and isn't marked with
+     "sideeffects" in its schema
+
+     Such methods don't depend on each other, so the calls of a
+     batch request can be executed at the same time.
+     */
+    static bool IsReadOnly(const std::string& method);
+
     static JSONSchemaTypeDefinitionPtr GetType(const std::string &identification);
 
     static void ResolveReferences();
@@ -833,7 +833,7 @@ JSONRPC_STATUS CSettingsOperations::GetSkinSettings(const std::string& method,
                                                     const CVariant& parameterObject,
                                                     CVariant& result)
 {
-  const std::set<ADDON::CSkinSettingPtr> settings = CSkinSettings::GetInstance().GetSettings();
+  const auto settings = CSkinSettings::GetInstance().GetSettings();
   CVariant varSettings(CVariant::VariantTypeArray);
 
   for (const auto& setting : settings)
@@ -843,12 +843,13 @@ JSONRPC_STATUS CSettingsOperations::GetSkinSettings(const std::string& method,
 
     if (setting->GetType() == "bool")
     {
-      varSetting["value"] = std::static_pointer_cast<ADDON::CSkinSettingBool>(setting)->value;
+      varSetting["value"] = std::static_pointer_cast<const ADDON::CSkinSettingBool>(setting)->value;
       varSetting["type"] = "boolean";
     }
     else if (setting->GetType() == "string")
     {
-      varSetting["value"] = std::static_pointer_cast<ADDON::CSkinSettingString>(setting)->value;
+      varSetting["value"] =
+          std::static_pointer_cast<const ADDON::CSkinSettingString>(setting)->value;
       varSetting["type"] = setting->GetType();
     }
     else
@@ -870,16 +871,16 @@ JSONRPC_STATUS CSettingsOperations::GetSkinSettingValue(const std::string& metho
                                                         CVariant& result)
 {
   const std::string settingId = parameterObject["setting"].asString();
-  ADDON::CSkinSettingPtr setting = CSkinSettings::GetInstance().GetSetting(settingId);
+  const auto setting = CSkinSettings::GetInstance().GetSetting(settingId);
 
   if (setting == nullptr)
     return InvalidParams;
 
   CVariant value;
   if (setting->GetType() == "string")
-    value = std::static_pointer_cast<ADDON::CSkinSettingString>(setting)->value;
+    value = std::static_pointer_cast<const ADDON::CSkinSettingString>(setting)->value;
   else if (setting->GetType() == "bool")
-    value = std::static_pointer_cast<ADDON::CSkinSettingBool>(setting)->value;
+    value = std::static_pointer_cast<const ADDON::CSkinSettingBool>(setting)->value;
   else
     return InvalidParams;
 
@@ -894,25 +895,25 @@ JSONRPC_STATUS CSettingsOperations::SetSkinSettingValue(const std::string& metho
                                                         CVariant& result)
 {
   const std::string settingId = parameterObject["setting"].asString();
-  ADDON::CSkinSettingPtr setting = CSkinSettings::GetInstance().GetSetting(settingId);
+  const auto setting = CSkinSettings::GetInstance().GetSetting(settingId);
 
   if (setting == nullptr)
     return InvalidParams;
 
-  CVariant value = parameterObject["value"];
+  const CVariant& value = parameterObject["value"];
   if (setting->GetType() == "string")
   {
-    if (!value.isString())
+    if (!value.isString() || !CSkinSettings::GetInstance().SetString(settingId, value.asString()))
       return InvalidParams;
 
-    result = std::static_pointer_cast<ADDON::CSkinSettingString>(setting)->value = value.asString();
+    result = value.asString();
   }
   else if (setting->GetType() == "bool")
   {
-    if (!value.isBoolean())
+    if (!value.isBoolean() || !CSkinSettings::GetInstance().SetBool(settingId, value.asBoolean()))
       return InvalidParams;
 
-    result = std::static_pointer_cast<ADDON::CSkinSettingBool>(setting)->value = value.asBoolean();
+    result = value.asBoolean();
   }
   else
   {
@@ -0,0 +1,330 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "interfaces/json-rpc/JSONRPC.h"
+#include "interfaces/json-rpc/JSONServiceDescription.h"
+#include "jobs/JobManager.h"
+#include "utils/Variant.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace JSONRPC;
+using namespace std::chrono_literals;
+
+namespace
+{
+//! Stand-in for the transport of CTCPServer
+class CTCPTransport : public ITransportLayer
+{
+public:
+  bool PrepareDownload(const char* path, CVariant& details, std::string& protocol) override
+  {
+    return false;
+  }
+  bool Download(const char* path, CVariant& result) override { return false; }
+  int GetCapabilities() override { return Response | Announcing; }
+};
+
+//! Stand-in for the transport of CHTTPJsonRpcHandler
+class CHTTPTransport : public ITransportLayer
+{
+public:
+  bool PrepareDownload(const char* path, CVariant& details, std::string& protocol) override
+  {
+    return false;
+  }
+  bool Download(const char* path, CVariant& result) override { return false; }
+  int GetCapabilities() override { return Response | FileDownloadRedirect; }
+};
+
+class CClient : public IClient
+{
+public:
+  int GetPermissionFlags() override { return OPERATION_PERMISSION_ALL; }
+  int GetAnnouncementFlags() override { return 0; }
+  bool SetAnnouncementFlags(int flags) override { return false; }
+};
+
+std::atomic<int> s_running{0};
+std::atomic<int> s_maxRunning{0};
+std::atomic<int> s_writes{0};
+std::mutex s_runningMutex;
+std::condition_variable s_runningCondition;
+
+//! Reads data like the *.Get* methods, which mostly wait for a database. With "rendezvous" set, it
+//! waits until that many calls ran at the same time, so that tests don't depend on timing.
+JSONRPC_STATUS Read(const std::string& method,
+                    ITransportLayer* transport,
+                    IClient* client,
+                    const CVariant& parameterObject,
+                    CVariant& result)
+{
+  const int running = ++s_running;
+  int maxRunning = s_maxRunning;
+  while (running > maxRunning && !s_maxRunning.compare_exchange_weak(maxRunning, running))
+  {
+  }
+
+  const int rendezvous = static_cast<int>(parameterObject["rendezvous"].asInteger());
+  if (rendezvous > 0)
+  {
+    std::unique_lock lock(s_runningMutex);
+    s_runningCondition.notify_all();
+    s_runningCondition.wait_for(lock, 10s, [rendezvous] { return s_maxRunning >= rendezvous; });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(parameterObject["delay"].asInteger()));
+  result["writes"] = s_writes.load();
+  result["properties"] = parameterObject["properties"];
+
+  --s_running;
+  return OK;
+}
+
+JSONRPC_STATUS Write(const std::string& method,
+                     ITransportLayer* transport,
+                     IClient* client,
+                     const CVariant& parameterObject,
+                     CVariant& result)
+{
+  s_writes++;
+  return ACK;
+}
+
+constexpr const char* READ_METHOD = R"("Test.Read": {
+  "type": "method",
+  "description": "Read some data",
+  "transport": "Response",
+  "permission": "ReadData",
+  "params": [
+    { "name": "delay", "type": "integer", "minimum": 0, "default": 0 },
+    { "name": "rendezvous", "type": "integer", "minimum": 0, "default": 0 },
+    { "name": "properties", "type": "array", "uniqueItems": true, "default": [],
+      "items": { "type": "string", "enum": [ "title", "artist", "album", "genre", "year",
+        "rating", "duration", "playcount", "thumbnail", "fanart", "file", "lastplayed",
+        "dateadded", "comment", "track", "disc", "speed", "time", "percentage", "totaltime" ] } }
+  ],
+  "returns": "object"
+})";
+
+//! Only needs ReadData like JSONRPC.NotifyAll, but is marked as having side effects
+constexpr const char* NOTIFY_METHOD = R"("JSONRPC.NotifyAll": {
+  "type": "method",
+  "description": "Notify all other connected clients",
+  "transport": "Response",
+  "permission": "ReadData",
+  "sideeffects": true,
+  "params": [],
+  "returns": "any"
+})";
+
+constexpr const char* WRITE_METHOD = R"("Test.Write": {
+  "type": "method",
+  "description": "Update some data",
+  "transport": "Response",
+  "permission": "UpdateData",
+  "params": [],
+  "returns": "string"
+})";
+
+std::string CreateBatch(int calls, int delay, const std::string& properties)
+{
+  std::string batch = "[";
+  for (int id = 1; id <= calls; ++id)
+  {
+    if (id > 1)
+      batch += ",";
+    batch += R"({"jsonrpc": "2.0", "method": "Test.Read", "id": )" + std::to_string(id) +
+             R"(, "params": {"delay": )" + std::to_string(delay) +
+             R"(, "properties": )" + properties + "}}";
+  }
+  return batch + "]";
+}
+
+class TestJSONRPCBatch : public testing::Test
+{
+protected:
+  TestJSONRPCBatch()
+  {
+    CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+    CJSONServiceDescription::AddMethod(READ_METHOD, Read);
+    CJSONServiceDescription::AddMethod(WRITE_METHOD, Write);
+    CJSONServiceDescription::AddMethod(NOTIFY_METHOD, Write);
+    s_running = 0;
+    s_maxRunning = 0;
+    s_writes = 0;
+  }
+
+  ~TestJSONRPCBatch() override
+  {
+    CJSONServiceDescription::Cleanup();
+    UnregisterJobManager();
+  }
+
+  static void UnregisterJobManager()
+  {
+    const std::shared_ptr<CJobManager> jobManager = CServiceBroker::GetJobManager();
+    if (!jobManager)
+      return;
+
+    jobManager->CancelJobs();
+    jobManager->Restart();
+    CServiceBroker::UnregisterJobManager();
+  }
+
+  CTCPTransport m_tcp;
+  CHTTPTransport m_http;
+  CClient m_client;
+};
+} // unnamed namespace
+
+TEST_F(TestJSONRPCBatch, ReadOnlyMethods)
+{
+  EXPECT_TRUE(CJSONServiceDescription::IsReadOnly("test.read"));
+  EXPECT_FALSE(CJSONServiceDescription::IsReadOnly("test.write"));
+  EXPECT_FALSE(CJSONServiceDescription::IsReadOnly("jsonrpc.notifyall"));
+  EXPECT_FALSE(CJSONServiceDescription::IsReadOnly("test.unknown"));
+}
+
+TEST_F(TestJSONRPCBatch, RespondsInRequestOrder)
+{
+  const std::string batch = R"([
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 1, "params": {"delay": 30, "rendezvous": 2}},
+    {"jsonrpc": "2.0", "method": "Test.Read", "params": {"delay": 20}},
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": "two", "params": {"delay": 10, "rendezvous": 2}},
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 3, "params": {"delay": -1}},
+    {"jsonrpc": "1.0", "method": "Test.Read", "id": 4},
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 5}
+  ])";
+
+  CVariant response;
+  ASSERT_TRUE(CJSONRPC::MethodCall(batch, &m_tcp, &m_client, response));
+  ASSERT_EQ(5u, response.size());
+  EXPECT_EQ(1, response[0]["id"].asInteger());
+  EXPECT_TRUE(response[0].isMember("result"));
+  EXPECT_EQ("two", response[1]["id"].asString());
+  EXPECT_EQ(3, response[2]["id"].asInteger());
+  EXPECT_EQ(InvalidParams, response[2]["error"]["code"].asInteger());
+  EXPECT_EQ("test.read", response[2]["error"]["data"]["method"].asString());
+  EXPECT_EQ("delay", response[2]["error"]["data"]["stack"]["name"].asString());
+  EXPECT_EQ(4, response[3]["id"].asInteger());
+  EXPECT_EQ(InvalidRequest, response[3]["error"]["code"].asInteger());
+  EXPECT_EQ(5, response[4]["id"].asInteger());
+  EXPECT_GE(s_maxRunning.load(), 2);
+}
+
+TEST_F(TestJSONRPCBatch, WritesAreNotReordered)
+{
+  const std::string batch = R"([
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 1, "params": {"delay": 20}},
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 2},
+    {"jsonrpc": "2.0", "method": "Test.Write", "id": 3},
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 4},
+    {"jsonrpc": "2.0", "method": "Test.Write", "id": 5},
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 6, "params": {"delay": 20}},
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 7},
+    {"jsonrpc": "2.0", "method": "JSONRPC.NotifyAll", "id": 8},
+    {"jsonrpc": "2.0", "method": "Test.Read", "id": 9}
+  ])";
+
+  CVariant response;
+  ASSERT_TRUE(CJSONRPC::MethodCall(batch, &m_http, &m_client, response));
+  ASSERT_EQ(9u, response.size());
+  EXPECT_EQ(0, response[0]["result"]["writes"].asInteger());
+  EXPECT_EQ(0, response[1]["result"]["writes"].asInteger());
+  EXPECT_EQ("OK", response[2]["result"].asString());
+  EXPECT_EQ(1, response[3]["result"]["writes"].asInteger());
+  EXPECT_EQ("OK", response[4]["result"].asString());
+  EXPECT_EQ(2, response[5]["result"]["writes"].asInteger());
+  EXPECT_EQ(2, response[6]["result"]["writes"].asInteger());
+  EXPECT_EQ("OK", response[7]["result"].asString());
+  EXPECT_EQ(3, response[8]["result"]["writes"].asInteger());
+}
+
+TEST_F(TestJSONRPCBatch, ExecutesSeriallyWithoutJobManager)
+{
+  UnregisterJobManager();
+
+  CVariant response;
+  ASSERT_TRUE(CJSONRPC::MethodCall(CreateBatch(5, 1, "[]"), &m_tcp, &m_client, response));
+  EXPECT_EQ(5u, response.size());
+  EXPECT_EQ(1, s_maxRunning.load());
+
+  CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+}
+
+/*!
+ Sends the batches a remote control app sends every second, 40 calls which take 2 ms each and ask
+ for a list of properties, over the TCP and the HTTP transport, once executed serially and once
+ the way batches are executed now, and measures the time it takes to validate the parameters of a
+ call.
+ */
+TEST_F(TestJSONRPCBatch, DISABLED_LoadTest)
+{
+  constexpr int BATCHES = 10;
+  constexpr int CALLS = 40;
+  constexpr int DELAY_MS = 2;
+  constexpr int CHECKS = 10000;
+
+  using Duration = std::chrono::duration<double, std::milli>;
+
+  const std::string properties =
+      R"(["title", "artist", "album", "duration", "thumbnail", "speed", "time", "totaltime"])";
+  const std::string batch = CreateBatch(CALLS, DELAY_MS, properties);
+
+  const auto run = [&](ITransportLayer* transport)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BATCHES; ++i)
+    {
+      CVariant response;
+      EXPECT_TRUE(CJSONRPC::MethodCall(batch, transport, &m_client, response));
+      EXPECT_EQ(static_cast<unsigned int>(CALLS), response.size());
+      EXPECT_EQ(8u, response[CALLS - 1]["result"]["properties"].size());
+    }
+    return Duration(std::chrono::steady_clock::now() - start).count() / BATCHES;
+  };
+
+  const double tcpBatchMs = run(&m_tcp);
+  const double httpBatchMs = run(&m_http);
+
+  UnregisterJobManager();
+  const double serialBatchMs = run(&m_tcp);
+  CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+
+  CVariant parameters;
+  parameters["delay"] = 0;
+  for (const char* property : {"title", "artist", "album", "duration", "thumbnail", "speed",
+                               "time", "totaltime"})
+    parameters["properties"].push_back(property);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < CHECKS; ++i)
+  {
+    MethodCall method;
+    CVariant outputParameters;
+    ASSERT_EQ(OK, CJSONServiceDescription::CheckCall("test.read", parameters, &m_tcp, &m_client,
+                                                     false, method, outputParameters));
+  }
+  const Duration checkTime = std::chrono::steady_clock::now() - start;
+
+  RecordProperty("CallsPerBatch", CALLS);
+  RecordProperty("SerialBatchMs", std::to_string(serialBatchMs));
+  RecordProperty("TCPBatchMs", std::to_string(tcpBatchMs));
+  RecordProperty("HTTPBatchMs", std::to_string(httpBatchMs));
+  RecordProperty("CheckCallUs", std::to_string(checkTime.count() * 1000 / CHECKS));
+}
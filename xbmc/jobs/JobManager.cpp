@@ -36,10 +36,21 @@ size_t CJob::GetPendingCallbackCount() const
   return 0;
 }
 
+namespace
+{
+// Identifies the job manager and shards used by the calling worker thread, if any
+thread_local const CJobManager* t_manager{nullptr};
+thread_local size_t t_homeShard{0};
+thread_local size_t t_currentShard{0};
+} // namespace
+
 class CJobManager::CJobWorker : private CThread
 {
 public:
-  explicit CJobWorker(CJobManager& manager) : CThread("JobWorker"), m_jobManager(manager)
+  CJobWorker(CJobManager& manager, size_t homeShard)
+    : CThread("JobWorker"),
+      m_jobManager(manager),
+      m_homeShard(homeShard)
   {
     Create(true); // start work immediately, and kill ourselves when we're done
   }
@@ -54,6 +65,8 @@ public:
   void Process() override
   {
     SetPriority(ThreadPriority::LOWEST);
+    t_manager = &m_jobManager;
+    t_homeShard = m_homeShard;
     while (true)
     {
       // request an item from our manager (this call is blocking)
@@ -72,10 +85,12 @@ public:
       }
       m_jobManager.OnJobComplete(success, job);
     }
+    t_manager = nullptr;
   }
 
 private:
   CJobManager& m_jobManager;
+  size_t m_homeShard{0};
 };
 
 struct CJobManager::JobFinder
@@ -86,9 +101,16 @@ struct CJobManager::JobFinder
   const CJob* m_job{nullptr};
 };
 
+CJobManager::CJobManager()
+{
+  const unsigned int shards{GetMaxWorkers(CJob::PRIORITY_HIGH)};
+  m_shards.reserve(shards);
+  for (unsigned int i = 0; i < shards; ++i)
+    m_shards.emplace_back(std::make_unique<CShard>());
+}
+
 bool CJobManager::IsRunning() const
 {
-  std::unique_lock lock(m_section);
   return m_running;
 }
 
@@ -106,29 +128,36 @@ void CJobManager::CancelJobs()
   std::unique_lock lock(m_section);
   m_running = false;
 
-  // clear any pending jobs
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
-       ++priority)
+  for (const auto& shard : m_shards)
   {
-    std::ranges::for_each(m_jobQueue[priority],
+    std::unique_lock shardLock(shard->m_section);
+
+    // clear any pending jobs
+    for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
+         ++priority)
+    {
+      JobQueue& queue{shard->m_jobQueue[priority]};
+      std::ranges::for_each(queue,
+                            [](CWorkItem& wi)
+                            {
+                              for (auto* callback : wi.GetCallbacks())
+                                callback->OnJobAbort(wi.GetId(), wi.GetJob());
+                              wi.FreeJob();
+                            });
+      m_queued[priority] -= queue.size();
+      queue.clear();
+    }
+
+    // cancel any callbacks on jobs still processing
+    std::ranges::for_each(shard->m_processing,
                           [](CWorkItem& wi)
                           {
                             for (auto* callback : wi.GetCallbacks())
                               callback->OnJobAbort(wi.GetId(), wi.GetJob());
-                            wi.FreeJob();
+                            wi.Cancel();
                           });
-    m_jobQueue[priority].clear();
   }
 
-  // cancel any callbacks on jobs still processing
-  std::ranges::for_each(m_processing,
-                        [](CWorkItem& wi)
-                        {
-                          for (auto* callback : wi.GetCallbacks())
-                            callback->OnJobAbort(wi.GetId(), wi.GetJob());
-                          wi.Cancel();
-                        });
-
   // tell our workers to finish
   while (!m_workers.empty())
   {
@@ -149,27 +178,32 @@ unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORI
     return 0;
   }
 
-  // Check if we have this job already in the queue - if so, add callback to existing job
-  auto it = std::ranges::find_if(m_jobQueue[priority],
-                                 [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); });
-  if (it != m_jobQueue[priority].end())
-  {
-    it->AddCallback(callback);
-    delete job;
-    return it->GetId();
-  }
-
-  // Check if an equal job is already processing - if so, add callback to it.
-  // Note: Jobs that have moved to completion phase (removed from m_processing)
+  // Check if we have this job already in the queue or processing - if so, add callback to
+  // existing job.
+  // Note: Jobs that have moved to completion phase (removed from the processing list)
   // won't be found here, causing a new job to be created. This is intentional -
   // the completing job's results are about to be delivered to existing callbacks.
-  auto procIt = std::ranges::find_if(m_processing, [job](const CWorkItem& wi)
-                                     { return wi.GetJob()->Equals(job); });
-  if (procIt != m_processing.end())
+  for (const auto& shard : m_shards)
   {
-    procIt->AddCallback(callback);
-    delete job;
-    return procIt->GetId();
+    std::unique_lock shardLock(shard->m_section);
+
+    auto it = std::ranges::find_if(shard->m_jobQueue[priority], [job](const CWorkItem& wi)
+                                   { return wi.GetJob()->Equals(job); });
+    if (it != shard->m_jobQueue[priority].end())
+    {
+      it->AddCallback(callback);
+      delete job;
+      return it->GetId();
+    }
+
+    auto procIt = std::ranges::find_if(shard->m_processing, [job](const CWorkItem& wi)
+                                       { return wi.GetJob()->Equals(job); });
+    if (procIt != shard->m_processing.end())
+    {
+      procIt->AddCallback(callback);
+      delete job;
+      return procIt->GetId();
+    }
   }
 
   // increment the job counter, ensuring 0 (invalid job) is never hit
@@ -177,37 +211,51 @@ unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORI
   if (m_jobCounter == 0)
     m_jobCounter++;
 
-  // create a work item for this job
-  CWorkItem work(job, m_jobCounter, priority, callback);
-  m_jobQueue[priority].emplace_back(work);
+  // create a work item for this job and queue it on our home shard
+  const unsigned int id{m_jobCounter};
+  CShard& shard{*m_shards[GetHomeShard()]};
+  {
+    std::unique_lock shardLock(shard.m_section);
+    shard.m_jobQueue[priority].emplace_back(job, id, priority, callback);
+    ++m_queued[priority];
+  }
 
   StartWorkers(priority);
-  return work.GetId();
+  return id;
 }
 
 void CJobManager::CancelJob(unsigned int jobID)
 {
-  std::unique_lock lock(m_section);
-
-  // check whether we have this job in the queue
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
-       ++priority)
+  for (const auto& shard : m_shards)
   {
-    const auto i = std::ranges::find_if(m_jobQueue[priority],
-                                        [jobID](const auto& wi) { return wi.GetId() == jobID; });
-    if (i != m_jobQueue[priority].cend())
+    std::unique_lock lock(shard->m_section);
+
+    // check whether we have this job in the queue
+    for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE;
+         priority <= CJob::PRIORITY_DEDICATED; ++priority)
     {
-      CWorkItem item(std::move(*i));
-      m_jobQueue[priority].erase(i);
-      item.FreeJob();
+      JobQueue& queue{shard->m_jobQueue[priority]};
+      const auto i =
+          std::ranges::find_if(queue, [jobID](const auto& wi) { return wi.GetId() == jobID; });
+      if (i != queue.cend())
+      {
+        CWorkItem item(std::move(*i));
+        queue.erase(i);
+        --m_queued[priority];
+        lock.unlock();
+        item.FreeJob();
+        return;
+      }
+    }
+    // or if we're processing it
+    const auto it = std::ranges::find_if(shard->m_processing,
+                                         [jobID](const auto& wi) { return wi.GetId() == jobID; });
+    if (it != shard->m_processing.cend())
+    {
+      it->Cancel(); // job is in progress, so only thing to do is to remove all callbacks
       return;
     }
   }
-  // or if we're processing it
-  const auto it =
-      std::ranges::find_if(m_processing, [jobID](const auto& wi) { return wi.GetId() == jobID; });
-  if (it != m_processing.cend())
-    it->Cancel(); // job is in progress, so only thing to do is to remove all callbacks
 }
 
 void CJobManager::StartWorkers(CJob::PRIORITY priority)
@@ -215,84 +263,138 @@ void CJobManager::StartWorkers(CJob::PRIORITY priority)
   std::unique_lock lock(m_section);
 
   // check how many free threads we have
-  if (m_processing.size() >= GetMaxWorkers(priority))
+  const size_t processing{m_processingCount};
+  if (processing >= GetMaxWorkers(priority))
     return;
 
   // do we have any sleeping threads?
-  if (m_processing.size() < m_workers.size())
+  if (processing < m_workers.size())
   {
     m_jobEvent.Set();
     return;
   }
 
   // everyone is busy - we need more workers
-  m_workers.emplace_back(new CJobWorker(*this));
+  m_workers.emplace_back(new CJobWorker(*this, m_workers.size() % m_shards.size()));
+}
+
+size_t CJobManager::GetHomeShard()
+{
+  if (t_manager == this)
+    return t_homeShard % m_shards.size();
+
+  // not one of our workers - spread submissions over the shards
+  return m_nextShard.fetch_add(1, std::memory_order_relaxed) % m_shards.size();
+}
+
+bool CJobManager::ReserveWorker(CJob::PRIORITY priority)
+{
+  const size_t maxWorkers{GetMaxWorkers(priority)};
+  size_t processing{m_processingCount};
+  do
+  {
+    if (processing >= maxWorkers)
+      return false;
+  } while (!m_processingCount.compare_exchange_weak(processing, processing + 1));
+  return true;
 }
 
 CJob* CJobManager::PopJob()
 {
-  std::unique_lock lock(m_section);
+  const size_t homeShard{GetHomeShard()};
   for (int priority = CJob::PRIORITY_DEDICATED; priority >= CJob::PRIORITY_LOW_PAUSABLE; --priority)
   {
     // Check whether we're pausing pausable jobs
     if (priority == CJob::PRIORITY_LOW_PAUSABLE && m_pauseJobs)
       continue;
 
-    if (!m_jobQueue[priority].empty() &&
-        m_processing.size() < GetMaxWorkers(CJob::PRIORITY(priority)))
-    {
-      // pop the job off the queue
-      const CWorkItem job{m_jobQueue[priority].front()};
-      m_jobQueue[priority].pop_front();
-
-      // add to the processing vector
-      m_processing.emplace_back(job);
-      job.GetJob()->SetProgressCallback(this);
-      return job.GetJob();
-    }
+    if (m_queued[priority] == 0 || !ReserveWorker(CJob::PRIORITY(priority)))
+      continue;
+
+    CJob* job{PopJob(CJob::PRIORITY(priority), homeShard)};
+    if (job)
+      return job;
+
+    // somebody else was faster, give the slot back
+    --m_processingCount;
+  }
+  return nullptr;
+}
+
+CJob* CJobManager::PopJob(CJob::PRIORITY priority, size_t homeShard)
+{
+  // start with our home shard, then try to steal from the others
+  const size_t count{m_shards.size()};
+  for (size_t i = 0; i < count; ++i)
+  {
+    const size_t index{(homeShard + i) % count};
+    CShard& shard{*m_shards[index]};
+    std::unique_lock lock(shard.m_section);
+
+    JobQueue& queue{shard.m_jobQueue[priority]};
+    if (queue.empty())
+      continue;
+
+    // pop the job off the queue
+    CWorkItem item{std::move(queue.front())};
+    queue.pop_front();
+    --m_queued[priority];
+
+    // add to the processing vector of the same shard
+    CJob* job{item.GetJob()};
+    job->SetProgressCallback(this);
+    shard.m_processing.emplace_back(std::move(item));
+    t_currentShard = index;
+    return job;
   }
   return nullptr;
 }
 
 void CJobManager::PauseJobs()
 {
-  std::unique_lock lock(m_section);
   m_pauseJobs = true;
 }
 
 void CJobManager::UnPauseJobs()
 {
-  std::unique_lock lock(m_section);
   m_pauseJobs = false;
 }
 
 bool CJobManager::IsProcessing(const CJob::PRIORITY& priority) const
 {
-  std::unique_lock lock(m_section);
-
   if (m_pauseJobs && priority == CJob::PRIORITY::PRIORITY_LOW_PAUSABLE)
     return false;
 
-  return std::ranges::any_of(m_processing,
-                             [priority](const auto& wi) { return wi.GetPriority() == priority; });
+  return std::ranges::any_of(m_shards,
+                             [priority](const auto& shard)
+                             {
+                               std::unique_lock lock(shard->m_section);
+                               return std::ranges::any_of(shard->m_processing,
+                                                          [priority](const auto& wi)
+                                                          { return wi.GetPriority() == priority; });
+                             });
 }
 
 int CJobManager::IsProcessing(const std::string& type) const
 {
-  std::unique_lock lock(m_section);
-
-  return static_cast<int>(std::ranges::count_if(
-      m_processing,
-      [this, &type](const auto& wi)
-      {
-        return (!m_pauseJobs || wi.GetPriority() != CJob::PRIORITY::PRIORITY_LOW_PAUSABLE) &&
-               (std::string(wi.GetJob()->GetType()) == type);
-      }));
+  const bool pauseJobs{m_pauseJobs};
+  int count{0};
+  for (const auto& shard : m_shards)
+  {
+    std::unique_lock lock(shard->m_section);
+    count += static_cast<int>(std::ranges::count_if(
+        shard->m_processing,
+        [pauseJobs, &type](const auto& wi)
+        {
+          return (!pauseJobs || wi.GetPriority() != CJob::PRIORITY::PRIORITY_LOW_PAUSABLE) &&
+                 (std::string(wi.GetJob()->GetType()) == type);
+        }));
+  }
+  return count;
 }
 
 CJob* CJobManager::GetNextJob()
 {
-  std::unique_lock lock(m_section);
   while (m_running)
   {
     // grab a job off the queue if we have one
@@ -300,25 +402,49 @@ CJob* CJobManager::GetNextJob()
     if (job)
       return job;
     // no jobs are left - sleep for 30 seconds to allow new jobs to come in
-    lock.unlock();
-    bool newJob = m_jobEvent.Wait(30000ms);
-    lock.lock();
-    if (!newJob)
+    if (!m_jobEvent.Wait(30000ms))
       break;
   }
   // ensure no jobs have come in during the period after
   // timeout and before we held the lock
+  std::unique_lock lock(m_section);
   return PopJob();
 }
 
+CJobManager::CShard* CJobManager::FindProcessingShard(const CJob* job,
+                                                      std::unique_lock<CCriticalSection>& lock) const
+{
+  const auto isProcessing = [job](const CShard& shard)
+  { return std::ranges::any_of(shard.m_processing, JobFinder(job)); };
+
+  // progress and completion are usually reported from the worker processing the job
+  if (t_manager == this)
+  {
+    CShard& shard{*m_shards[t_currentShard]};
+    lock = std::unique_lock(shard.m_section);
+    if (isProcessing(shard))
+      return &shard;
+    lock.unlock();
+  }
+
+  for (const auto& shard : m_shards)
+  {
+    lock = std::unique_lock(shard->m_section);
+    if (isProcessing(*shard))
+      return shard.get();
+    lock.unlock();
+  }
+  return nullptr;
+}
+
 bool CJobManager::OnJobProgress(unsigned int progress, unsigned int total, const CJob* job) const
 {
-  std::unique_lock lock(m_section);
   // find the job in the processing queue, and check whether it's cancelled (no callbacks)
-  const auto i = std::ranges::find_if(m_processing, JobFinder(job));
-  if (i != m_processing.cend())
+  std::unique_lock<CCriticalSection> lock;
+  const CShard* shard{FindProcessingShard(job, lock)};
+  if (shard)
   {
-    CWorkItem item(*i);
+    CWorkItem item(*std::ranges::find_if(shard->m_processing, JobFinder(job)));
     lock.unlock(); // leave section prior to call
     if (!item.GetCallbacks().empty())
     {
@@ -334,15 +460,17 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
 {
   std::optional<CWorkItem> item = [&, this]
   {
-    std::unique_lock lock(m_section);
+    std::unique_lock<CCriticalSection> lock;
     std::optional<CWorkItem> item;
-    auto i = std::ranges::find_if(m_processing, JobFinder(job));
-    if (i != m_processing.end())
+    CShard* shard{FindProcessingShard(job, lock)};
+    if (shard)
     {
-      // Move work item out of m_processing to avoid iterator invalidation
-      // when another thread modifies m_processing during callback execution
+      // Move work item out of the processing list to avoid iterator invalidation
+      // when another thread modifies it during callback execution
+      auto i = std::ranges::find_if(shard->m_processing, JobFinder(job));
       item.emplace(std::move(*i));
-      m_processing.erase(i);
+      shard->m_processing.erase(i);
+      --m_processingCount;
     }
     return item;
   }();
@@ -355,7 +483,7 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
       // controlling the creation and deletion.
       auto& counter = [&, this]() -> std::atomic<size_t>&
       {
-        std::unique_lock lock(m_section);
+        std::unique_lock lock(m_callbackSection);
 
         assert(!m_pendingCallbacks.contains(job));
 
@@ -379,7 +507,7 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
       }
 
       {
-        std::unique_lock lock(m_section);
+        std::unique_lock lock(m_callbackSection);
         m_pendingCallbacks.erase(job);
       }
     }
@@ -390,7 +518,7 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
 
 size_t CJobManager::GetPendingCallbackCount(const CJob* job) const
 {
-  std::unique_lock lock(m_section);
+  std::unique_lock lock(m_callbackSection);
   auto it = m_pendingCallbacks.find(job);
   return it != m_pendingCallbacks.end() ? static_cast<size_t>(it->second) : 0;
 }
@@ -406,7 +534,8 @@ void CJobManager::RemoveWorker(const CJobWorker* worker)
 
 unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority)
 {
-  static const unsigned int max_workers = 5;
+  // scale with the available cores, but never go below the historical limit
+  static const unsigned int max_workers = std::clamp(std::thread::hardware_concurrency(), 5U, 32U);
   if (priority == CJob::PRIORITY_DEDICATED)
     return 10000; // A large number..
   return max_workers - (CJob::PRIORITY_HIGH - priority);
@@ -16,6 +16,9 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <string>
 #include <unordered_map>
@@ -32,12 +35,18 @@ class IJobCallback;
  on priority levels.  Lower priority jobs are executed only if there are sufficient
  spare worker threads free to allow for higher priority jobs that may arise.
 
+ Queued jobs are spread over a number of shards, each with its own lock. Every worker
+ thread has a home shard it pushes to and pops from first, and steals from the other
+ shards when its own is empty. Stealing is priority-aware: a worker always looks for
+ the highest priority job available in any shard before considering lower priorities,
+ so the global priority ordering of the previous single queue design is retained.
+
  \sa CJob and IJobCallback
  */
 class CJobManager final
 {
 public:
-  CJobManager() = default;
+  CJobManager();
 
   /*!
    \brief Returns whether the job manager is currently running.
@@ -221,30 +230,65 @@ private:
     CJob::PRIORITY m_priority{CJob::PRIORITY::PRIORITY_LOW};
   };
 
+  using JobQueue = std::deque<CWorkItem>;
+  using Processing = std::vector<CWorkItem>;
+  using Workers = std::vector<CJobWorker*>;
+
+  /*!
+   \brief A shard of the job queue.
+   Jobs never move between shards: a job popped for processing stays in the processing list of
+   the shard it was queued in until it completes, which keeps duplicate detection consistent
+   without a global lock.
+   */
+  struct CShard
+  {
+    mutable CCriticalSection m_section;
+    std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
+    Processing m_processing;
+  };
+
   /*! \brief Pop a job off the job queue and add to the processing queue ready to process
    \return the job to process, nullptr if no jobs are available
    */
   CJob* PopJob();
 
+  /*! \brief Pop a job of the given priority, looking at the home shard first and stealing from
+   the others otherwise.
+   \return the job to process, nullptr if no job of this priority is queued
+   */
+  CJob* PopJob(CJob::PRIORITY priority, size_t homeShard);
+
+  /*! \brief Reserve a processing slot for a job of the given priority.
+   \return false if the worker limit for this priority has already been reached
+   */
+  bool ReserveWorker(CJob::PRIORITY priority);
+
+  size_t GetHomeShard();
+  /*! \brief Find the shard whose processing list contains the given job.
+   \param lock on return, holds the lock of the returned shard
+   \return the shard, nullptr if the job is not processing
+   */
+  CShard* FindProcessingShard(const CJob* job, std::unique_lock<CCriticalSection>& lock) const;
+
   void StartWorkers(CJob::PRIORITY priority);
   void RemoveWorker(const CJobWorker* worker);
   static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
 
   unsigned int m_jobCounter{0};
 
-  using JobQueue = std::deque<CWorkItem>;
-  using Processing = std::vector<CWorkItem>;
-  using Workers = std::vector<CJobWorker*>;
-
-  std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
-  bool m_pauseJobs{false};
-  Processing m_processing;
+  std::vector<std::unique_ptr<CShard>> m_shards;
+  std::atomic<size_t> m_nextShard{0};
+  std::array<std::atomic<size_t>, CJob::PRIORITY_DEDICATED + 1> m_queued{};
+  std::atomic<size_t> m_processingCount{0};
+  std::atomic<bool> m_pauseJobs{false};
   Workers m_workers;
 
+  // Serializes job submission (duplicate detection) and the worker list, not job retrieval
   mutable CCriticalSection m_section;
   CEvent m_jobEvent;
-  bool m_running{true};
+  std::atomic<bool> m_running{true};
 
   // Tracks pending callback count for jobs in completion phase, used by CJob::IsShared()
+  mutable CCriticalSection m_callbackSection;
   std::unordered_map<const CJob*, std::atomic<size_t>> m_pendingCallbacks;
 };
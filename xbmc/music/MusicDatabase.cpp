@@ -1747,16 +1747,14 @@ int CMusicDatabase::AddGenre(std::string& strGenre)
       return it->second;
 
 
-    strSQL = PrepareSQL("SELECT idGenre, strGenre FROM genre WHERE strGenre LIKE '%s'",
-                        strGenre.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "SELECT idGenre, strGenre FROM genre WHERE strGenre LIKE ?";
+    m_pDS->query(strSQL, dbiplus::make_params(strGenre));
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL = PrepareSQL("INSERT INTO genre (idGenre, strGenre) values( NULL, '%s' )",
-                          strGenre.c_str());
-      m_pDS->exec(strSQL);
+      strSQL = "INSERT INTO genre (idGenre, strGenre) values( NULL, ? )";
+      m_pDS->exec(strSQL, dbiplus::make_params(strGenre));
 
       const auto idGenre = static_cast<int>(m_pDS->lastinsertid());
       m_genreCache.try_emplace(strGenre, idGenre);
@@ -2496,16 +2494,16 @@ int CMusicDatabase::AddRole(std::string_view strRole)
       return -1;
     if (nullptr == m_pDS)
       return -1;
-    strSQL = PrepareSQL("SELECT idRole FROM role WHERE strRole LIKE '%s'", strRole.data());
-    m_pDS->query(strSQL);
+    strSQL = "SELECT idRole FROM role WHERE strRole LIKE ?";
+    m_pDS->query(strSQL, dbiplus::make_params(strRole));
     if (m_pDS->num_rows() > 0)
       idRole = m_pDS->fv("idRole").get_asInt();
     m_pDS->close();
 
     if (idRole < 0)
     {
-      strSQL = PrepareSQL("INSERT INTO role (strRole) VALUES ('%s')", strRole.data());
-      m_pDS->exec(strSQL);
+      strSQL = "INSERT INTO role (strRole) VALUES (?)";
+      m_pDS->exec(strSQL, dbiplus::make_params(strRole));
       idRole = static_cast<int>(m_pDS->lastinsertid());
       m_pDS->close();
     }
@@ -2527,11 +2525,9 @@ bool CMusicDatabase::AddSongArtist(
 bool CMusicDatabase::AddSongArtist(
     int idArtist, int idSong, int idRole, std::string_view strArtist, int iOrder)
 {
-  std::string strSQL;
-  strSQL = PrepareSQL("REPLACE INTO song_artist (idArtist, idSong, idRole, strArtist, iOrder) "
-                      "VALUES(%i, %i, %i,'%s', %i)",
-                      idArtist, idSong, idRole, strArtist.data(), iOrder);
-  return ExecuteQuery(strSQL);
+  return ExecuteQuery("REPLACE INTO song_artist (idArtist, idSong, idRole, strArtist, iOrder) "
+                      "VALUES(?, ?, ?, ?, ?)",
+                      dbiplus::make_params(idArtist, idSong, idRole, strArtist, iOrder));
 }
 
 int CMusicDatabase::AddSongContributor(int idSong,
@@ -2681,11 +2677,9 @@ bool CMusicDatabase::AddAlbumArtist(int idArtist,
                                     std::string_view strArtist,
                                     int iOrder)
 {
-  std::string strSQL;
-  strSQL = PrepareSQL("REPLACE INTO album_artist (idArtist, idAlbum, strArtist, iOrder) "
-                      "VALUES(%i,%i,'%s',%i)",
-                      idArtist, idAlbum, strArtist.data(), iOrder);
-  return ExecuteQuery(strSQL);
+  return ExecuteQuery("REPLACE INTO album_artist (idArtist, idAlbum, strArtist, iOrder) "
+                      "VALUES(?, ?, ?, ?)",
+                      dbiplus::make_params(idArtist, idAlbum, strArtist, iOrder));
 }
 
 bool CMusicDatabase::DeleteAlbumArtistsByAlbum(int idAlbum)
@@ -2710,9 +2704,8 @@ bool CMusicDatabase::AddSongGenres(int idSong, const std::vector<std::string>& g
     for (auto& strGenre : modgenres)
     {
       int idGenre = AddGenre(strGenre); // Genre string trimmed and matched case-insensitively
-      strSQL = PrepareSQL("INSERT INTO song_genre (idGenre, idSong, iOrder) VALUES(%i,%i,%i)",
-                          idGenre, idSong, index++);
-      if (!ExecuteQuery(strSQL))
+      strSQL = "INSERT INTO song_genre (idGenre, idSong, iOrder) VALUES(?, ?, ?)";
+      if (!ExecuteQuery(strSQL, dbiplus::make_params(idGenre, idSong, index++)))
         return false;
     }
     // Update concatenated genre string from the standardised genre values
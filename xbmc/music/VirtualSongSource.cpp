@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VirtualSongSource.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "music/MusicThumbLoader.h"
+#include "utils/ArtUtils.h"
+#include "utils/log.h"
+
+CVirtualSongSource::CVirtualSongSource(const std::string& baseDir,
+                                       const SortDescription& sorting,
+                                       const std::string& labelMask,
+                                       const std::string& label2Mask)
+  : m_baseDir(baseDir),
+    m_sorting(sorting),
+    m_formatter(labelMask, label2Mask)
+{
+}
+
+CVirtualSongSource::~CVirtualSongSource()
+{
+  if (m_thumbLoader)
+    m_thumbLoader->OnLoaderFinish();
+  m_database.Close();
+}
+
+bool CVirtualSongSource::GetRows(int start,
+                                 int count,
+                                 std::vector<std::shared_ptr<CFileItem>>& rows,
+                                 int& total)
+{
+  if (!m_database.IsOpen() && !m_database.Open())
+    return false;
+
+  SortDescription sorting = m_sorting;
+  sorting.limitStart = start;
+  sorting.limitEnd = start + count;
+
+  CFileItemList items;
+  if (!m_database.GetSongsFullByWhere(m_baseDir, items, sorting, CDatabase::Filter(), true))
+  {
+    CLog::LogF(LOGERROR, "failed to get songs {} to {} of {}", start, start + count, m_baseDir);
+    return false;
+  }
+
+  total = static_cast<int>(items.GetProperty("total").asInteger());
+  rows.reserve(items.Size());
+  for (const auto& item : items)
+  {
+    m_formatter.FormatLabels(item.get());
+    KODI::ART::FillInDefaultIcon(*item);
+    rows.push_back(item);
+  }
+  return true;
+}
+
+void CVirtualSongSource::FillDetails(CFileItem& item)
+{
+  if (!m_thumbLoader)
+  {
+    m_thumbLoader = std::make_unique<CMusicThumbLoader>();
+    m_thumbLoader->OnLoaderStart();
+  }
+  m_thumbLoader->LoadItem(&item);
+}
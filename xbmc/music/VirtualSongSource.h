@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "guilib/VirtualItemList.h"
+#include "music/MusicDatabase.h"
+#include "utils/LabelFormatter.h"
+#include "utils/SortUtils.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class CMusicThumbLoader;
+
+/*!
+ \ingroup music
+ \brief Pages songs of the music library in from the database, for a CVirtualItemList.
+
+ The songs are sorted and limited in SQL, so a page costs one query whatever the size of the
+ library, and their art is only looked up once they are about to be shown.
+ */
+class CVirtualSongSource : public IVirtualItemSource
+{
+public:
+  /*! \brief Create a source of the songs in a musicdb:// path.
+   \param baseDir the path, which may carry filter options.
+   \param sorting how the database sorts the songs.
+   \param labelMask the mask formatting the label of the songs, see CLabelFormatter.
+   \param label2Mask the mask formatting their second label.
+   */
+  CVirtualSongSource(const std::string& baseDir,
+                     const SortDescription& sorting,
+                     const std::string& labelMask,
+                     const std::string& label2Mask);
+  ~CVirtualSongSource() override;
+
+  bool GetRows(int start,
+               int count,
+               std::vector<std::shared_ptr<CFileItem>>& rows,
+               int& total) override;
+  void FillDetails(CFileItem& item) override;
+  SortDescription GetSortDescription() const override { return m_sorting; }
+
+private:
+  const std::string m_baseDir;
+  const SortDescription m_sorting;
+  const CLabelFormatter m_formatter;
+  CMusicDatabase m_database;
+  std::unique_ptr<CMusicThumbLoader> m_thumbLoader;
+};
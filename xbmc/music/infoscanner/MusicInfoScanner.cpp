@@ -14,6 +14,7 @@
 #include "GUIUserMessages.h"
 #include "MusicAlbumInfo.h"
 #include "MusicInfoScraper.h"
+#include "MusicTagReader.h"
 #include "NfoFile.h"
 #include "ServiceBroker.h"
 #include "TextureCache.h"
@@ -44,7 +45,6 @@
 #include "music/MusicThumbLoader.h"
 #include "music/MusicUtils.h"
 #include "music/tags/MusicInfoTag.h"
-#include "music/tags/MusicInfoTagLoaderFactory.h"
 #include "playlists/PlayListFileItemClassify.h"
 #include "resources/LocalizeStrings.h"
 #include "resources/ResourcesComponent.h"
@@ -282,6 +282,7 @@ void CMusicInfoScanner::Process()
     CLog::Log(LOGERROR, "MusicInfoScanner: Exception while scanning.");
   }
   m_musicDatabase.Close();
+  m_tagReader.reset();
   CLog::Log(LOGDEBUG, "{} - Finished scan", __FUNCTION__);
 
   m_bRunning = false;
@@ -587,11 +588,10 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
   std::vector<std::string> regexps =
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
 
+  // the files to read tags from
+  std::vector<CFileItemPtr> files;
   for (int i = 0; i < items.Size(); ++i)
   {
-    if (m_bStop)
-      return InfoRet::CANCELLED;
-
     CFileItemPtr pItem = items[i];
 
     if (CUtil::ExcludeFileOrFolder(pItem->GetPath(), regexps, &m_regexpCache))
@@ -601,25 +601,36 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
         MUSIC::IsLyrics(*pItem))
       continue;
 
-    m_currentItem++;
-
-    CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
-    // Forced rescan must re-read tags from disk even if the item arrives with
-    // tag.Loaded() already true (e.g. DB-enriched directory listings). The
-    // folder-level SCAN_RESCAN check above (line 521) bypasses the path-hash
-    // skip, but without this check ScanTags would still reuse cached tag
-    // state on a per-file basis, defeating "Do full tag scan even when
-    // unchanged".
-    if (!tag.Loaded() || (m_flags & SCAN_RESCAN))
-    {
-      std::unique_ptr<IMusicInfoTagLoader> pLoader (CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
-      if (nullptr != pLoader)
-        pLoader->Load(pItem->GetPath(), tag);
-    }
-
-    if (m_handle && m_itemCount>0)
-      m_handle->SetPercentage(static_cast<float>(m_currentItem * 100) / static_cast<float>(m_itemCount));
+    files.emplace_back(pItem);
+  }
 
+  if (!m_tagReader)
+  {
+    const int readers =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_musicLibraryTagReaders;
+    m_tagReader = std::make_unique<CMusicTagReader>(
+        readers > 0 ? readers : CMusicTagReader::GetDefaultWorkerCount());
+  }
+
+  // Forced rescan must re-read tags from disk even if the item arrives with
+  // tag.Loaded() already true (e.g. DB-enriched directory listings). The
+  // folder-level SCAN_RESCAN check in DoScan bypasses the path-hash skip, but
+  // without this ScanTags would still reuse cached tag state on a per-file
+  // basis, defeating "Do full tag scan even when unchanged".
+  // The tags are read in parallel, this thread stays the only one writing to the database.
+  const auto progress = [this]()
+  {
+    m_currentItem++;
+    if (m_handle && m_itemCount > 0)
+      m_handle->SetPercentage(static_cast<float>(m_currentItem * 100) /
+                              static_cast<float>(m_itemCount));
+  };
+  if (!m_tagReader->ReadTags(files, (m_flags & SCAN_RESCAN) != 0, m_bStop, progress))
+    return InfoRet::CANCELLED;
+
+  for (const CFileItemPtr& pItem : files)
+  {
+    const CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
     if (!tag.Loaded() && !pItem->HasCueDocument())
     {
       CLog::Log(LOGDEBUG, "{} - No tag found for: {}", __FUNCTION__, pItem->GetPath());
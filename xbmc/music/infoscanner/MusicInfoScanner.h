@@ -15,6 +15,7 @@
 #include "utils/RegExp.h"
 
 #include <atomic>
+#include <memory>
 #include <string>
 
 class CAlbum;
@@ -30,6 +31,7 @@ class CMusicAlbumInfo;
 
 namespace MUSIC_INFO
 {
+class CMusicTagReader;
 
 class CMusicInfoScanner : public IRunnable, public CInfoScanner
 {
@@ -292,5 +294,6 @@ protected:
   int m_flags;
   CThread m_fileCountReader;
   mutable KODI::REGEXP::RegExpCache m_regexpCache;
+  std::unique_ptr<CMusicTagReader> m_tagReader; //!< Reads the tags while scanning files
 };
 }
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MusicTagReader.h"
+
+#include "FileItem.h"
+#include "music/tags/MusicInfoTag.h"
+#include "music/tags/MusicInfoTagLoaderFactory.h"
+#include "threads/Thread.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+using namespace MUSIC_INFO;
+
+class CMusicTagReader::CWorker : public CThread
+{
+public:
+  explicit CWorker(CMusicTagReader& reader) : CThread("MusicTagReader"), m_reader(reader) {}
+
+protected:
+  void Process() override { m_reader.Process(); }
+
+private:
+  CMusicTagReader& m_reader;
+};
+
+CMusicTagReader::CMusicTagReader(unsigned int workers)
+{
+  if (workers <= 1)
+    return;
+
+  m_workers.reserve(workers);
+  for (unsigned int i = 0; i < workers; ++i)
+  {
+    m_workers.emplace_back(std::make_unique<CWorker>(*this));
+    m_workers.back()->Create();
+  }
+}
+
+CMusicTagReader::~CMusicTagReader()
+{
+  {
+    std::unique_lock lock(m_section);
+    m_quit = true;
+  }
+  m_workAvailable.notifyAll();
+
+  for (const auto& worker : m_workers)
+    worker->StopThread();
+}
+
+unsigned int CMusicTagReader::GetDefaultWorkerCount()
+{
+  return std::clamp(std::thread::hardware_concurrency(), 1U, 8U);
+}
+
+void CMusicTagReader::ReadTag(CFileItem& item, bool reload)
+{
+  CMusicInfoTag& tag = *item.GetMusicInfoTag();
+  if (tag.Loaded() && !reload)
+    return;
+
+  std::unique_ptr<IMusicInfoTagLoader> loader(CMusicInfoTagLoaderFactory::CreateLoader(item));
+  if (loader)
+    loader->Load(item.GetPath(), tag);
+}
+
+bool CMusicTagReader::ReadTags(const std::vector<std::shared_ptr<CFileItem>>& items,
+                               bool reload,
+                               const std::atomic<bool>& stop,
+                               const std::function<void()>& progress)
+{
+  if (m_workers.empty())
+  {
+    for (const auto& item : items)
+    {
+      if (stop)
+        return false;
+      ReadTag(*item, reload);
+      progress();
+    }
+    return !stop;
+  }
+
+  std::unique_lock lock(m_section);
+  m_items = &items;
+  m_stop = &stop;
+  m_reload = reload;
+  m_next = 0;
+  m_done = 0;
+  m_workAvailable.notifyAll();
+
+  size_t reported = 0;
+  while (reported < items.size())
+  {
+    m_workDone.wait(lock, [&] { return m_done > reported; });
+    const size_t done = m_done;
+
+    // report without holding the lock, the workers carry on meanwhile
+    lock.unlock();
+    for (; reported < done; ++reported)
+      progress();
+    lock.lock();
+  }
+  m_items = nullptr;
+  m_stop = nullptr;
+
+  return !stop;
+}
+
+void CMusicTagReader::Process()
+{
+  std::unique_lock lock(m_section);
+  while (true)
+  {
+    m_workAvailable.wait(lock, [this] { return m_quit || (m_items && m_next < m_items->size()); });
+    if (m_quit)
+      return;
+
+    const std::shared_ptr<CFileItem> item = (*m_items)[m_next++];
+    const bool skip = *m_stop;
+    const bool reload = m_reload;
+
+    lock.unlock();
+    if (!skip)
+      ReadTag(*item, reload);
+    lock.lock();
+
+    m_done++;
+    m_workDone.notifyAll();
+  }
+}
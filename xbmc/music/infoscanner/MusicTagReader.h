@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class CFileItem;
+
+namespace MUSIC_INFO
+{
+
+/*!
+ * \brief Reads the tags of music files on a set of worker threads.
+ *
+ * Tag parsing is CPU bound and independent per file, so the scanner hands over the files of a
+ * directory and gets them back with their tags loaded, while it remains the only thread writing to
+ * the database. Progress is reported on the calling thread as files complete.
+ */
+class CMusicTagReader
+{
+public:
+  /*!
+   * \param workers number of worker threads, with one or less the tags are read on the calling
+   * thread
+   */
+  explicit CMusicTagReader(unsigned int workers);
+  virtual ~CMusicTagReader();
+
+  CMusicTagReader(const CMusicTagReader&) = delete;
+  CMusicTagReader& operator=(const CMusicTagReader&) = delete;
+
+  /*!
+   * \brief Load the tags of the given files.
+   * \param items the files
+   * \param reload whether to read tags that are already loaded again
+   * \param stop set to abort, files not read yet are skipped
+   * \param progress called on the calling thread once per file done
+   * \return false if aborted, true otherwise
+   */
+  bool ReadTags(const std::vector<std::shared_ptr<CFileItem>>& items,
+                bool reload,
+                const std::atomic<bool>& stop,
+                const std::function<void()>& progress);
+
+  unsigned int GetWorkerCount() const { return static_cast<unsigned int>(m_workers.size()); }
+
+  /*!
+   * \brief The number of workers to use when not configured: one per core, up to 8.
+   */
+  static unsigned int GetDefaultWorkerCount();
+
+protected:
+  virtual void ReadTag(CFileItem& item, bool reload);
+
+private:
+  class CWorker;
+
+  void Process();
+
+  std::vector<std::unique_ptr<CWorker>> m_workers;
+
+  CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_workAvailable;
+  XbmcThreads::ConditionVariable m_workDone;
+  const std::vector<std::shared_ptr<CFileItem>>* m_items = nullptr;
+  const std::atomic<bool>* m_stop = nullptr;
+  bool m_reload = false;
+  size_t m_next = 0;
+  size_t m_done = 0;
+  bool m_quit = false;
+};
+
+} // namespace MUSIC_INFO
@@ -0,0 +1,227 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "music/infoscanner/MusicTagReader.h"
+#include "music/tags/MusicInfoTag.h"
+#include "music/tags/TagLoaderTagLib.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <taglib/attachedpictureframe.h>
+#include <taglib/id3v2tag.h>
+#include <taglib/wavfile.h>
+
+using namespace MUSIC_INFO;
+using namespace std::chrono_literals;
+
+namespace
+{
+/*!
+ * \brief Reader that doesn't touch any file, it names the tag after the path.
+ */
+class CFakeTagReader : public CMusicTagReader
+{
+public:
+  explicit CFakeTagReader(unsigned int workers) : CMusicTagReader(workers) {}
+
+protected:
+  void ReadTag(CFileItem& item, bool reload) override
+  {
+    CMusicInfoTag& tag = *item.GetMusicInfoTag();
+    if (tag.Loaded() && !reload)
+      return;
+
+    std::this_thread::sleep_for(1ms);
+    tag.SetTitle(item.GetPath());
+    tag.SetLoaded(true);
+  }
+};
+
+/*!
+ * \brief Reader using the TagLib loader directly, the factory needs the add-on system.
+ */
+class CTagLibReader : public CMusicTagReader
+{
+public:
+  explicit CTagLibReader(unsigned int workers) : CMusicTagReader(workers) {}
+
+protected:
+  void ReadTag(CFileItem& item, bool reload) override
+  {
+    CTagLoaderTagLib loader;
+    loader.Load(item.GetPath(), *item.GetMusicInfoTag());
+  }
+};
+
+std::vector<std::shared_ptr<CFileItem>> CreateItems(size_t count)
+{
+  std::vector<std::shared_ptr<CFileItem>> items;
+  for (size_t i = 0; i < count; ++i)
+    items.emplace_back(
+        std::make_shared<CFileItem>(StringUtils::Format("/music/track{:03}.flac", i), false));
+  return items;
+}
+
+void Append32(std::vector<char>& data, uint32_t value)
+{
+  for (int i = 0; i < 4; ++i)
+    data.push_back(static_cast<char>(value >> (8 * i)));
+}
+
+/*!
+ * \brief Write a second of silence as 16 bit stereo PCM, tagged like a ripped CD with cover art.
+ */
+bool CreateTrack(const std::string& path, int track)
+{
+  std::vector<char> data;
+  const uint32_t pcmSize = 44100 * 4;
+  data.insert(data.end(), {'R', 'I', 'F', 'F'});
+  Append32(data, 4 + 8 + 16 + 8 + pcmSize);
+  data.insert(data.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+  Append32(data, 16);
+  data.insert(data.end(), {1, 0, 2, 0}); // PCM, stereo
+  Append32(data, 44100);
+  Append32(data, 44100 * 4);
+  data.insert(data.end(), {4, 0, 16, 0});
+  data.insert(data.end(), {'d', 'a', 't', 'a'});
+  Append32(data, pcmSize);
+  data.resize(data.size() + pcmSize);
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+    return false;
+  file.Close();
+
+  TagLib::RIFF::WAV::File wav(CSpecialProtocol::TranslatePath(path).c_str());
+  TagLib::ID3v2::Tag* tag = wav.ID3v2Tag();
+  tag->setTitle(StringUtils::Format("Track {}", track));
+  tag->setArtist("Artist");
+  tag->setAlbum("Album");
+  tag->setTrack(track);
+  auto* picture = new TagLib::ID3v2::AttachedPictureFrame;
+  picture->setType(TagLib::ID3v2::AttachedPictureFrame::FrontCover);
+  picture->setMimeType("image/jpeg");
+  picture->setPicture(TagLib::ByteVector(128 * 1024, 'x'));
+  tag->addFrame(picture);
+  return wav.save();
+}
+} // namespace
+
+TEST(TestMusicTagReader, ReadsAllInOrder)
+{
+  const std::vector<std::shared_ptr<CFileItem>> items = CreateItems(100);
+  std::atomic<bool> stop{false};
+  CFakeTagReader reader(4);
+  EXPECT_EQ(4u, reader.GetWorkerCount());
+
+  const std::thread::id caller = std::this_thread::get_id();
+  size_t progress = 0;
+  EXPECT_TRUE(reader.ReadTags(items, false, stop,
+                              [&]
+                              {
+                                EXPECT_EQ(caller, std::this_thread::get_id());
+                                progress++;
+                              }));
+
+  EXPECT_EQ(items.size(), progress);
+  for (const auto& item : items)
+  {
+    EXPECT_TRUE(item->GetMusicInfoTag()->Loaded());
+    EXPECT_EQ(item->GetPath(), item->GetMusicInfoTag()->GetTitle());
+  }
+}
+
+TEST(TestMusicTagReader, Reload)
+{
+  const std::vector<std::shared_ptr<CFileItem>> items = CreateItems(2);
+  items[0]->GetMusicInfoTag()->SetTitle("from the database");
+  items[0]->GetMusicInfoTag()->SetLoaded(true);
+  std::atomic<bool> stop{false};
+  CFakeTagReader reader(2);
+
+  EXPECT_TRUE(reader.ReadTags(items, false, stop, [] {}));
+  EXPECT_EQ("from the database", items[0]->GetMusicInfoTag()->GetTitle());
+
+  EXPECT_TRUE(reader.ReadTags(items, true, stop, [] {}));
+  EXPECT_EQ(items[0]->GetPath(), items[0]->GetMusicInfoTag()->GetTitle());
+}
+
+TEST(TestMusicTagReader, Stop)
+{
+  const std::vector<std::shared_ptr<CFileItem>> items = CreateItems(100);
+  std::atomic<bool> stop{false};
+  CFakeTagReader reader(4);
+
+  size_t progress = 0;
+  EXPECT_FALSE(reader.ReadTags(items, false, stop,
+                               [&]
+                               {
+                                 if (++progress == 10)
+                                   stop = true;
+                               }));
+
+  // every file is reported, the ones after the stop without a tag
+  EXPECT_EQ(items.size(), progress);
+  EXPECT_FALSE(items.back()->GetMusicInfoTag()->Loaded());
+}
+
+TEST(TestMusicTagReader, DISABLED_Throughput)
+{
+  const std::string folder = URIUtils::AddFileToFolder(
+      CSpecialProtocol::TranslatePath("special://temp/"), "TestMusicTagReader");
+  ASSERT_TRUE(XFILE::CDirectory::Create(folder));
+
+  constexpr int tracks = 200;
+  std::vector<std::shared_ptr<CFileItem>> items;
+  for (int i = 1; i <= tracks; ++i)
+  {
+    const std::string path =
+        URIUtils::AddFileToFolder(folder, StringUtils::Format("{:03} - Track.wav", i));
+    ASSERT_TRUE(CreateTrack(path, i));
+    items.emplace_back(std::make_shared<CFileItem>(path, false));
+  }
+
+  const auto read = [&items](unsigned int workers)
+  {
+    for (const auto& item : items)
+      item->GetMusicInfoTag()->Clear();
+
+    std::atomic<bool> stop{false};
+    CTagLibReader reader(workers);
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(reader.ReadTags(items, true, stop, [] {}));
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return items.size() / elapsed.count();
+  };
+
+  const double single = read(1);
+  const double parallel = read(CMusicTagReader::GetDefaultWorkerCount());
+
+  for (int i = 0; i < tracks; ++i)
+  {
+    const CMusicInfoTag& tag = *items[i]->GetMusicInfoTag();
+    EXPECT_EQ(StringUtils::Format("Track {}", i + 1), tag.GetTitle());
+    EXPECT_EQ(i + 1, tag.GetTrackNumber());
+  }
+
+  RecordProperty("Workers", static_cast<int>(CMusicTagReader::GetDefaultWorkerCount()));
+  RecordProperty("SingleFilesPerSecond", static_cast<int>(single));
+  RecordProperty("ParallelFilesPerSecond", static_cast<int>(parallel));
+
+  EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(folder));
+}
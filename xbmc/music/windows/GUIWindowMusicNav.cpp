@@ -28,6 +28,7 @@
 #include "guilib/GUIEditControl.h"
 #include "guilib/GUIKeyboardFactory.h"
 #include "guilib/GUIWindowManager.h"
+#include "guilib/VirtualItemList.h"
 #include "input/actions/Action.h"
 #include "input/actions/ActionIDs.h"
 #include "jobs/JobManager.h"
@@ -35,6 +36,7 @@
 #include "messaging/helpers/DialogOKHelper.h"
 #include "music/MusicFileItemClassify.h"
 #include "music/MusicLibraryQueue.h"
+#include "music/VirtualSongSource.h"
 #include "music/dialogs/GUIDialogInfoProviderSettings.h"
 #include "music/tags/MusicInfoTag.h"
 #include "network/NetworkFileItemClassify.h"
@@ -388,7 +390,8 @@ bool CGUIWindowMusicNav::GetDirectory(const std::string &strDirectory, CFileItem
   if (strDirectory.empty())
     AddSearchFolder();
 
-  bool bResult = CGUIWindowMusicBase::GetDirectory(strDirectory, items);
+  bool bResult = GetVirtualSongs(strDirectory, items) ||
+                 CGUIWindowMusicBase::GetDirectory(strDirectory, items);
   if (bResult)
   {
     if (PLAYLIST::IsPlayList(items))
@@ -492,6 +495,45 @@ bool CGUIWindowMusicNav::GetDirectory(const std::string &strDirectory, CFileItem
   return bResult;
 }
 
+bool CGUIWindowMusicNav::GetVirtualSongs(const std::string& strDirectory, CFileItemList& items)
+{
+  const int threshold = CServiceBroker::GetSettingsComponent()
+                            ->GetAdvancedSettings()
+                            ->m_musicLibraryVirtualListThreshold;
+  if (threshold <= 0 || !StringUtils::StartsWithNoCase(strDirectory, "musicdb://") ||
+      CMusicDatabaseDirectory::GetDirectoryType(strDirectory) != NodeType::SONG ||
+      CMusicDatabaseDirectory::GetDirectoryParentType(strDirectory) != NodeType::OVERVIEW ||
+      m_musicdatabase.GetSongsCount() < threshold)
+    return false;
+
+  items.Clear();
+  std::string label;
+  CMusicDatabaseDirectory::GetLabel(strDirectory, label);
+  items.SetPath(strDirectory);
+  items.SetLabel(label);
+  m_guiState.reset(CGUIViewState::GetViewState(GetID(), items));
+  if (!m_guiState)
+    return false;
+
+  // the database sorts and the source formats as the view does, so the window needn't hold all of
+  // the songs to sort them
+  SortDescription sorting = m_guiState->GetSortMethod();
+  sorting.sortOrder = m_guiState->GetSortOrder();
+  if (sorting.sortBy == SortBy::NONE)
+    return false;
+
+  LABEL_MASKS labelMasks;
+  m_guiState->GetSortMethodLabelMasks(labelMasks);
+  auto virtualItems = std::make_shared<CVirtualItemList>(std::make_unique<CVirtualSongSource>(
+      strDirectory, sorting, labelMasks.m_strLabelFile, labelMasks.m_strLabel2File));
+  if (!virtualItems->Open())
+    return false;
+
+  CLog::LogF(LOGDEBUG, "paging in {} songs of {}", virtualItems->Size(), strDirectory);
+  items.SetVirtualItems(std::move(virtualItems));
+  return true;
+}
+
 void CGUIWindowMusicNav::UpdateButtons()
 {
   CGUIWindowMusicBase::UpdateButtons();
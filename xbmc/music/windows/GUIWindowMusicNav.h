@@ -39,6 +39,13 @@ protected:
   std::string GetStartFolder(const std::string &url) override;
 
   bool GetSongsFromPlayList(const std::string& strPlayList, CFileItemList &items);
+  /*! \brief Page the songs of a large library in as they are shown, rather than listing them all.
+   Only done for the songs node, from the number of songs set in advanced settings.
+   \param strDirectory the path to list.
+   \param items [out] the list, backed by a CVirtualItemList.
+   \return true if the songs are paged in, false to list the directory as usual.
+   */
+  bool GetVirtualSongs(const std::string& strDirectory, CFileItemList& items);
   bool ManageInfoProvider(const CFileItemPtr& item);
 
   std::vector<CMediaSource> m_shares;
@@ -13,12 +13,21 @@
 #include "interfaces/json-rpc/JSONRPC.h"
 #include "interfaces/json-rpc/JSONServiceDescription.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/FileUtils.h"
+#include "utils/JSONVariantStreamWriter.h"
 #include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <utility>
+
 #define MAX_HTTP_POST_SIZE 65536
+// responses up to this size are sent with their length, larger ones while they are serialized
+#define MAX_HTTP_BUFFERED_RESPONSE_SIZE 262144
+#define HTTP_RESPONSE_CHUNK_SIZE 16384
 
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
@@ -72,10 +81,53 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
 
   if (isRequest)
   {
-    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
+    CVariant response;
+    if (JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client, response))
+    {
+      m_requestData.clear();
+      m_responseWriter = std::make_unique<CJSONVariantStreamWriter>(
+          std::move(response),
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+      if (!jsonpCallback.empty())
+      {
+        m_responseData = jsonpCallback + "(";
+        m_responseDataEnd = ");";
+      }
+
+      size_t length;
+      do
+      {
+        const size_t offset = m_responseData.size();
+        m_responseData.resize(offset + HTTP_RESPONSE_CHUNK_SIZE);
+        length = m_responseWriter->Read(m_responseData.data() + offset, HTTP_RESPONSE_CHUNK_SIZE);
+        m_responseData.resize(offset + length);
+      } while (length > 0 && m_responseData.size() < MAX_HTTP_BUFFERED_RESPONSE_SIZE);
+
+      if (m_responseWriter->HasFailed())
+      {
+        m_responseWriter.reset();
+        m_response.type = HTTPError;
+        m_response.status = MHD_HTTP_INTERNAL_SERVER_ERROR;
+
+        return MHD_YES;
+      }
+
+      if (length > 0)
+      {
+        // send the rest out while it is being serialized, library listings can be huge
+        m_response.type = HTTPStreamDownload;
+        m_response.status = MHD_HTTP_OK;
+        m_response.contentType = "application/json";
 
-    if (!jsonpCallback.empty())
-      m_responseData = jsonpCallback + "(" + m_responseData + ");";
+        return MHD_YES;
+      }
+
+      m_responseWriter.reset();
+      m_responseData += m_responseDataEnd;
+      m_responseDataEnd.clear();
+    }
+    else if (!jsonpCallback.empty())
+      m_responseData = jsonpCallback + "();";
   }
   else if (jsonpCallback.empty())
   {
@@ -118,6 +170,45 @@ HttpResponseRanges CHTTPJsonRpcHandler::GetResponseData() const
   return ranges;
 }
 
+ssize_t CHTTPJsonRpcHandler::ReadResponseData(char* buffer, size_t size)
+{
+  size_t read = 0;
+  while (read < size)
+  {
+    // the part of the response serialized already, or the end of the JSONP callback
+    if (m_responseDataPosition < m_responseData.size())
+    {
+      const size_t length = std::min(size - read, m_responseData.size() - m_responseDataPosition);
+      memcpy(buffer + read, m_responseData.data() + m_responseDataPosition, length);
+      m_responseDataPosition += length;
+      read += length;
+      continue;
+    }
+
+    if (!m_responseWriter)
+      break;
+
+    const size_t length = m_responseWriter->Read(buffer + read, size - read);
+    if (m_responseWriter->HasFailed())
+    {
+      CServiceBroker::GetLogging()
+          .GetLogger("CHTTPJsonRpcHandler")
+          ->error("Failed to serialize the JSON-RPC response");
+      return -1;
+    }
+
+    if (length == 0)
+    {
+      m_responseWriter.reset();
+      m_responseData = std::move(m_responseDataEnd);
+      m_responseDataPosition = 0;
+    }
+    read += length;
+  }
+
+  return static_cast<ssize_t>(read);
+}
+
 bool CHTTPJsonRpcHandler::appendPostData(const char *data, size_t size)
 {
   if (m_requestData.size() + size > MAX_HTTP_POST_SIZE)
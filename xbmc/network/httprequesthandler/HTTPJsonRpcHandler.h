@@ -11,7 +11,9 @@
 #include "interfaces/json-rpc/IClient.h"
 #include "interfaces/json-rpc/ITransportLayer.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "utils/JSONVariantStreamWriter.h"
 
+#include <memory>
 #include <string>
 
 class CHTTPJsonRpcHandler : public IHTTPRequestHandler
@@ -27,6 +29,7 @@ public:
   MHD_RESULT HandleRequest() override;
 
   HttpResponseRanges GetResponseData() const override;
+  ssize_t ReadResponseData(char* buffer, size_t size) override;
 
   int GetPriority() const override { return 5; }
 
@@ -41,6 +44,9 @@ private:
   std::string m_requestData;
   std::string m_responseData;
   CHttpResponseRange m_responseRange;
+  std::unique_ptr<CJSONVariantStreamWriter> m_responseWriter;
+  size_t m_responseDataPosition = 0;
+  std::string m_responseDataEnd;
 
   class CHTTPTransportLayer : public JSONRPC::ITransportLayer
   {
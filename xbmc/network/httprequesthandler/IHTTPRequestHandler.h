@@ -60,7 +60,10 @@ typedef enum HTTPResponseType
   HTTPMemoryDownloadFreeNoCopy,
   // creates a HTTP response from a buffer by copying followed by freeing the buffer
   // the buffer must have been malloc'ed and not new'ed
-  HTTPMemoryDownloadFreeCopy
+  HTTPMemoryDownloadFreeCopy,
+  // creates a HTTP response of unknown length with the content read from the request handler
+  // while it is being sent
+  HTTPStreamDownload
 } HTTPResponseType;
 
 typedef struct HTTPRequest
@@ -153,6 +156,15 @@ public:
    */
   virtual HttpResponseRanges GetResponseData() const { return HttpResponseRanges(); }
 
+  /*!
+   * \brief Reads the next part of the response into the given buffer.
+   *
+   * \details This is only used if the response type is HTTPStreamDownload.
+   *
+   * \return The number of bytes read, 0 once the whole response has been read or -1 on failure.
+   */
+  virtual ssize_t ReadResponseData(char* buffer, size_t size) { return -1; }
+
   /*!
   * \brief Returns the URL to which the request should be redirected.
   *
@@ -12,8 +12,10 @@
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "filesystem/File.h"
+#include "guilib/DDSImage.h"
 #include "guilib/Texture.h"
 #include "guilib/imagefactory.h"
+#include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
@@ -176,8 +178,9 @@ bool CPicture::ResizeTexture(const std::string &image, uint8_t *pixels, uint32_t
     dest_height = (uint32_t)(height * factor);
   }
 
-  // nothing special to do if the dimensions already match
-  if (dest_width >= width || dest_height >= height)
+  // nothing special to do if the dimensions already match, if only one of them does the other
+  // one still has to be scaled to keep the aspect ratio
+  if (dest_width >= width && dest_height >= height)
     return GetThumbnailFromSurface(pixels, dest_width, dest_height, pitch, image, result, result_size);
 
   // create a buffer large enough for the resulting image
@@ -276,6 +279,9 @@ bool CPicture::CacheTexture(uint8_t *pixels, uint32_t width, uint32_t height, ui
       {
         success = CreateThumbnailFromSurface(reinterpret_cast<unsigned char*>(buffer.get()),
                                              dest_width, dest_height, dest_width_aligned * 4, dest);
+        if (success && advancedSettings->m_imageCacheCompressed)
+          CreateCompressedThumbnail(reinterpret_cast<unsigned char*>(buffer.get()), dest_width,
+                                    dest_height, dest_width_aligned * 4, dest);
       }
     }
     return success;
@@ -284,11 +290,34 @@ bool CPicture::CacheTexture(uint8_t *pixels, uint32_t width, uint32_t height, ui
   { // no orientation needed
     dest_width = width;
     dest_height = height;
-    return CreateThumbnailFromSurface(pixels, width, height, pitch, dest);
+    if (!CreateThumbnailFromSurface(pixels, width, height, pitch, dest))
+      return false;
+    if (advancedSettings->m_imageCacheCompressed)
+      CreateCompressedThumbnail(pixels, width, height, pitch, dest);
+    return true;
   }
   return false;
 }
 
+void CPicture::CreateCompressedThumbnail(const unsigned char* buffer,
+                                         unsigned int width,
+                                         unsigned int height,
+                                         unsigned int stride,
+                                         const std::string& dest)
+{
+  const bool alpha = URIUtils::HasExtension(dest, ".png");
+  const CRenderSystemBase* renderSystem = CServiceBroker::GetRenderSystem();
+  if (!renderSystem || !renderSystem->SupportsCompressedTextureFormat(
+                           alpha ? KD_TEX_FMT_S3TC_RGBA8 : KD_TEX_FMT_S3TC_RGB8))
+    return;
+
+  const std::string ddsFile = URIUtils::ReplaceExtension(dest, ".dds");
+  CDDSImage image;
+  if (!image.Compress(width, height, stride, buffer, alpha ? XB_FMT_DXT5 : XB_FMT_DXT1) ||
+      !image.WriteFile(ddsFile))
+    CLog::Log(LOGERROR, "Failed to create compressed thumbnail {}", CURL::GetRedacted(ddsFile));
+}
+
 std::unique_ptr<CTexture> CPicture::CreateTiledThumb(const std::vector<std::string>& files)
 {
   if (files.empty())
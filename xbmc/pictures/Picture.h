@@ -53,6 +53,8 @@ public:
     CPictureScalingAlgorithm::Algorithm scalingAlgorithm = CPictureScalingAlgorithm::NoAlgorithm);
 
   /*! \brief Cache a texture, resizing, rotating and flipping as needed, and saving as a JPG or PNG
+   If advancedsettings imagecachecompressed is enabled and the GPU can sample DXT textures, a DXT
+   compressed copy is saved next to it as a DDS for the GUI to upload as is.
    \param texture a pointer to a CTexture
    \param dest_width [in/out] maximum width in pixels of cached version - replaced with actual cached width
    \param dest_height [in/out] maximum height in pixels of cached version - replaced with actual cached height
@@ -84,6 +86,15 @@ public:
       CPictureScalingAlgorithm::Algorithm scalingAlgorithm = CPictureScalingAlgorithm::NoAlgorithm);
 
 private:
+  /*! \brief Save a DXT compressed copy of a cached image next to it, with a .dds extension
+   \param dest the cached JPG or PNG, a PNG keeps its alpha channel
+   */
+  static void CreateCompressedThumbnail(const unsigned char* buffer,
+                                        unsigned int width,
+                                        unsigned int height,
+                                        unsigned int stride,
+                                        const std::string& dest);
+
   static bool OrientateImage(std::unique_ptr<uint32_t[]>& pixels,
                              unsigned int& width,
                              unsigned int& height,
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/FFmpegImage.h"
+#include "pictures/Picture.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr uint32_t WIDTH = 2000;
+constexpr uint32_t HEIGHT = 1000;
+
+struct ResizeResult
+{
+  bool success = false;
+  uint32_t width = 0; //!< the width reported by ResizeTexture
+  uint32_t height = 0; //!< the height reported by ResizeTexture
+  unsigned int decodedWidth = 0; //!< the width of the image ResizeTexture encoded
+  unsigned int decodedHeight = 0; //!< the height of the image ResizeTexture encoded
+};
+
+ResizeResult Resize(uint32_t width, uint32_t height)
+{
+  std::vector<uint8_t> pixels(WIDTH * HEIGHT * 4);
+  for (size_t i = 0; i < pixels.size(); ++i)
+    pixels[i] = static_cast<uint8_t>(i % 4 == 3 ? 0xFF : (i / 4) % 251);
+
+  ResizeResult resized;
+  resized.width = width;
+  resized.height = height;
+  uint8_t* result = nullptr;
+  size_t resultSize = 0;
+  resized.success = CPicture::ResizeTexture("resized.jpg", pixels.data(), WIDTH, HEIGHT, WIDTH * 4,
+                                            resized.width, resized.height, result, resultSize);
+  const std::unique_ptr<uint8_t[]> encoded(result);
+  if (!resized.success)
+    return resized;
+
+  CFFmpegImage image("image/jpeg");
+  if (image.LoadImageFromMemory(encoded.get(), resultSize, 0, 0))
+  {
+    resized.decodedWidth = image.Width();
+    resized.decodedHeight = image.Height();
+  }
+  return resized;
+}
+} // unnamed namespace
+
+TEST(TestPicture, ResizeTextureKeepsAspectRatio)
+{
+  const ResizeResult resized = Resize(600, 200);
+  ASSERT_TRUE(resized.success);
+  EXPECT_EQ(400u, resized.width);
+  EXPECT_EQ(200u, resized.height);
+  EXPECT_EQ(400u, resized.decodedWidth);
+  EXPECT_EQ(200u, resized.decodedHeight);
+}
+
+TEST(TestPicture, ResizeTextureScalesWhenOneSideMatches)
+{
+  // the full width was requested, which used to crop the image to the requested height
+  ResizeResult resized = Resize(WIDTH, 200);
+  ASSERT_TRUE(resized.success);
+  EXPECT_EQ(400u, resized.width);
+  EXPECT_EQ(200u, resized.height);
+  EXPECT_EQ(400u, resized.decodedWidth);
+  EXPECT_EQ(200u, resized.decodedHeight);
+
+  resized = Resize(500, HEIGHT);
+  ASSERT_TRUE(resized.success);
+  EXPECT_EQ(500u, resized.width);
+  EXPECT_EQ(250u, resized.height);
+  EXPECT_EQ(500u, resized.decodedWidth);
+  EXPECT_EQ(250u, resized.decodedHeight);
+}
+
+TEST(TestPicture, ResizeTextureNeverUpscales)
+{
+  ResizeResult resized = Resize(0, 0);
+  ASSERT_TRUE(resized.success);
+  EXPECT_EQ(WIDTH, resized.decodedWidth);
+  EXPECT_EQ(HEIGHT, resized.decodedHeight);
+
+  resized = Resize(4000, 3000);
+  ASSERT_TRUE(resized.success);
+  EXPECT_EQ(WIDTH, resized.width);
+  EXPECT_EQ(HEIGHT, resized.height);
+  EXPECT_EQ(WIDTH, resized.decodedWidth);
+  EXPECT_EQ(HEIGHT, resized.decodedHeight);
+}
@@ -17,11 +17,19 @@
 #include <assert.h>
 #include <errno.h>
 #include <limits.h>
+#include <string.h>
 #include <string>
 
 #include <fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+#include <sys/statfs.h>
+#elif defined(TARGET_DARWIN) || defined(TARGET_FREEBSD)
+#include <sys/param.h>
+#include <sys/mount.h>
+#endif
 
 #if defined(HAVE_STATX) // use statx if available to get file birth date
 #include <sys/sysmacros.h>
@@ -30,8 +38,54 @@
 
 using namespace XFILE;
 
+namespace
+{
+// how far ahead of the read position the kernel is asked to page in a mapped file
+constexpr int64_t MAPPING_READAHEAD = 8 * 1024 * 1024;
+// 32 bit platforms don't have the address space to map large media files
+constexpr int64_t MAX_MAPPING_LENGTH_32BIT = 256 * 1024 * 1024;
+
+/*!
+ * \brief Check if a file is on a file system backed by a local disk.
+ *
+ * Reading a mapped page the file system can't deliver raises SIGBUS, which network and FUSE mounts
+ * do whenever the server or the daemon goes away. Only map files from file systems that can't.
+ */
+bool IsOnLocalDisk(int fd)
+{
+#if defined(TARGET_LINUX) || defined(TARGET_ANDROID)
+  constexpr unsigned long EXT_SUPER_MAGIC = 0xEF53;
+  constexpr unsigned long XFS_SUPER_MAGIC = 0x58465342;
+  constexpr unsigned long BTRFS_SUPER_MAGIC = 0x9123683E;
+  constexpr unsigned long F2FS_SUPER_MAGIC = 0xF2F52010;
+
+  struct statfs fs;
+  if (fstatfs(fd, &fs) != 0)
+    return false;
+
+  switch (static_cast<unsigned long>(fs.f_type))
+  {
+    case EXT_SUPER_MAGIC:
+    case XFS_SUPER_MAGIC:
+    case BTRFS_SUPER_MAGIC:
+    case F2FS_SUPER_MAGIC:
+      return true;
+    default:
+      return false;
+  }
+#elif defined(TARGET_DARWIN) || defined(TARGET_FREEBSD)
+  struct statfs fs;
+  return fstatfs(fd, &fs) == 0 && (fs.f_flags & MNT_LOCAL) &&
+         strncmp(fs.f_mntfromname, "/dev/", 5) == 0;
+#else
+  return false;
+#endif
+}
+} // namespace
+
 CPosixFile::~CPosixFile()
 {
+  Unmap();
   if (m_fd >= 0)
     close(m_fd);
 }
@@ -83,6 +137,7 @@ bool CPosixFile::OpenForWrite(const CURL& url, bool bOverWrite /* = false*/ )
 
 void CPosixFile::Close()
 {
+  Unmap();
   if (m_fd >= 0)
   {
     close(m_fd);
@@ -106,6 +161,20 @@ ssize_t CPosixFile::Read(void* lpBuf, size_t uiBufSize)
   if (uiBufSize > SSIZE_MAX)
     uiBufSize = SSIZE_MAX;
 
+  if (m_mapping)
+  {
+    // Reading a page past the end of a truncated file raises SIGBUS, so check the length before
+    // each copy and go back to read() for good once the file has shrunk.
+    struct stat64 st;
+    if (fstat64(m_fd, &st) != 0 || st.st_size < m_mappedLength)
+    {
+      CLog::LogF(LOGDEBUG, "File was truncated, reading it without the mapping");
+      Unmap();
+    }
+    else
+      return ReadMapped(lpBuf, uiBufSize);
+  }
+
   const ssize_t res = read(m_fd, lpBuf, uiBufSize);
   if (res < 0)
   {
@@ -116,24 +185,125 @@ ssize_t CPosixFile::Read(void* lpBuf, size_t uiBufSize)
   if (m_filePos >= 0)
   {
     m_filePos += res; // if m_filePos was known - update it
+    DropCacheBehind();
+  }
+
+  return res;
+}
+
+ssize_t CPosixFile::ReadMapped(void* lpBuf, size_t uiBufSize)
+{
+  if (m_filePos >= m_mappedLength)
+  {
+    // the file has grown since it was mapped, the fd offset isn't maintained in this mode
+    const ssize_t res = pread(m_fd, lpBuf, uiBufSize, m_filePos);
+    if (res > 0)
+      m_filePos += res;
+    return res < 0 ? -1 : res;
+  }
+
+  const size_t size =
+      static_cast<size_t>(std::min<int64_t>(uiBufSize, m_mappedLength - m_filePos));
+  memcpy(lpBuf, m_mapping + m_filePos, size);
+  m_filePos += size;
+
+  // Keep the kernel ahead of us. MADV_SEQUENTIAL alone only triggers read-ahead on page faults,
+  // which stalls the reader on every fault.
+  if (m_filePos + MAPPING_READAHEAD / 2 > m_willNeedPos)
+  {
+    const int64_t pageSize = sysconf(_SC_PAGESIZE);
+    const int64_t start = std::max(m_filePos, m_willNeedPos) / pageSize * pageSize;
+    const int64_t end = std::min(m_filePos + MAPPING_READAHEAD, m_mappedLength);
+    if (start < end)
+      madvise(m_mapping + start, end - start, MADV_WILLNEED);
+    m_willNeedPos = end;
+  }
+  DropCacheBehind();
+
+  return size;
+}
+
+void CPosixFile::DropCacheBehind()
+{
+  // Drop the cache between then last drop and 16 MB behind where we
+  // are now, to make sure the file doesn't displace everything else.
+  // However, never throw out the first 16 MB of the file, as it might
+  // be the header etc., and never ask the OS to drop in chunks of
+  // less than 1 MB.
+  const int64_t end_drop = m_filePos - 16 * 1024 * 1024;
+  if (end_drop < 17 * 1024 * 1024)
+    return;
+
+  const int64_t start_drop = std::max<int64_t>(m_lastDropPos, 16 * 1024 * 1024);
+  if (end_drop - start_drop < 1 * 1024 * 1024)
+    return;
+
+  if (m_mapping)
+  {
+    // pages still mapped by us can't be evicted from the page cache
+    const int64_t pageSize = sysconf(_SC_PAGESIZE);
+    const int64_t start = (start_drop + pageSize - 1) / pageSize * pageSize;
+    const int64_t end = std::min(end_drop, m_mappedLength) / pageSize * pageSize;
+    if (start < end)
+      madvise(m_mapping + start, end - start, MADV_DONTNEED);
+  }
+
 #if defined(HAVE_POSIX_FADVISE)
-    // Drop the cache between then last drop and 16 MB behind where we
-    // are now, to make sure the file doesn't displace everything else.
-    // However, never throw out the first 16 MB of the file, as it might
-    // be the header etc., and never ask the OS to drop in chunks of
-    // less than 1 MB.
-    const int64_t end_drop = m_filePos - 16 * 1024 * 1024;
-    if (end_drop >= 17 * 1024 * 1024)
-    {
-      const int64_t start_drop = std::max<int64_t>(m_lastDropPos, 16 * 1024 * 1024);
-      if (end_drop - start_drop >= 1 * 1024 * 1024 &&
-          posix_fadvise(m_fd, start_drop, end_drop - start_drop, POSIX_FADV_DONTNEED) == 0)
-        m_lastDropPos = end_drop;
-    }
+  if (posix_fadvise(m_fd, start_drop, end_drop - start_drop, POSIX_FADV_DONTNEED) == 0)
+    m_lastDropPos = end_drop;
+#else
+  if (m_mapping)
+    m_lastDropPos = end_drop;
 #endif
+}
+
+bool CPosixFile::Map()
+{
+  if (m_mapping)
+    return true;
+
+  // only read-only regular files, mapping devices or pipes doesn't make sense
+  struct stat64 st;
+  if (m_allowWrite || fstat64(m_fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0)
+    return false;
+
+  if (!IsOnLocalDisk(m_fd))
+    return false;
+
+  if (sizeof(void*) < 8 && st.st_size > MAX_MAPPING_LENGTH_32BIT)
+    return false;
+
+  const int64_t position = GetPosition();
+  if (position < 0)
+    return false;
+
+  void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, m_fd, 0);
+  if (mapping == MAP_FAILED)
+  {
+    CLog::LogF(LOGDEBUG, "Unable to map file ({})", strerror(errno));
+    return false;
   }
+  madvise(mapping, st.st_size, MADV_SEQUENTIAL);
 
-  return res;
+  m_mapping = static_cast<uint8_t*>(mapping);
+  m_mappedLength = st.st_size;
+  m_willNeedPos = position;
+  return true;
+}
+
+void CPosixFile::Unmap()
+{
+  if (!m_mapping)
+    return;
+
+  munmap(m_mapping, m_mappedLength);
+  m_mapping = nullptr;
+  m_mappedLength = 0;
+  m_willNeedPos = -1;
+
+  // sync the fd offset again, it isn't maintained while mapped
+  if (m_fd >= 0 && m_filePos >= 0)
+    lseek(m_fd, m_filePos, SEEK_SET);
 }
 
 ssize_t CPosixFile::Write(const void* lpBuf, size_t uiBufSize)
@@ -166,6 +336,24 @@ int64_t CPosixFile::Seek(int64_t iFilePosition, int iWhence /* = SEEK_SET*/)
   if (m_fd < 0)
     return -1;
 
+  if (m_mapping)
+  {
+    // reads don't move the fd offset in this mode, so track the position ourselves
+    int64_t position = iFilePosition;
+    if (iWhence == SEEK_CUR)
+      position += m_filePos;
+    else if (iWhence == SEEK_END)
+      position += GetLength();
+    else if (iWhence != SEEK_SET)
+      return -1;
+
+    if (position < 0)
+      return -1;
+
+    m_filePos = position;
+    return m_filePos;
+  }
+
 #ifdef TARGET_ANDROID
   //! @todo properly support with detection in configure
   //! Android special case: Android doesn't substitute off64_t for off_t and similar functions
@@ -267,6 +455,8 @@ int CPosixFile::IoControl(IOControl request, void* param)
         return 0; // size of file is 1 byte or more and seeking not possible
     }
   }
+  else if (request == IOControl::MEMORY_MAP)
+    return Map() ? 0 : -1;
 
   return -1;
 }
@@ -38,10 +38,18 @@ namespace XFILE
     int Stat(struct __stat64* buffer) override;
 
   protected:
+    bool Map();
+    void Unmap();
+    ssize_t ReadMapped(void* lpBuf, size_t uiBufSize);
+    void DropCacheBehind();
+
     int     m_fd = -1;
     int64_t m_filePos = -1;
     int64_t m_lastDropPos = -1;
     bool    m_allowWrite = false;
+    uint8_t* m_mapping = nullptr;
+    int64_t m_mappedLength = 0;
+    int64_t m_willNeedPos = -1;
   };
 
 }
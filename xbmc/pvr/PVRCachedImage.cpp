@@ -61,7 +61,7 @@ void CPVRCachedImage::SetOwner(std::string_view owner)
 void CPVRCachedImage::UpdateLocalImage()
 {
   if (m_clientImage.empty())
-    m_localImage.clear();
+    m_localImage = CPVRSharedString();
   else
     m_localImage = IMAGE_FILES::URLFromFile(m_clientImage, m_owner);
 }
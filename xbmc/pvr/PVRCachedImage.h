@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "pvr/PVRSharedString.h"
+
 #include <string>
 #include <string_view>
 
@@ -25,8 +27,8 @@ public:
 
   bool operator==(const CPVRCachedImage& right) const;
 
-  const std::string& GetClientImage() const { return m_clientImage; }
-  const std::string& GetLocalImage() const { return m_localImage; }
+  const std::string& GetClientImage() const { return m_clientImage.Get(); }
+  const std::string& GetLocalImage() const { return m_localImage.Get(); }
 
   void SetClientImage(const std::string& image);
 
@@ -35,9 +37,9 @@ public:
 private:
   void UpdateLocalImage();
 
-  std::string m_clientImage;
-  std::string m_localImage;
-  std::string m_owner;
+  CPVRSharedString m_clientImage;
+  CPVRSharedString m_localImage;
+  CPVRSharedString m_owner;
 };
 
 } // namespace PVR
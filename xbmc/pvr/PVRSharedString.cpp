@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PVRSharedString.h"
+
+#include "threads/CriticalSection.h"
+#include "utils/StringUtils.h"
+
+#include <mutex>
+#include <unordered_map>
+
+using namespace PVR;
+
+namespace
+{
+struct StringPool
+{
+  CCriticalSection critSection;
+  std::unordered_map<std::string_view, std::weak_ptr<const std::string>> strings;
+  size_t length{0};
+};
+
+StringPool& GetStringPool()
+{
+  // never destroyed, instances may still be released during static destruction
+  static StringPool* pool = new StringPool;
+  return *pool;
+}
+
+void ReleaseString(const std::string* str)
+{
+  StringPool& pool = GetStringPool();
+  {
+    std::unique_lock lock(pool.critSection);
+    // the entry may have been replaced by an equal string already
+    const auto it = pool.strings.find(*str);
+    if (it != pool.strings.end() && it->first.data() == str->data())
+    {
+      pool.strings.erase(it);
+      pool.length -= str->size();
+    }
+  }
+  delete str;
+}
+
+std::shared_ptr<const std::string> InternString(std::string_view str)
+{
+  if (str.empty())
+    return {};
+
+  StringPool& pool = GetStringPool();
+  std::unique_lock lock(pool.critSection);
+
+  const auto it = pool.strings.find(str);
+  if (it != pool.strings.end())
+  {
+    std::shared_ptr<const std::string> shared = it->second.lock();
+    if (shared)
+      return shared;
+
+    // the last instance is just being released
+    pool.strings.erase(it);
+    pool.length -= str.size();
+  }
+
+  std::shared_ptr<const std::string> shared(new std::string(str), ReleaseString);
+  pool.strings.try_emplace(*shared, shared);
+  pool.length += str.size();
+  return shared;
+}
+} // unnamed namespace
+
+CPVRSharedString::CPVRSharedString(std::string_view str) : m_string(InternString(str))
+{
+}
+
+CPVRSharedString& CPVRSharedString::operator=(std::string_view str)
+{
+  if (Get() != str)
+    m_string = InternString(str);
+  return *this;
+}
+
+const std::string& CPVRSharedString::Get() const
+{
+  return m_string ? *m_string : StringUtils::Empty;
+}
+
+size_t CPVRSharedString::GetPoolSize()
+{
+  StringPool& pool = GetStringPool();
+  std::unique_lock lock(pool.critSection);
+  return pool.strings.size();
+}
+
+size_t CPVRSharedString::GetPoolLength()
+{
+  StringPool& pool = GetStringPool();
+  std::unique_lock lock(pool.critSection);
+  return pool.length;
+}
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace PVR
+{
+
+/*!
+ * @brief An immutable string stored once for all instances with the same value.
+ *
+ * Meant for the text of PVR data held in large numbers, like the titles, genres and image paths
+ * of EPG tags, which repeat a lot across channels and days. The strings are kept in a process
+ * wide pool for as long as any instance refers to them.
+ */
+class CPVRSharedString
+{
+public:
+  CPVRSharedString() = default;
+  explicit CPVRSharedString(std::string_view str);
+
+  CPVRSharedString& operator=(std::string_view str);
+
+  // equal strings share their storage, so comparing the storage is enough
+  bool operator==(const CPVRSharedString& right) const { return m_string == right.m_string; }
+  bool operator==(std::string_view right) const { return Get() == right; }
+
+  const std::string& Get() const;
+  operator const std::string&() const { return Get(); }
+
+  bool empty() const { return !m_string; }
+
+  /*!
+   * @brief Get the number of distinct strings in the pool.
+   */
+  static size_t GetPoolSize();
+
+  /*!
+   * @brief Get the number of characters stored in the pool.
+   */
+  static size_t GetPoolLength();
+
+private:
+  std::shared_ptr<const std::string> m_string; // nullptr for an empty string
+};
+
+} // namespace PVR
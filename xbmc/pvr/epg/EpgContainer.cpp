@@ -282,11 +282,13 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
 
         bReturn &= epg->QueuePersistQuery(database);
 
-        size_t queryCount = database->GetInsertQueriesCount() + database->GetDeleteQueriesCount();
+        size_t queryCount = database->GetInsertQueriesCount() +
+                            database->GetDeleteQueriesCount() + database->GetTagChangesCount();
         if (queryCount > EPG_COMMIT_QUERY_COUNT_LIMIT)
         {
           CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: committing {} queries in loop.",
                       queryCount);
+          database->CommitTagChanges();
           database->CommitDeleteQueries();
           database->CommitInsertQueries();
           CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Container: committed {} queries in loop.", queryCount);
@@ -298,6 +300,7 @@ bool CPVREpgContainer::PersistAll(unsigned int iMaxTimeslice) const
 
     if (bReturn)
     {
+      database->CommitTagChanges();
       database->CommitDeleteQueries();
       database->CommitInsertQueries();
     }
@@ -562,6 +565,15 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgContainer::GetTags(
   return results;
 }
 
+std::optional<std::vector<int>> CPVREpgContainer::GetTagIdsContaining(const std::string& strText,
+                                                                     unsigned int fields) const
+{
+  // make sure we have up-to-date data in the database.
+  PersistAll(std::numeric_limits<unsigned int>::max());
+
+  return GetEpgDatabase()->GetEpgTagIdsContaining(strText, fields);
+}
+
 void CPVREpgContainer::InsertFromDB(const std::shared_ptr<CPVREpg>& newEpg)
 {
   std::unique_lock lock(m_critSection);
@@ -19,6 +19,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -169,6 +170,16 @@ public:
    */
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTags(const PVREpgSearchData& searchData) const;
 
+  /*!
+   * @brief Get the EPG tags that may contain a text, from the search index of the database.
+   * @param strText The text.
+   * @param fields The fields to search, a combination of CPVREpgSearchIndex::Field values.
+   * @return The database ids of the candidate tags in ascending order, or std::nullopt if the
+   * search can't be narrowed down.
+   */
+  std::optional<std::vector<int>> GetTagIdsContaining(const std::string& strText,
+                                                      unsigned int fields) const;
+
   /*!
    * @brief Notify EPG container that there are pending manual EPG updates
    * @param bHasPendingUpdates The new value
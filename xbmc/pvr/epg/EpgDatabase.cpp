@@ -20,9 +20,12 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -30,6 +33,33 @@
 using namespace dbiplus;
 using namespace PVR;
 
+namespace
+{
+// beyond this, listing the candidates in the query costs more than the index saves
+constexpr size_t MAX_SEARCH_INDEX_CANDIDATES = 20000;
+
+// the statements of the tag change log
+const std::string DELETE_TAG_QUERY = "DELETE FROM epgtags WHERE idBroadcast = ?";
+const std::string DELETE_TAGS_BY_MIN_END_MAX_START_TIME_QUERY =
+    "DELETE FROM epgtags WHERE idEpg = ? AND iEndTime >= ? AND iStartTime <= ?";
+const std::string PERSIST_TAG_QUERY =
+    "REPLACE INTO epgtags (idEpg, iStartTime, iEndTime, sTitle, sPlotOutline, sPlot, "
+    "sOriginalTitle, sCast, sDirector, sWriter, iYear, sIMDBNumber, sIconPath, iGenreType, "
+    "iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, iSeriesId, iEpisodeId, "
+    "iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, iBroadcastUid, "
+    "sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
+    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, "
+    "?)";
+const std::string PERSIST_TAG_WITH_ID_QUERY =
+    "REPLACE INTO epgtags (idEpg, iStartTime, iEndTime, sTitle, sPlotOutline, sPlot, "
+    "sOriginalTitle, sCast, sDirector, sWriter, iYear, sIMDBNumber, sIconPath, iGenreType, "
+    "iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, iSeriesId, iEpisodeId, "
+    "iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, iBroadcastUid, "
+    "sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo, idBroadcast) "
+    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, "
+    "?, ?)";
+} // unnamed namespace
+
 CPVREpgDatabase::CPVREpgDatabase() : CDatabase(KODI::DATABASE::TYPE_EPG)
 {
 }
@@ -44,6 +74,8 @@ bool CPVREpgDatabase::Open()
 void CPVREpgDatabase::Close()
 {
   std::unique_lock lock(m_critSection);
+  ClearSearchIndex();
+  m_tagChanges.clear();
   CDatabase::Close();
 }
 
@@ -364,6 +396,7 @@ bool CPVREpgDatabase::DeleteEpg()
   bReturn = DeleteValues("epg") || bReturn;
   bReturn = DeleteValues("epgtags") || bReturn;
   bReturn = DeleteValues("lastepgscan") || bReturn;
+  ClearSearchIndex();
 
   return bReturn;
 }
@@ -381,6 +414,7 @@ bool CPVREpgDatabase::QueueDeleteEpgQuery(const CPVREpg& table)
 
   std::unique_lock lock(m_critSection);
   filter.AppendWhere(PrepareSQL("idEpg = %u", table.EpgID()));
+  InvalidateSearchIndex(table.EpgID());
 
   std::string strQuery;
   if (BuildSQL(PrepareSQL("DELETE FROM %s ", "epg"), filter, strQuery))
@@ -395,14 +429,10 @@ bool CPVREpgDatabase::QueueDeleteTagQuery(const CPVREpgInfoTag& tag)
   if (tag.DatabaseID() <= 0)
     return false;
 
-  Filter filter;
-
   std::unique_lock lock(m_critSection);
-  filter.AppendWhere(PrepareSQL("idBroadcast = %u", tag.DatabaseID()));
-
-  std::string strQuery;
-  BuildSQL(PrepareSQL("DELETE FROM %s ", "epgtags"), filter, strQuery);
-  return QueueDeleteQuery(strQuery);
+  InvalidateSearchIndex(tag.EpgID());
+  m_tagChanges.emplace_back(TagChange{&DELETE_TAG_QUERY, make_params(tag.DatabaseID())});
+  return true;
 }
 
 std::vector<std::shared_ptr<CPVREpg>> CPVREpgDatabase::GetAll()
@@ -578,6 +608,51 @@ public:
 
   bool HasSearchTerm() const { return !m_fragments.empty(); }
 
+  /*!
+   * @brief Get the tags that may match the search term.
+   * @param find Looks up the tags that may contain a term, std::nullopt meaning all tags.
+   * @return The database ids of the candidate tags in ascending order, or std::nullopt if the
+   * search term can't be narrowed down.
+   */
+  template<typename F>
+  std::optional<std::vector<int>> GetCandidates(F&& find) const
+  {
+    if (m_alternatives.empty())
+      return {};
+
+    // OR of ANDs, the precedence the terms have in SQL
+    std::vector<int> candidates;
+    for (const std::vector<std::string>& terms : m_alternatives)
+    {
+      std::optional<std::vector<int>> matches;
+      for (const std::string& term : terms)
+      {
+        std::optional<std::vector<int>> termMatches{find(term)};
+        if (!termMatches)
+          continue;
+
+        if (matches)
+        {
+          std::vector<int> both;
+          std::ranges::set_intersection(*matches, *termMatches, std::back_inserter(both));
+          matches = std::move(both);
+        }
+        else
+        {
+          matches = std::move(termMatches);
+        }
+      }
+
+      if (!matches)
+        return {};
+
+      std::vector<int> either;
+      std::ranges::set_union(candidates, *matches, std::back_inserter(either));
+      candidates = std::move(either);
+    }
+    return candidates;
+  }
+
   std::string ToSQL(std::string_view strFieldName) const
   {
     std::string result = "(";
@@ -605,6 +680,8 @@ private:
     std::string strFragment;
 
     bool bNextOR = false;
+    bool bNextAND = false;
+    bool bNegated = false;
     while (!strParsedSearchTerm.empty())
     {
       StringUtils::TrimLeft(strParsedSearchTerm);
@@ -616,6 +693,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " NOT ";
         bNextOR = false;
+        bNegated = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "and"))
@@ -624,6 +702,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " AND ";
         bNextOR = false;
+        bNextAND = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "|") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "or"))
@@ -632,6 +711,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " OR ";
         bNextOR = false;
+        bNextAND = false;
       }
       else
       {
@@ -648,6 +728,12 @@ private:
           strFragment.clear();
 
           strFragment += ") LIKE UPPER('%";
+
+          if (!bNextAND || m_alternatives.empty())
+            m_alternatives.emplace_back();
+          m_alternatives.back().emplace_back(strTerm);
+          bNextAND = false;
+
           StringUtils::Replace(strTerm, "'", "''"); // escape '
           strFragment += strTerm;
           strFragment += "%')) ";
@@ -665,6 +751,9 @@ private:
 
     if (!strFragment.empty())
       m_fragments.emplace_back(strFragment);
+
+    if (bNegated)
+      m_alternatives.clear();
   }
 
   static void GetAndCutNextTerm(std::string& strSearchTerm, std::string& strNextTerm)
@@ -691,6 +780,7 @@ private:
   }
 
   std::vector<std::string> m_fragments;
+  std::vector<std::vector<std::string>> m_alternatives; ///< empty if the index can't be used
 };
 
 } // unnamed namespace
@@ -816,6 +906,32 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
     }
 
     filter.AppendWhere(strWhere);
+
+    // the terms are still matched, the index only narrows down the tags to look at
+    if (UpdateSearchIndex())
+    {
+      const unsigned int fields{CPVREpgSearchIndex::FIELD_TITLE |
+                                CPVREpgSearchIndex::FIELD_PLOT_OUTLINE |
+                                (searchData.m_bSearchInDescription ? CPVREpgSearchIndex::FIELD_PLOT
+                                                                   : 0)};
+      const std::optional<std::vector<int>> candidates{conv.GetCandidates(
+          [this, fields](const std::string& term) { return m_searchIndex.Find(term, fields); })};
+      if (candidates)
+      {
+        if (candidates->empty())
+          return {};
+
+        if (candidates->size() <= MAX_SEARCH_INDEX_CANDIDATES)
+        {
+          std::vector<std::string> ids;
+          ids.reserve(candidates->size());
+          for (const int id : *candidates)
+            ids.emplace_back(std::to_string(id));
+
+          filter.AppendWhere("idBroadcast IN (" + StringUtils::Join(ids, ",") + ")");
+        }
+      }
+    }
   }
 
   if (BuildSQL(strQuery, filter, strQuery))
@@ -843,6 +959,103 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
   return {};
 }
 
+std::optional<std::vector<int>> CPVREpgDatabase::GetEpgTagIdsContaining(const std::string& strText,
+                                                                        unsigned int fields) const
+{
+  std::unique_lock lock(m_critSection);
+  if (!UpdateSearchIndex())
+    return {};
+
+  return m_searchIndex.Find(strText, fields);
+}
+
+void CPVREpgDatabase::InvalidateSearchIndex(int iEpgID)
+{
+  m_outdatedSearchIndexEpgs.insert(iEpgID);
+}
+
+void CPVREpgDatabase::ClearSearchIndex()
+{
+  m_searchIndex.Clear();
+  m_bSearchIndexBuilt = false;
+  m_outdatedSearchIndexEpgs.clear();
+}
+
+bool CPVREpgDatabase::UpdateSearchIndex() const
+{
+  // MySQL's collations also fold accents, which the index does not
+  if (!m_sqlite || !m_pDB ||
+      !CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bEpgSearchIndex)
+    return false;
+
+  if (m_bSearchIndexBuilt && m_outdatedSearchIndexEpgs.empty())
+    return true;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  std::string strQuery{
+      "SELECT idBroadcast, idEpg, sTitle, sPlotOutline, sPlot, sEpisodeName FROM epgtags"};
+  if (m_bSearchIndexBuilt)
+  {
+    std::vector<std::string> epgIds;
+    for (const int iEpgID : m_outdatedSearchIndexEpgs)
+    {
+      m_searchIndex.Remove(iEpgID);
+      epgIds.emplace_back(std::to_string(iEpgID));
+    }
+    strQuery += " WHERE idEpg IN (" + StringUtils::Join(epgIds, ",") + ")";
+  }
+  else
+  {
+    m_searchIndex.Clear();
+  }
+
+  try
+  {
+    if (!m_pDS->query(strQuery))
+    {
+      m_searchIndex.Clear();
+      m_bSearchIndexBuilt = false;
+      return false;
+    }
+
+    CPVREpgSearchIndex::Entry entry;
+    while (!m_pDS->eof())
+    {
+      entry.iBroadcastId = m_pDS->fv("idBroadcast").get_asInt();
+      entry.iEpgId = m_pDS->fv("idEpg").get_asInt();
+      entry.strTitle = m_pDS->fv("sTitle").get_asString();
+      entry.strPlotOutline = m_pDS->fv("sPlotOutline").get_asString();
+      entry.strPlot = m_pDS->fv("sPlot").get_asString();
+      entry.strEpisodeName = m_pDS->fv("sEpisodeName").get_asString();
+      m_searchIndex.Add(entry);
+      m_pDS->next();
+    }
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Could not read EPG tags into the search index");
+    m_searchIndex.Clear();
+    m_bSearchIndexBuilt = false;
+    return false;
+  }
+
+  CLog::LogFC(LOGDEBUG, LOGEPG, "Updated the search index of {} EPG(s) in {} ms, {} tags indexed",
+              m_bSearchIndexBuilt ? std::to_string(m_outdatedSearchIndexEpgs.size()) : "all",
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count(),
+              m_searchIndex.Size());
+
+  // queued writes are not in the database yet, read their EPGs again once they are committed
+  m_bSearchIndexBuilt = true;
+  if (GetInsertQueriesCount() == 0 && GetDeleteQueriesCount() == 0 && m_tagChanges.empty())
+    m_outdatedSearchIndexEpgs.clear();
+
+  return true;
+}
+
 std::shared_ptr<CPVREpgInfoTag> CPVREpgDatabase::GetEpgTagByUniqueBroadcastID(
     int iEpgID, unsigned int iUniqueBroadcastId) const
 {
@@ -1079,18 +1292,12 @@ bool CPVREpgDatabase::QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(int iEpgID,
   time_t maxStart;
   maxStartTime.GetAsTime(maxStart);
 
-  Filter filter;
-
   std::unique_lock lock(m_critSection);
-  filter.AppendWhere(PrepareSQL("idEpg = %u AND iEndTime >= %u AND iStartTime <= %u", iEpgID,
-                                static_cast<unsigned int>(minEnd),
-                                static_cast<unsigned int>(maxStart)));
-
-  std::string strQuery;
-  if (BuildSQL("DELETE FROM epgtags", filter, strQuery))
-    return QueueDeleteQuery(strQuery);
-
-  return false;
+  InvalidateSearchIndex(iEpgID);
+  m_tagChanges.emplace_back(TagChange{
+      &DELETE_TAGS_BY_MIN_END_MAX_START_TIME_QUERY,
+      make_params(iEpgID, static_cast<unsigned int>(minEnd), static_cast<unsigned int>(maxStart))});
+  return true;
 }
 
 std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetAllEpgTags(int iEpgID) const
@@ -1259,6 +1466,7 @@ bool CPVREpgDatabase::DeleteEpgTags(int iEpgId, const CDateTime& maxEndTime)
   std::unique_lock lock(m_critSection);
   filter.AppendWhere(
       PrepareSQL("idEpg = %u AND iEndTime < %u", iEpgId, static_cast<unsigned int>(iMaxEndTime)));
+  InvalidateSearchIndex(iEpgId);
   return DeleteValues("epgtags", filter);
 }
 
@@ -1268,6 +1476,7 @@ bool CPVREpgDatabase::DeleteEpgTags(int iEpgId)
 
   std::unique_lock lock(m_critSection);
   filter.AppendWhere(PrepareSQL("idEpg = %u", iEpgId));
+  InvalidateSearchIndex(iEpgId);
   return DeleteValues("epgtags", filter);
 }
 
@@ -1277,6 +1486,7 @@ bool CPVREpgDatabase::QueueDeleteEpgTags(int iEpgId)
 
   std::unique_lock lock(m_critSection);
   filter.AppendWhere(PrepareSQL("idEpg = %u", iEpgId));
+  InvalidateSearchIndex(iEpgId);
 
   std::string strQuery;
   BuildSQL(PrepareSQL("DELETE FROM %s ", "epgtags"), filter, strQuery);
@@ -1301,62 +1511,70 @@ bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
   if (tag.FirstAired().IsValid())
     sFirstAired = tag.FirstAired().GetAsW3CDate();
 
-  int iBroadcastId = tag.DatabaseID();
-  std::string strQuery;
+  BindParams params = make_params(
+      tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
+      tag.Title(), tag.PlotOutline(), tag.Plot(), tag.OriginalTitle(),
+      CPVREpgInfoTag::DeTokenize(tag.Cast()), CPVREpgInfoTag::DeTokenize(tag.Directors()),
+      CPVREpgInfoTag::DeTokenize(tag.Writers()), tag.Year(), tag.IMDBNumber(),
+      tag.ClientIconPath(), tag.GenreType(), tag.GenreSubType(), tag.GenreDescription(),
+      sFirstAired, tag.ParentalRating(), tag.StarRating(), tag.SeriesNumber(),
+      tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName(), tag.Flags(), tag.SeriesLink(),
+      tag.ParentalRatingCode(), tag.UniqueBroadcastID(), tag.ClientParentalRatingIconPath(),
+      tag.ParentalRatingSource(), tag.TitleExtraInfo());
+
+  const std::string* strQuery = &PERSIST_TAG_QUERY;
+  const int iBroadcastId = tag.DatabaseID();
+  if (iBroadcastId >= 0)
+  {
+    params.emplace_back(make_param(iBroadcastId));
+    strQuery = &PERSIST_TAG_WITH_ID_QUERY;
+  }
+
+  std::unique_lock lock(m_critSection);
+  InvalidateSearchIndex(tag.EpgID());
+  m_tagChanges.emplace_back(TagChange{strQuery, std::move(params)});
+  return true;
+}
 
+bool CPVREpgDatabase::CommitTagChanges()
+{
   std::unique_lock lock(m_critSection);
+  if (m_tagChanges.empty())
+    return true;
 
-  if (iBroadcastId < 0)
+  const auto start = std::chrono::steady_clock::now();
+
+  BeginTransaction();
+
+  bool bReturn = true;
+  for (const TagChange& change : m_tagChanges)
   {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, '%s', '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
-        tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), tag.ClientParentalRatingIconPath().c_str(),
-        tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+    if (!ExecuteQuery(*change.strQuery, change.params))
+    {
+      bReturn = false;
+      break;
+    }
   }
+
+  if (bReturn)
+    bReturn = CommitTransaction();
   else
-  {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, idBroadcast, sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, %i, '%s', '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
-        tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), iBroadcastId, tag.ClientParentalRatingIconPath().c_str(),
-        tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
-  }
+    RollbackTransaction();
 
-  QueueInsertQuery(strQuery);
-  return true;
+  CLog::LogFC(LOGDEBUG, LOGEPG, "{} {} tag changes in {} ms", bReturn ? "Committed" : "Discarded",
+              m_tagChanges.size(),
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - start)
+                  .count());
+
+  m_tagChanges.clear();
+  return bReturn;
+}
+
+size_t CPVREpgDatabase::GetTagChangesCount() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_tagChanges.size();
 }
 
 int CPVREpgDatabase::GetLastEPGId() const
@@ -9,9 +9,13 @@
 #pragma once
 
 #include "dbwrappers/Database.h"
+#include "pvr/epg/EpgSearchIndex.h"
 #include "threads/CriticalSection.h"
 
 #include <memory>
+#include <optional>
+#include <set>
+#include <string>
 #include <vector>
 
 class CDateTime;
@@ -91,7 +95,7 @@ public:
   bool QueueDeleteEpgQuery(const CPVREpg& table);
 
   /*!
-   * @brief Write the query to delete the given EPG tag to db query queue.
+   * @brief Write the query to delete the given EPG tag to the tag change log.
    * @param tag The EPG tag to remove.
    * @return True on success, false otherwise.
    */
@@ -169,6 +173,16 @@ public:
    */
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEpgTags(const PVREpgSearchData& searchData) const;
 
+  /*!
+   * @brief Get the EPG tags that may contain a text, from the search index.
+   * @param strText The text.
+   * @param fields The fields to search, a combination of CPVREpgSearchIndex::Field values.
+   * @return The database ids of the candidate tags in ascending order, or std::nullopt if the
+   * index is disabled or can't narrow down the search.
+   */
+  std::optional<std::vector<int>> GetEpgTagIdsContaining(const std::string& strText,
+                                                         unsigned int fields) const;
+
   /*!
    * @brief Get an EPG tag given its EPG id and unique broadcast ID.
    * @param iEpgID The ID of the EPG for the tag to get.
@@ -235,7 +249,7 @@ public:
 
   /*!
    * @brief Write the query to delete all EPG tags in range of given EPG id, min end time and max
-   * start time to db query queue. .
+   * start time to the tag change log.
    * @param iEpgID The ID of the EPG for the tags to delete.
    * @param minEndTime The min end time for the tags to delete.
    * @param maxStartTime The max start time for the tags to delete.
@@ -299,12 +313,26 @@ public:
   bool QueueDeleteEpgTags(int iEpgId);
 
   /*!
-   * @brief Write the query to persist the given EPG tag to db query queue.
+   * @brief Write the query to persist the given EPG tag to the tag change log.
    * @param tag The tag to persist.
    * @return True on success, false otherwise.
    */
   bool QueuePersistQuery(const CPVREpgInfoTag& tag);
 
+  /*!
+   * @brief Apply the tag change log to the database, in order and in a single transaction.
+   *
+   * Unlike the insert and delete query queues, the log keeps the values of each change apart from
+   * its statement, so every kind of change is prepared once and only executed with new values.
+   * @return True on success, false otherwise. The log is cleared either way.
+   */
+  bool CommitTagChanges();
+
+  /*!
+   * @return The number of changes in the tag change log.
+   */
+  size_t GetTagChangesCount() const;
+
   /*!
    * @return Last EPG id in the database
    */
@@ -383,6 +411,34 @@ private:
   std::shared_ptr<CPVREpgSearchFilter> CreateEpgSearchFilter(bool bRadio,
                                                              dbiplus::Dataset& ds) const;
 
+  /*!
+   * @brief Mark the search index entries of an EPG outdated, m_critSection must be held.
+   * @param iEpgID The id of the EPG whose tags are changed or deleted.
+   */
+  void InvalidateSearchIndex(int iEpgID);
+
+  /*!
+   * @brief Drop the search index, m_critSection must be held.
+   */
+  void ClearSearchIndex();
+
+  /*!
+   * @brief Read the tags of outdated EPGs into the search index, m_critSection must be held.
+   * @return True if the index is enabled and up to date, false otherwise.
+   */
+  bool UpdateSearchIndex() const;
+
   mutable CCriticalSection m_critSection;
+
+  struct TagChange
+  {
+    const std::string* strQuery; ///< a prepared statement
+    dbiplus::BindParams params;
+  };
+  std::vector<TagChange> m_tagChanges;
+
+  mutable CPVREpgSearchIndex m_searchIndex;
+  mutable bool m_bSearchIndexBuilt{false};
+  mutable std::set<int> m_outdatedSearchIndexEpgs;
 };
 } // namespace PVR
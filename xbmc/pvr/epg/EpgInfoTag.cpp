@@ -172,21 +172,21 @@ void CPVREpgInfoTag::Serialize(CVariant& value) const
   value["broadcastid"] = m_iDatabaseID; // Use DB id here as it is unique across PVR clients
   value["channeluid"] = m_channelData->UniqueClientChannelId();
   value["parentalrating"] = m_parentalRating;
-  value["parentalratingcode"] = m_parentalRatingCode;
+  value["parentalratingcode"] = m_parentalRatingCode.Get();
   value["parentalratingicon"] = ClientParentalRatingIconPath();
-  value["parentalratingsource"] = m_parentalRatingSource;
+  value["parentalratingsource"] = m_parentalRatingSource.Get();
   value["rating"] = m_iStarRating;
-  value["title"] = m_strTitle;
-  value["titleextrainfo"] = m_titleExtraInfo;
+  value["title"] = m_strTitle.Get();
+  value["titleextrainfo"] = m_titleExtraInfo.Get();
   value["plotoutline"] = m_strPlotOutline;
   value["plot"] = m_strPlot;
-  value["originaltitle"] = m_strOriginalTitle;
+  value["originaltitle"] = m_strOriginalTitle.Get();
   value["thumbnail"] = ClientIconPath();
   value["cast"] = DeTokenize(m_cast);
   value["director"] = DeTokenize(m_directors);
   value["writer"] = DeTokenize(m_writers);
   value["year"] = m_iYear;
-  value["imdbnumber"] = m_strIMDBNumber;
+  value["imdbnumber"] = m_strIMDBNumber.Get();
   value["genre"] = Genre();
   value["filenameandpath"] = Path();
   value["starttime"] = m_startTime.IsValid() ? m_startTime.GetAsDBDateTime() : StringUtils::Empty;
@@ -195,7 +195,7 @@ void CPVREpgInfoTag::Serialize(CVariant& value) const
   value["firstaired"] = m_firstAired.IsValid() ? m_firstAired.GetAsDBDate() : StringUtils::Empty;
   value["progress"] = Progress();
   value["progresspercentage"] = ProgressPercentage();
-  value["episodename"] = m_strEpisodeName;
+  value["episodename"] = m_strEpisodeName.Get();
   value["episode"] = m_iEpisodeNumber;
   value["episodenum"] = m_iEpisodeNumber;
   value["episodepart"] = m_iEpisodePart;
@@ -204,7 +204,7 @@ void CPVREpgInfoTag::Serialize(CVariant& value) const
   value["isactive"] = IsActive();
   value["wasactive"] = WasActive();
   value["isseries"] = IsSeries();
-  value["serieslink"] = m_strSeriesLink;
+  value["serieslink"] = m_strSeriesLink.Get();
   value["clientid"] = m_channelData->ClientId();
 }
 
@@ -10,6 +10,7 @@
 
 #include "XBDateTime.h"
 #include "pvr/PVRCachedImage.h"
+#include "pvr/PVRSharedString.h"
 #include "threads/CriticalSection.h"
 #include "utils/ISerializable.h"
 
@@ -202,13 +203,13 @@ public:
    * @brief Get the title of this event.
    * @return The title.
    */
-  const std::string& Title() const { return m_strTitle; }
+  const std::string& Title() const { return m_strTitle.Get(); }
 
   /*!
   * @brief Get the title extra information of this event.
   * @return The title extra info.
   */
-  const std::string& TitleExtraInfo() const { return m_titleExtraInfo; }
+  const std::string& TitleExtraInfo() const { return m_titleExtraInfo.Get(); }
 
   /*!
    * @brief Get the plot outline of this event.
@@ -226,7 +227,7 @@ public:
    * @brief Get the original title of this event.
    * @return The original title.
    */
-  const std::string& OriginalTitle() const { return m_strOriginalTitle; }
+  const std::string& OriginalTitle() const { return m_strOriginalTitle.Get(); }
 
   /*!
    * @brief Get the cast of this event.
@@ -284,7 +285,7 @@ public:
    * @brief Get the imdbnumber of this event.
    * @return The imdbnumber.
    */
-  const std::string& IMDBNumber() const { return m_strIMDBNumber; }
+  const std::string& IMDBNumber() const { return m_strIMDBNumber.Get(); }
 
   /*!
    * @brief Get the genre type ID of this event.
@@ -302,7 +303,7 @@ public:
    * @brief Get the genre description of this event.
    * @return The genre.
    */
-  const std::string& GenreDescription() const { return m_strGenreDescription; }
+  const std::string& GenreDescription() const { return m_strGenreDescription.Get(); }
 
   /*!
    * @brief Get the genre as human readable string.
@@ -326,7 +327,7 @@ public:
    * @brief Get the parental rating code of this event.
    * @return The parental rating code.
    */
-  const std::string& ParentalRatingCode() const { return m_parentalRatingCode; }
+  const std::string& ParentalRatingCode() const { return m_parentalRatingCode.Get(); }
 
   /*!
    * @brief Get the parental rating icon path of this event.
@@ -344,7 +345,7 @@ public:
    * @brief Get the parental rating source of this event.
    * @return The parental rating source.
    */
-  const std::string& ParentalRatingSource() const { return m_parentalRatingSource; }
+  const std::string& ParentalRatingSource() const { return m_parentalRatingSource.Get(); }
   /*!
    * @brief Get the star rating of this event.
    * @return The star rating.
@@ -361,7 +362,7 @@ public:
    * @brief The series link for this event.
    * @return The series link or empty string, if not available.
    */
-  const std::string& SeriesLink() const { return m_strSeriesLink; }
+  const std::string& SeriesLink() const { return m_strSeriesLink.Get(); }
 
   /*!
    * @brief The episode number of this event.
@@ -379,7 +380,7 @@ public:
    * @brief The episode name of this event.
    * @return The episode name.
    */
-  const std::string& EpisodeName() const { return m_strEpisodeName; }
+  const std::string& EpisodeName() const { return m_strEpisodeName.Get(); }
 
   /*!
    * @brief Get the path to the icon for this event used by Kodi.
@@ -517,34 +518,35 @@ private:
   int m_iDatabaseID = -1; /*!< database ID */
   int m_iGenreType = 0; /*!< genre type */
   int m_iGenreSubType = 0; /*!< genre subtype */
-  std::string m_strGenreDescription; /*!< genre description */
+  CPVRSharedString m_strGenreDescription; /*!< genre description */
   unsigned int m_parentalRating = 0; /*!< parental rating */
-  std::string m_parentalRatingCode; /*!< Parental rating code */
+  CPVRSharedString m_parentalRatingCode; /*!< Parental rating code */
   CPVRCachedImage m_parentalRatingIcon; /*!< parental rating icon path */
-  std::string m_parentalRatingSource; /*!< parental rating source */
+  CPVRSharedString m_parentalRatingSource; /*!< parental rating source */
   int m_iStarRating = 0; /*!< star rating */
   int m_iSeriesNumber = -1; /*!< series number */
   int m_iEpisodeNumber = -1; /*!< episode number */
   int m_iEpisodePart = -1; /*!< episode part number */
   unsigned int m_iUniqueBroadcastID = 0; /*!< unique broadcast ID */
-  std::string m_strTitle; /*!< title */
-  std::string m_titleExtraInfo; /*!< title extra info */
+  CPVRSharedString m_strTitle; /*!< title */
+  CPVRSharedString m_titleExtraInfo; /*!< title extra info */
+  // plots are hardly ever shared, pooling them would cost more than it saves
   std::string m_strPlotOutline; /*!< plot outline */
   std::string m_strPlot; /*!< plot */
-  std::string m_strOriginalTitle; /*!< original title */
+  CPVRSharedString m_strOriginalTitle; /*!< original title */
   std::vector<std::string> m_cast; /*!< cast */
   std::vector<std::string> m_directors; /*!< director(s) */
   std::vector<std::string> m_writers; /*!< writer(s) */
   int m_iYear = 0; /*!< year */
-  std::string m_strIMDBNumber; /*!< imdb number */
+  CPVRSharedString m_strIMDBNumber; /*!< imdb number */
   mutable std::vector<std::string> m_genre; /*!< genre */
-  std::string m_strEpisodeName; /*!< episode name */
+  CPVRSharedString m_strEpisodeName; /*!< episode name */
   CPVRCachedImage m_iconPath; /*!< the path to the icon */
   CDateTime m_startTime; /*!< event start time */
   CDateTime m_endTime; /*!< event end time */
   CDateTime m_firstAired; /*!< first airdate */
   unsigned int m_iFlags = 0; /*!< the flags applicable to this EPG entry */
-  std::string m_strSeriesLink; /*!< series link */
+  CPVRSharedString m_strSeriesLink; /*!< series link */
   bool m_bIsGapTag = false;
 
   mutable CCriticalSection m_critSection;
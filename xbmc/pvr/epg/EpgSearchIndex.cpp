@@ -0,0 +1,232 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "EpgSearchIndex.h"
+
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+using namespace PVR;
+
+namespace
+{
+constexpr uint32_t REMOVED_SLOT = std::numeric_limits<uint32_t>::max();
+
+bool IsWordChar(char c)
+{
+  return StringUtils::isasciialphanum(c) || static_cast<unsigned char>(c) >= 0x80;
+}
+
+template<typename F>
+void ForEachWord(std::string_view strText, F&& function)
+{
+  std::string word;
+  for (const char c : strText)
+  {
+    if (IsWordChar(c))
+    {
+      word.push_back(StringUtils::ToLowerAscii(c));
+    }
+    else if (!word.empty())
+    {
+      function(word);
+      word.clear();
+    }
+  }
+  if (!word.empty())
+    function(word);
+}
+} // unnamed namespace
+
+std::vector<std::string> CPVREpgSearchIndex::GetWords(std::string_view strText)
+{
+  std::vector<std::string> words;
+  ForEachWord(strText, [&words](const std::string& word) { words.emplace_back(word); });
+  return words;
+}
+
+void CPVREpgSearchIndex::Add(const Entry& entry)
+{
+  const uint32_t slot = static_cast<uint32_t>(m_slots.size());
+  m_slots.emplace_back(Slot{entry.iBroadcastId, entry.iEpgId});
+  m_epgSlots[entry.iEpgId].emplace_back(slot);
+
+  std::vector<std::pair<uint32_t, unsigned int>> words;
+  const auto addWords = [this, &words](const std::string& strText, Field field)
+  {
+    ForEachWord(strText,
+                [&](const std::string& word) { words.emplace_back(GetWordId(word), field); });
+  };
+  addWords(entry.strTitle, FIELD_TITLE);
+  addWords(entry.strPlotOutline, FIELD_PLOT_OUTLINE);
+  addWords(entry.strPlot, FIELD_PLOT);
+  addWords(entry.strEpisodeName, FIELD_EPISODE_NAME);
+
+  // one posting per word and tag, with all fields the word appears in
+  std::ranges::sort(words);
+  for (auto it = words.cbegin(); it != words.cend();)
+  {
+    const uint32_t wordId = it->first;
+    unsigned int fields = 0;
+    for (; it != words.cend() && it->first == wordId; ++it)
+      fields |= it->second;
+
+    m_postings[wordId].emplace_back(slot << FIELD_BITS | fields);
+  }
+}
+
+void CPVREpgSearchIndex::Remove(int iEpgId)
+{
+  const auto it = m_epgSlots.find(iEpgId);
+  if (it == m_epgSlots.end())
+    return;
+
+  for (const uint32_t slot : it->second)
+    m_slots[slot].iEpgId = -1;
+
+  m_iRemovedSlots += it->second.size();
+  m_epgSlots.erase(it);
+
+  if (m_iRemovedSlots > m_slots.size() / 2)
+    Compact();
+}
+
+void CPVREpgSearchIndex::Clear()
+{
+  m_words.clear();
+  m_wordIds.clear();
+  m_postings.clear();
+  m_slots.clear();
+  m_epgSlots.clear();
+  m_iRemovedSlots = 0;
+}
+
+std::optional<std::vector<int>> CPVREpgSearchIndex::Find(std::string_view strText,
+                                                         unsigned int fields) const
+{
+  std::vector<std::string> words{GetWords(strText)};
+  if (words.empty())
+    return {};
+
+  // longer words match fewer tags, look them up first
+  std::ranges::sort(words);
+  const auto [first, last] = std::ranges::unique(words);
+  words.erase(first, last);
+  std::ranges::stable_sort(words, std::ranges::greater{}, &std::string::size);
+
+  std::vector<uint32_t> candidates;
+  for (auto word = words.cbegin(); word != words.cend(); ++word)
+  {
+    std::vector<uint32_t> matches;
+    uint32_t wordId = 0;
+    for (const std::string& indexed : m_words)
+    {
+      if (indexed.find(*word) != std::string::npos)
+      {
+        for (const uint32_t posting : m_postings[wordId])
+        {
+          if (posting & fields)
+            matches.emplace_back(posting >> FIELD_BITS);
+        }
+      }
+      ++wordId;
+    }
+
+    std::ranges::sort(matches);
+    matches.erase(std::ranges::unique(matches).begin(), matches.end());
+
+    if (word == words.cbegin())
+    {
+      candidates = std::move(matches);
+    }
+    else
+    {
+      std::vector<uint32_t> both;
+      std::ranges::set_intersection(candidates, matches, std::back_inserter(both));
+      candidates = std::move(both);
+    }
+
+    if (candidates.empty())
+      break;
+  }
+
+  std::vector<int> ids;
+  ids.reserve(candidates.size());
+  for (const uint32_t slot : candidates)
+  {
+    if (m_slots[slot].iEpgId >= 0)
+      ids.emplace_back(m_slots[slot].iBroadcastId);
+  }
+  std::ranges::sort(ids);
+  return ids;
+}
+
+uint32_t CPVREpgSearchIndex::GetWordId(const std::string& strWord)
+{
+  const auto it = m_wordIds.find(strWord);
+  if (it != m_wordIds.end())
+    return it->second;
+
+  const uint32_t wordId = static_cast<uint32_t>(m_words.size());
+  m_wordIds.try_emplace(m_words.emplace_back(strWord), wordId);
+  m_postings.emplace_back();
+  return wordId;
+}
+
+void CPVREpgSearchIndex::Compact()
+{
+  std::vector<uint32_t> newSlots(m_slots.size(), REMOVED_SLOT);
+  std::vector<Slot> slots;
+  slots.reserve(m_slots.size() - m_iRemovedSlots);
+  for (size_t i = 0; i < m_slots.size(); ++i)
+  {
+    if (m_slots[i].iEpgId >= 0)
+    {
+      newSlots[i] = static_cast<uint32_t>(slots.size());
+      slots.emplace_back(m_slots[i]);
+    }
+  }
+
+  // renumber the slots in the postings and drop the words no tag uses anymore
+  std::deque<std::string> words;
+  std::unordered_map<std::string_view, uint32_t> wordIds;
+  std::vector<std::vector<uint32_t>> postings;
+  for (size_t wordId = 0; wordId < m_postings.size(); ++wordId)
+  {
+    std::vector<uint32_t> wordPostings;
+    for (const uint32_t posting : m_postings[wordId])
+    {
+      const uint32_t slot = newSlots[posting >> FIELD_BITS];
+      if (slot != REMOVED_SLOT)
+        wordPostings.emplace_back(slot << FIELD_BITS | (posting & FIELD_ALL));
+    }
+
+    if (!wordPostings.empty())
+    {
+      wordIds.try_emplace(words.emplace_back(std::move(m_words[wordId])),
+                          static_cast<uint32_t>(postings.size()));
+      postings.emplace_back(std::move(wordPostings));
+    }
+  }
+
+  for (auto& [_, epgSlots] : m_epgSlots)
+  {
+    for (uint32_t& slot : epgSlots)
+      slot = newSlots[slot];
+  }
+
+  m_words = std::move(words);
+  m_wordIds = std::move(wordIds);
+  m_postings = std::move(postings);
+  m_slots = std::move(slots);
+  m_iRemovedSlots = 0;
+}
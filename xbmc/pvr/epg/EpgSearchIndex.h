@@ -0,0 +1,116 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace PVR
+{
+/*!
+ * @brief In-memory word index over the text fields of the EPG tags in the database.
+ *
+ * Words are runs of ASCII letters and digits and of non-ASCII bytes, compared case-insensitively
+ * for ASCII only, like SQLite's LIKE. A text is found in every tag with a word containing each
+ * of the words of the text, which is a superset of the tags containing the text itself. Callers
+ * verify the candidates, e.g. by still applying the LIKE terms to them in SQL.
+ *
+ * Tags are added and removed per EPG, removed tags are only dropped from the postings once they
+ * make up half of the index.
+ *
+ * Not thread safe, the owner serializes access.
+ */
+class CPVREpgSearchIndex
+{
+public:
+  enum Field : unsigned int
+  {
+    FIELD_TITLE = 0x1,
+    FIELD_PLOT_OUTLINE = 0x2,
+    FIELD_PLOT = 0x4,
+    FIELD_EPISODE_NAME = 0x8,
+    FIELD_ALL = 0xF,
+  };
+
+  struct Entry
+  {
+    int iBroadcastId{-1};
+    int iEpgId{-1};
+    std::string strTitle;
+    std::string strPlotOutline;
+    std::string strPlot;
+    std::string strEpisodeName;
+  };
+
+  /*!
+   * @brief Add a tag to the index.
+   * @param entry The tag.
+   */
+  void Add(const Entry& entry);
+
+  /*!
+   * @brief Remove all tags of an EPG from the index.
+   * @param iEpgId The id of the EPG.
+   */
+  void Remove(int iEpgId);
+
+  /*!
+   * @brief Remove all tags from the index.
+   */
+  void Clear();
+
+  /*!
+   * @brief Get the tags that may contain a text in the given fields.
+   * @param strText The text.
+   * @param fields The fields to search, a combination of Field values.
+   * @return The database ids of the candidate tags in ascending order, or std::nullopt if the
+   * text has no words to look up.
+   */
+  std::optional<std::vector<int>> Find(std::string_view strText, unsigned int fields) const;
+
+  /*!
+   * @brief Get the number of tags in the index.
+   */
+  size_t Size() const { return m_slots.size() - m_iRemovedSlots; }
+
+  /*!
+   * @brief Split a text into the words the index is made of, folded to lower case.
+   * @param strText The text.
+   * @return The words, in order of appearance.
+   */
+  static std::vector<std::string> GetWords(std::string_view strText);
+
+private:
+  struct Slot
+  {
+    int iBroadcastId;
+    int iEpgId; ///< -1 once removed
+  };
+
+  // a posting is a slot index in the upper bits and the fields the word appears in in the lower
+  static constexpr unsigned int FIELD_BITS = 4;
+
+  uint32_t GetWordId(const std::string& strWord);
+  void Compact();
+
+  std::deque<std::string> m_words; // stable addresses for the string_view keys
+  std::unordered_map<std::string_view, uint32_t> m_wordIds;
+  std::vector<std::vector<uint32_t>> m_postings; // per word id
+
+  std::vector<Slot> m_slots;
+  std::unordered_map<int, std::vector<uint32_t>> m_epgSlots;
+  size_t m_iRemovedSlots{0};
+};
+
+} // namespace PVR
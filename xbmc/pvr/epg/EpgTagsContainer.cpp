@@ -147,9 +147,11 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
     if (!m_changedTags.empty())
     {
       // Fix data inconsistencies
-      for (const auto& [_, tag] : m_changedTags)
+      for (auto it = GetFirstChangedTagEndingAfter(minEventEnd);
+           it != m_changedTags.cend() && (*it).first < maxEventStart; ++it)
       {
-        if (tag->EndAsUTC() > minEventEnd && tag->StartAsUTC() < maxEventStart)
+        const std::shared_ptr<CPVREpgInfoTag>& tag = (*it).second;
+        if (tag->EndAsUTC() > minEventEnd)
         {
           // tag is in queried range, thus it could cause inconsistencies...
           ResolveConflictingTags(tag, existingTags);
@@ -163,10 +165,11 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
       tag->SetChannelData(m_channelData);
       tag->SetEpgID(m_iEpgID);
 
-      const auto it = std::ranges::find_if(existingTags, [&tag](const auto& t)
-                                           { return t->StartAsUTC() == tag->StartAsUTC(); });
+      // the existing tags are ordered by start time
+      const auto it = std::ranges::lower_bound(existingTags, tag->StartAsUTC(), {},
+                                               [](const auto& t) { return t->StartAsUTC(); });
 
-      if (it != existingTags.cend())
+      if (it != existingTags.cend() && (*it)->StartAsUTC() == tag->StartAsUTC())
       {
         const std::shared_ptr<CPVREpgInfoTag>& existingTag = *it;
 
@@ -176,14 +179,14 @@ bool CPVREpgTagsContainer::UpdateEntries(const CPVREpgTagsContainer& tags)
         if (existingTag->Update(*tag, false))
         {
           // tag differs from existing tag and must be persisted
-          m_changedTags.try_emplace(existingTag->StartAsUTC(), existingTag);
+          AddChangedTag(existingTag);
           bResetCache = true;
         }
       }
       else
       {
         // new tags must always be persisted
-        m_changedTags.try_emplace(tag->StartAsUTC(), tag);
+        AddChangedTag(tag);
         bResetCache = true;
       }
     }
@@ -276,20 +279,37 @@ bool CPVREpgTagsContainer::UpdateEntry(const std::shared_ptr<CPVREpgInfoTag>& ta
     if (existingTag->Update(*tag, false))
     {
       // tag differs from existing tag and must be persisted
-      m_changedTags.try_emplace(existingTag->StartAsUTC(), existingTag);
+      AddChangedTag(existingTag);
       m_tagsCache->Reset();
     }
   }
   else
   {
     // new tags must always be persisted
-    m_changedTags.try_emplace(tag->StartAsUTC(), tag);
+    AddChangedTag(tag);
     m_tagsCache->Reset();
   }
 
   return true;
 }
 
+void CPVREpgTagsContainer::AddChangedTag(const std::shared_ptr<CPVREpgInfoTag>& tag)
+{
+  m_changedTags.try_emplace(tag->StartAsUTC(), tag);
+
+  // tags in the map may have been updated, so check the given one even if it was not added
+  const CDateTimeSpan duration = tag->EndAsUTC() - tag->StartAsUTC();
+  if (duration > m_changedTagsMaxDuration)
+    m_changedTagsMaxDuration = duration;
+}
+
+std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>::const_iterator CPVREpgTagsContainer::
+    GetFirstChangedTagEndingAfter(const CDateTime& time) const
+{
+  // no changed tag is longer than m_changedTagsMaxDuration, so none starting before this ends later
+  return m_changedTags.lower_bound(time - m_changedTagsMaxDuration);
+}
+
 bool CPVREpgTagsContainer::DeleteEntry(const std::shared_ptr<CPVREpgInfoTag>& tag)
 {
   m_changedTags.erase(tag->StartAsUTC());
@@ -324,6 +344,7 @@ void CPVREpgTagsContainer::Cleanup(const CDateTime& time)
 void CPVREpgTagsContainer::Clear()
 {
   m_changedTags.clear();
+  m_changedTagsMaxDuration = CDateTimeSpan();
   m_tagsCache->Reset();
 }
 
@@ -388,16 +409,9 @@ std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTagByDatabaseID(int iDa
 std::shared_ptr<CPVREpgInfoTag> CPVREpgTagsContainer::GetTagBetween(const CDateTime& start,
                                                                     const CDateTime& end) const
 {
-  for (const auto& [_, tag] : m_changedTags)
-  {
-    if (tag->StartAsUTC() >= start)
-    {
-      if (tag->EndAsUTC() <= end)
-        return tag;
-      else
-        break;
-    }
-  }
+  const auto it = m_changedTags.lower_bound(start);
+  if (it != m_changedTags.cend() && (*it).second->EndAsUTC() <= end)
+    return (*it).second;
 
   if (m_database)
   {
@@ -445,10 +459,11 @@ void CPVREpgTagsContainer::MergeTags(const CDateTime& minEventEnd,
                                      const CDateTime& maxEventStart,
                                      std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const
 {
-  for (const auto& [_, tag] : m_changedTags)
+  for (auto it = GetFirstChangedTagEndingAfter(minEventEnd);
+       it != m_changedTags.cend() && (*it).first < maxEventStart; ++it)
   {
-    if (tag->EndAsUTC() > minEventEnd && tag->StartAsUTC() < maxEventStart)
-      tags.emplace_back(tag);
+    if ((*it).second->EndAsUTC() > minEventEnd)
+      tags.emplace_back((*it).second);
   }
 
   if (!tags.empty())
@@ -484,9 +499,11 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (!m_changedTags.empty())
       {
         // Fix data inconsistencies
-        for (const auto& [_, tag] : m_changedTags)
+        for (auto it = GetFirstChangedTagEndingAfter(minEventEnd);
+             it != m_changedTags.cend() && (*it).first < maxEventStart; ++it)
         {
-          if (tag->EndAsUTC() > minEventEnd && tag->StartAsUTC() < maxEventStart)
+          const std::shared_ptr<CPVREpgInfoTag>& tag = (*it).second;
+          if (tag->EndAsUTC() > minEventEnd)
           {
             // tag is in queried range, thus it could cause inconsistencies...
             ResolveConflictingTags(tag, tags);
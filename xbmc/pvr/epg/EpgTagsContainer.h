@@ -208,6 +208,20 @@ private:
                  const CDateTime& maxEventStart,
                  std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const;
 
+  /*!
+   * @brief Add a tag to m_changedTags, unless it contains a tag with the same start time already.
+   * @param tag The tag.
+   */
+  void AddChangedTag(const std::shared_ptr<CPVREpgInfoTag>& tag);
+
+  /*!
+   * @brief Get the first of m_changedTags that may end after the given time.
+   * @param time The time.
+   * @return The iterator, tags before it end at or before the given time.
+   */
+  std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>::const_iterator GetFirstChangedTagEndingAfter(
+      const CDateTime& time) const;
+
   /*!
    * @brief Fix overlapping events.
    * @param tags The events to check/fix.
@@ -222,6 +236,7 @@ private:
 
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_changedTags;
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_deletedTags;
+  CDateTimeSpan m_changedTagsMaxDuration; // bounds the lookup of m_changedTags by end time
 };
 
 } // namespace PVR
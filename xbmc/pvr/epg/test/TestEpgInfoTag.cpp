@@ -0,0 +1,193 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_epg.h"
+#include "pvr/PVRSharedString.h"
+#include "pvr/epg/EpgChannelData.h"
+#include "pvr/epg/EpgInfoTag.h"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+constexpr int CLIENT_ID = 1;
+
+struct Programme
+{
+  std::string strTitle;
+  std::string strPlot;
+  std::string strEpisodeName;
+  std::string strGenre;
+  std::string strSeriesLink;
+  std::string strIconPath;
+  std::string strParentalRatingCode;
+};
+
+std::shared_ptr<CPVREpgInfoTag> CreateTag(int iEpgID, time_t start, const Programme& programme)
+{
+  const auto channelData = std::make_shared<CPVREpgChannelData>(CLIENT_ID, iEpgID);
+
+  EPG_TAG data{};
+  data.iUniqueBroadcastId = static_cast<unsigned int>(start / 60);
+  data.iUniqueChannelId = iEpgID;
+  data.strTitle = programme.strTitle.c_str();
+  data.strPlot = programme.strPlot.c_str();
+  data.strEpisodeName = programme.strEpisodeName.c_str();
+  data.strGenreDescription = programme.strGenre.c_str();
+  data.strSeriesLink = programme.strSeriesLink.c_str();
+  data.strIconPath = programme.strIconPath.c_str();
+  data.strParentalRatingCode = programme.strParentalRatingCode.c_str();
+  data.startTime = start;
+  data.endTime = start + 1800;
+  return std::make_shared<CPVREpgInfoTag>(data, CLIENT_ID, channelData, iEpgID);
+}
+
+// the texts of a tag stored in the pool
+constexpr size_t SHARED_TEXTS = 10;
+
+std::array<std::string, SHARED_TEXTS> GetSharedTexts(const CPVREpgInfoTag& tag)
+{
+  return {tag.Title(),      tag.TitleExtraInfo(),     tag.OriginalTitle(),  tag.IMDBNumber(),
+          tag.EpisodeName(), tag.GenreDescription(), tag.SeriesLink(),     tag.ParentalRatingCode(),
+          tag.ClientIconPath(), tag.IconPath()};
+}
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#define HAVE_HEAP_USAGE
+size_t GetHeapUsage()
+{
+  return mallinfo2().uordblks;
+}
+#endif
+} // namespace
+
+TEST(TestEpgInfoTag, SharesStrings)
+{
+  const Programme news{"News", "The news of the day.", "", "News/Current Affairs", "", "", ""};
+  const auto tag1 = CreateTag(1, 1790000000, news);
+  const auto tag2 = CreateTag(2, 1790000000, news);
+
+  EXPECT_EQ(&tag1->Title(), &tag2->Title());
+  EXPECT_EQ(&tag1->GenreDescription(), &tag2->GenreDescription());
+
+  // plots are rarely shared, they aren't pooled
+  EXPECT_NE(&tag1->Plot(), &tag2->Plot());
+  EXPECT_EQ("The news of the day.", tag2->Plot());
+
+  const size_t poolSize = CPVRSharedString::GetPoolSize();
+  {
+    CPVRSharedString text("A text no tag has");
+    EXPECT_EQ(poolSize + 1, CPVRSharedString::GetPoolSize());
+    EXPECT_EQ(CPVRSharedString("A text no tag has"), text);
+    EXPECT_EQ(poolSize + 1, CPVRSharedString::GetPoolSize());
+
+    text = tag1->Title();
+    EXPECT_EQ(poolSize, CPVRSharedString::GetPoolSize());
+    EXPECT_EQ(&tag1->Title(), &text.Get());
+  }
+  EXPECT_EQ(poolSize, CPVRSharedString::GetPoolSize());
+
+  // empty strings are not pooled
+  EXPECT_TRUE(CPVRSharedString("").empty());
+  EXPECT_EQ(CPVRSharedString(), CPVRSharedString(""));
+}
+
+/*!
+ Creates 10000 tags of a generated guide, 250 half hour programmes on each of 40 channels, with
+ 400 series of 8 episodes each, and measures the heap memory they use. The texts the tags keep in
+ the pool are then held once as plain copies, as the tags did before, and once pooled, to compare
+ the bytes each takes including the allocations of the pool itself.
+ */
+TEST(TestEpgInfoTag, DISABLED_HeapBytesPer10kTags)
+{
+#if !defined(HAVE_HEAP_USAGE)
+  GTEST_SKIP() << "needs the heap statistics of glibc";
+#else
+  constexpr int CHANNELS = 40;
+  constexpr int TAGS_PER_CHANNEL = 250;
+  constexpr int SERIES = 400;
+  constexpr int EPISODES = 8;
+
+  static const char* const GENRES[] = {"Movie/Drama", "News/Current Affairs", "Show/Game show",
+                                       "Sports", "Children's/Youth programmes",
+                                       "Music/Ballet/Dance", "Documentary"};
+
+  std::vector<Programme> programmes;
+  for (int series = 0; series < SERIES; ++series)
+  {
+    for (int episode = 0; episode < EPISODES; ++episode)
+    {
+      Programme programme;
+      programme.strTitle = "Series title number " + std::to_string(series);
+      programme.strPlot = "The plot of episode " + std::to_string(episode) + " of series " +
+                          std::to_string(series) +
+                          ", which is a few sentences long. It tells about the people in the "
+                          "episode and what happens to them, without giving the end away.";
+      programme.strEpisodeName = "Episode " + std::to_string(episode);
+      programme.strGenre = GENRES[series % std::size(GENRES)];
+      programme.strSeriesLink = "crid://broadcaster.example/series/" + std::to_string(series);
+      programme.strIconPath =
+          "https://images.broadcaster.example/series/" + std::to_string(series) + "/poster.jpg";
+      programme.strParentalRatingCode = series % 3 == 0 ? "FSK 12" : "FSK 6";
+      programmes.emplace_back(std::move(programme));
+    }
+  }
+
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+  tags.reserve(CHANNELS * TAGS_PER_CHANNEL);
+  size_t heapUsage = GetHeapUsage();
+  for (int channel = 1; channel <= CHANNELS; ++channel)
+  {
+    for (int i = 0; i < TAGS_PER_CHANNEL; ++i)
+    {
+      const Programme& programme = programmes[(channel * 131 + i * 17) % programmes.size()];
+      tags.emplace_back(CreateTag(channel, 1790000000 + i * 1800, programme));
+    }
+  }
+  const size_t tagsBytes = GetHeapUsage() - heapUsage;
+
+  std::vector<std::array<std::string, SHARED_TEXTS>> copies;
+  copies.reserve(tags.size());
+  heapUsage = GetHeapUsage();
+  for (const auto& tag : tags)
+    copies.emplace_back(GetSharedTexts(*tag));
+  const size_t copiedBytes = GetHeapUsage() - heapUsage;
+
+  // nothing else refers to the pooled texts once the tags are gone
+  tags.clear();
+  std::vector<std::array<CPVRSharedString, SHARED_TEXTS>> shared;
+  shared.reserve(copies.size());
+  heapUsage = GetHeapUsage();
+  for (const auto& texts : copies)
+  {
+    auto& pooled = shared.emplace_back();
+    for (size_t i = 0; i < SHARED_TEXTS; ++i)
+      pooled[i] = texts[i];
+  }
+  const size_t sharedBytes = GetHeapUsage() - heapUsage;
+
+  EXPECT_LT(sharedBytes, copiedBytes);
+
+  RecordProperty("Tags", static_cast<int>(copies.size()));
+  RecordProperty("TagSize", static_cast<int>(sizeof(CPVREpgInfoTag)));
+  RecordProperty("TagsHeapBytes", std::to_string(tagsBytes));
+  RecordProperty("CopiedTextsHeapBytes", std::to_string(copiedBytes));
+  RecordProperty("SharedTextsHeapBytes", std::to_string(sharedBytes));
+#endif
+}
@@ -0,0 +1,225 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "pvr/epg/EpgSearchIndex.h"
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace PVR;
+
+namespace
+{
+CPVREpgSearchIndex::Entry CreateEntry(int iBroadcastId,
+                                      int iEpgId,
+                                      const std::string& strTitle,
+                                      const std::string& strPlot = "",
+                                      const std::string& strEpisodeName = "")
+{
+  CPVREpgSearchIndex::Entry entry;
+  entry.iBroadcastId = iBroadcastId;
+  entry.iEpgId = iEpgId;
+  entry.strTitle = strTitle;
+  entry.strPlot = strPlot;
+  entry.strEpisodeName = strEpisodeName;
+  return entry;
+}
+
+// what the LIKE terms of an EPG search match, case-insensitive for ASCII only
+bool Contains(const std::string& strText, const std::string& strTerm)
+{
+  const auto equal = [](char c1, char c2)
+  { return StringUtils::ToLowerAscii(c1) == StringUtils::ToLowerAscii(c2); };
+  return !std::ranges::search(strText, strTerm, equal).empty();
+}
+
+bool Contains(const CPVREpgSearchIndex::Entry& entry, const std::string& strTerm)
+{
+  return Contains(entry.strTitle, strTerm) || Contains(entry.strPlotOutline, strTerm) ||
+         Contains(entry.strPlot, strTerm);
+}
+} // namespace
+
+TEST(TestEpgSearchIndex, GetWords)
+{
+  EXPECT_EQ(std::vector<std::string>({"star", "trek", "the", "next", "generation", "s01e02"}),
+            CPVREpgSearchIndex::GetWords("Star Trek: The Next-Generation (S01E02)"));
+  // non-ASCII characters are part of words, but not folded
+  EXPECT_EQ(std::vector<std::string>({"caf\xC3\x89", "m\xC3\xBCller"}),
+            CPVREpgSearchIndex::GetWords("CAF\xC3\x89 M\xC3\xBCller"));
+  EXPECT_TRUE(CPVREpgSearchIndex::GetWords(" %_- ").empty());
+}
+
+TEST(TestEpgSearchIndex, FindsSubstringsOfWords)
+{
+  CPVREpgSearchIndex index;
+  index.Add(CreateEntry(1, 1, "Batman Begins"));
+  index.Add(CreateEntry(2, 1, "Superman"));
+  index.Add(CreateEntry(3, 2, "The Manchurian Candidate"));
+  index.Add(CreateEntry(4, 2, "News"));
+  EXPECT_EQ(4u, index.Size());
+
+  const unsigned int fields = CPVREpgSearchIndex::FIELD_ALL;
+  EXPECT_EQ(std::vector<int>({1, 2, 3}), index.Find("MAN", fields));
+  EXPECT_EQ(std::vector<int>({1}), index.Find("atman b", fields));
+  EXPECT_EQ(std::vector<int>({3}), index.Find("the%candi", fields));
+  EXPECT_EQ(std::vector<int>(), index.Find("weather", fields));
+  EXPECT_EQ(std::nullopt, index.Find("%", fields));
+}
+
+TEST(TestEpgSearchIndex, FindsInFields)
+{
+  CPVREpgSearchIndex index;
+  index.Add(CreateEntry(1, 1, "Columbo", "A murder in the studio", "Murder by the Book"));
+  index.Add(CreateEntry(2, 1, "Murder, She Wrote"));
+
+  EXPECT_EQ(std::vector<int>({2}), index.Find("murder", CPVREpgSearchIndex::FIELD_TITLE));
+  EXPECT_EQ(std::vector<int>({1, 2}),
+            index.Find("murder", CPVREpgSearchIndex::FIELD_TITLE | CPVREpgSearchIndex::FIELD_PLOT));
+  EXPECT_EQ(std::vector<int>({1}), index.Find("book", CPVREpgSearchIndex::FIELD_EPISODE_NAME));
+  EXPECT_EQ(std::vector<int>(), index.Find("studio", CPVREpgSearchIndex::FIELD_PLOT_OUTLINE));
+}
+
+TEST(TestEpgSearchIndex, RemovesEpgs)
+{
+  CPVREpgSearchIndex index;
+  for (int i = 0; i < 100; ++i)
+    index.Add(CreateEntry(i, i % 4, "Episode " + std::to_string(i)));
+
+  index.Remove(1);
+  EXPECT_EQ(75u, index.Size());
+  EXPECT_EQ(std::vector<int>({7, 27, 47, 67, 70, 71, 72, 74, 75, 76, 78, 79, 87}),
+            index.Find("episode 7", CPVREpgSearchIndex::FIELD_TITLE));
+
+  // removing more than half of the tags compacts the index, the ids have to survive that
+  index.Remove(2);
+  index.Remove(3);
+  index.Add(CreateEntry(1000, 1, "Episode 1000"));
+  EXPECT_EQ(26u, index.Size());
+  EXPECT_EQ(std::vector<int>({72, 76}), index.Find("episode 7", CPVREpgSearchIndex::FIELD_TITLE));
+  EXPECT_EQ(std::vector<int>({0, 20, 40, 60, 80, 1000}),
+            index.Find("0", CPVREpgSearchIndex::FIELD_TITLE));
+
+  index.Clear();
+  EXPECT_EQ(0u, index.Size());
+  EXPECT_EQ(std::vector<int>(), index.Find("episode", CPVREpgSearchIndex::FIELD_TITLE));
+}
+
+/*!
+ Searches a generated guide of 800 channels with 14 days of programmes, like an EPG search with
+ "search in description" does, once by scanning all tags the way the LIKE terms do and once
+ through the index.
+ */
+TEST(TestEpgSearchIndex, DISABLED_SearchGeneratedGuide)
+{
+  constexpr int CHANNELS = 800;
+  constexpr int TAGS_PER_CHANNEL = 14 * 20;
+
+  std::mt19937 generator(42);
+  const auto createWord = [&generator]()
+  {
+    static const char* const SYLLABLES[] = {"ka", "lo", "mi", "ne", "ru", "sa", "ti", "vo",
+                                            "bel", "dor", "fen", "gar", "hol", "jun", "kel", "mar"};
+    std::uniform_int_distribution<int> syllable(0, 15);
+    std::uniform_int_distribution<int> length(2, 4);
+    std::string word;
+    for (int i = length(generator); i > 0; --i)
+      word += SYLLABLES[syllable(generator)];
+    return word;
+  };
+
+  std::vector<std::string> vocabulary(20000);
+  for (std::string& word : vocabulary)
+    word = createWord();
+  std::vector<std::string> titles(3000);
+  for (std::string& title : titles)
+  {
+    title = vocabulary[generator() % 2000];
+    title[0] = static_cast<char>(std::toupper(title[0]));
+    for (unsigned int words = generator() % 3; words > 0; --words)
+      title += " " + vocabulary[generator() % 2000];
+  }
+
+  // word frequencies in plots fall off like in natural language
+  std::discrete_distribution<size_t> plotWord(
+      vocabulary.size(), 0.0, static_cast<double>(vocabulary.size()),
+      [](double rank) { return 1.0 / (rank + 1.0); });
+  const auto createText = [&](int words)
+  {
+    std::string text;
+    for (int i = 0; i < words; ++i)
+      text += vocabulary[plotWord(generator)] + (i % 8 == 7 ? ". " : " ");
+    return text;
+  };
+
+  std::vector<CPVREpgSearchIndex::Entry> guide;
+  guide.reserve(CHANNELS * TAGS_PER_CHANNEL);
+  for (int channel = 1; channel <= CHANNELS; ++channel)
+  {
+    for (int tag = 0; tag < TAGS_PER_CHANNEL; ++tag)
+    {
+      CPVREpgSearchIndex::Entry entry = CreateEntry(static_cast<int>(guide.size()) + 1, channel,
+                                                    titles[generator() % titles.size()],
+                                                    createText(30), createText(3));
+      entry.strPlotOutline = createText(8);
+      guide.emplace_back(std::move(entry));
+    }
+  }
+
+  CPVREpgSearchIndex index;
+  auto start = std::chrono::steady_clock::now();
+  for (const CPVREpgSearchIndex::Entry& entry : guide)
+    index.Add(entry);
+  const std::chrono::duration<double, std::milli> buildTime =
+      std::chrono::steady_clock::now() - start;
+  ASSERT_EQ(guide.size(), index.Size());
+
+  // a rare word, a part of a title, a two word title and a frequent short word part
+  const std::vector<std::string> searches = {vocabulary[15000], vocabulary[1000].substr(1, 4),
+                                             titles[7].substr(0, titles[7].find(' ', 4)),
+                                             vocabulary[0].substr(0, 3)};
+  const unsigned int fields = CPVREpgSearchIndex::FIELD_TITLE |
+                              CPVREpgSearchIndex::FIELD_PLOT_OUTLINE |
+                              CPVREpgSearchIndex::FIELD_PLOT;
+
+  std::chrono::duration<double, std::milli> scanTime{0};
+  std::chrono::duration<double, std::milli> indexTime{0};
+  for (const std::string& search : searches)
+  {
+    start = std::chrono::steady_clock::now();
+    std::vector<int> expected;
+    for (const CPVREpgSearchIndex::Entry& entry : guide)
+    {
+      if (Contains(entry, search))
+        expected.emplace_back(entry.iBroadcastId);
+    }
+    scanTime += std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    const std::optional<std::vector<int>> candidates = index.Find(search, fields);
+    indexTime += std::chrono::steady_clock::now() - start;
+
+    ASSERT_TRUE(candidates.has_value()) << search;
+    EXPECT_TRUE(std::ranges::includes(*candidates, expected)) << search;
+    if (search.find(' ') == std::string::npos)
+      EXPECT_EQ(expected, *candidates) << search;
+  }
+
+  RecordProperty("Tags", static_cast<int>(guide.size()));
+  RecordProperty("IndexBuildMs", std::to_string(buildTime.count()));
+  RecordProperty("ScanMsPerSearch", std::to_string(scanTime.count() / searches.size()));
+  RecordProperty("IndexMsPerSearch", std::to_string(indexTime.count() / searches.size()));
+}
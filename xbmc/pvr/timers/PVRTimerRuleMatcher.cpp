@@ -8,14 +8,21 @@
 
 #include "PVRTimerRuleMatcher.h"
 
+#include "ServiceBroker.h"
 #include "XBDateTime.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_channels.h" // PVR_CHANNEL_INVALID_UID
 #include "pvr/PVRConstants.h" // PVR_CLIENT_INVALID_UID
+#include "pvr/PVRManager.h"
+#include "pvr/epg/EpgContainer.h"
 #include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgSearchIndex.h"
 #include "pvr/timers/PVRTimerInfoTag.h"
 #include "utils/RegExp.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <string_view>
 
 using namespace PVR;
 
@@ -175,6 +182,9 @@ bool CPVRTimerRuleMatcher::MatchSearchText(
 {
   if (m_timerRule->GetTimerType()->SupportsEpgFulltextMatch() && m_timerRule->IsFullTextEpgSearch())
   {
+    if (!IsSearchCandidate(epgTag, CPVREpgSearchIndex::FIELD_ALL))
+      return false;
+
     if (!m_textSearch)
     {
       m_textSearch = std::make_unique<CRegExp>(true /* case insensitive */);
@@ -187,6 +197,9 @@ bool CPVRTimerRuleMatcher::MatchSearchText(
   }
   else if (m_timerRule->GetTimerType()->SupportsEpgTitleMatch())
   {
+    if (!IsSearchCandidate(epgTag, CPVREpgSearchIndex::FIELD_TITLE))
+      return false;
+
     if (!m_textSearch)
     {
       m_textSearch = std::make_unique<CRegExp>(true /* case insensitive */);
@@ -197,3 +210,31 @@ bool CPVRTimerRuleMatcher::MatchSearchText(
   else
     return true;
 }
+
+bool CPVRTimerRuleMatcher::IsSearchCandidate(const std::shared_ptr<const CPVREpgInfoTag>& epgTag,
+                                             unsigned int fields) const
+{
+  if (!m_useEpgSearchIndex)
+    return true;
+
+  if (!m_searchCandidatesLoaded)
+  {
+    m_searchCandidatesLoaded = true;
+
+    // only plain ASCII text can be looked up, the index knows nothing about regular expressions
+    // or case folding beyond ASCII
+    const std::string& searchString{m_timerRule->EpgSearchString()};
+    static constexpr std::string_view REGEXP_CHARS{"\\^$.|?*+()[]{}"};
+    if (std::ranges::none_of(searchString,
+                             [](char c) {
+                               return static_cast<unsigned char>(c) >= 0x80 ||
+                                      REGEXP_CHARS.find(c) != std::string_view::npos;
+                             }))
+      m_searchCandidates =
+          CServiceBroker::GetPVRManager().EpgContainer().GetTagIdsContaining(searchString, fields);
+  }
+
+  // tags not in the database yet are not indexed
+  return !m_searchCandidates || epgTag->DatabaseID() <= 0 ||
+         std::ranges::binary_search(*m_searchCandidates, epgTag->DatabaseID());
+}
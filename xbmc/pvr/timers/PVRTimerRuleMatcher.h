@@ -11,6 +11,8 @@
 #include "XBDateTime.h"
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 class CRegExp;
 
@@ -32,6 +34,13 @@ public:
   CDateTime GetNextTimerStart() const;
   bool Matches(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
 
+  /*!
+   * @brief Look the rule's search text up in the EPG search index on the first match, so that
+   * tags which can't contain it are rejected without evaluating the regular expression. Worth it
+   * when matching many tags against the rule.
+   */
+  void UseEpgSearchIndex() { m_useEpgSearchIndex = true; }
+
 private:
   bool MatchSeriesLink(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
   bool MatchChannel(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
@@ -39,9 +48,14 @@ private:
   bool MatchEnd(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
   bool MatchDayOfWeek(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
   bool MatchSearchText(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
+  bool IsSearchCandidate(const std::shared_ptr<const CPVREpgInfoTag>& epgTag,
+                         unsigned int fields) const;
 
   const std::shared_ptr<CPVRTimerInfoTag> m_timerRule;
   CDateTime m_start;
   mutable std::unique_ptr<CRegExp> m_textSearch;
+  bool m_useEpgSearchIndex{false};
+  mutable bool m_searchCandidatesLoaded{false};
+  mutable std::optional<std::vector<int>> m_searchCandidates;
 };
 } // namespace PVR
@@ -487,6 +487,7 @@ void AddTimerRuleToEpgMap(
     if (epg)
     {
       const auto matcher{std::make_shared<CPVRTimerRuleMatcher>(timer, now)};
+      matcher->UseEpgSearchIndex();
       auto it = epgMap.find(epg);
       if (it == epgMap.cend())
         epgMap.insert({epg, {matcher}});
@@ -497,13 +498,14 @@ void AddTimerRuleToEpgMap(
   else
   {
     // rule matches "any channel" => we need to check all channels
+    const auto matcher{std::make_shared<CPVRTimerRuleMatcher>(timer, now)};
+    matcher->UseEpgSearchIndex();
     if (!bFetchedAllEpgs)
     {
       const std::vector<std::shared_ptr<CPVREpg>> epgs =
           CServiceBroker::GetPVRManager().EpgContainer().GetAllEpgs();
       for (const auto& epg : epgs)
       {
-        const auto matcher{std::make_shared<CPVRTimerRuleMatcher>(timer, now)};
         auto it = epgMap.find(epg);
         if (it == epgMap.cend())
           epgMap.insert({epg, {matcher}});
@@ -515,10 +517,7 @@ void AddTimerRuleToEpgMap(
     else
     {
       for (auto& [_, matchers] : epgMap)
-      {
-        const auto matcher{std::make_shared<CPVRTimerRuleMatcher>(timer, now)};
         matchers.emplace_back(matcher);
-      }
     }
   }
 }
@@ -1078,8 +1077,9 @@ bool CPVRTimers::AddLocalTimer(const std::shared_ptr<CPVRTimerInfoTag>& tag, boo
     if (persistedTimer->IsEpgBased())
     {
       // create and persist children of local epg-based timer rule
-      const std::vector<std::shared_ptr<CPVREpgInfoTag>> epgTags =
-          GetEpgTagsForTimerRule(CPVRTimerRuleMatcher(persistedTimer, CDateTime::GetUTCDateTime()));
+      CPVRTimerRuleMatcher matcher(persistedTimer, CDateTime::GetUTCDateTime());
+      matcher.UseEpgSearchIndex();
+      const std::vector<std::shared_ptr<CPVREpgInfoTag>> epgTags = GetEpgTagsForTimerRule(matcher);
       for (const auto& epgTag : epgTags)
       {
         const std::shared_ptr<CPVRTimerInfoTag> childTimer =
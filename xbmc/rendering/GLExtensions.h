@@ -23,6 +23,7 @@ struct CGLExtensions
     ARB_texture_swizzle,
     EXT_color_buffer_float,
     EXT_framebuffer_object,
+    EXT_texture_compression_s3tc,
     EXT_texture_filter_anisotropic,
     EXT_texture_format_BGRA8888,
     EXT_texture_swizzle,
@@ -44,6 +45,7 @@ struct CGLExtensions
       {ARB_texture_swizzle, "GL_ARB_texture_swizzle"},
       {EXT_color_buffer_float, "GL_EXT_color_buffer_float"},
       {EXT_framebuffer_object, "GL_EXT_framebuffer_object"},
+      {EXT_texture_compression_s3tc, "GL_EXT_texture_compression_s3tc"},
       {EXT_texture_filter_anisotropic, "GL_EXT_texture_filter_anisotropic"},
       {EXT_texture_format_BGRA8888, "GL_EXT_texture_format_BGRA8888"},
       {EXT_texture_swizzle, "GL_EXT_texture_swizzle"},
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "RenderSystemTypes.h"
+#include "guilib/TextureFormats.h"
 #include "threads/CriticalSection.h"
 #include "utils/ColorUtils.h"
 #include "utils/Geometry.h"
@@ -96,6 +97,12 @@ public:
   const std::string& GetRenderVersionString() const { return m_RenderVersion; }
   virtual bool SupportsNPOT(bool dxt) const;
   virtual bool SupportsStereo(RenderStereoMode mode) const;
+
+  /*!
+   * \brief Check if textures of a compressed format can be uploaded without conversion.
+   *        note: may execute on a different thread.
+   */
+  virtual bool SupportsCompressedTextureFormat(KD_TEX_FMT format) const { return false; }
   unsigned int GetMaxTextureSize() const { return m_maxTextureSize; }
   unsigned int GetMinDXTPitch() const { return m_minDXTPitch; }
 
@@ -367,6 +367,14 @@ bool CRenderSystemGL::SupportsNPOT(bool dxt) const
   return true;
 }
 
+bool CRenderSystemGL::SupportsCompressedTextureFormat(KD_TEX_FMT format) const
+{
+  if ((format & KD_TEX_FMT_TYPE_MASK) == KD_TEX_FMT_S3TC)
+    return CGLExtensions::IsExtensionSupported(CGLExtensions::EXT_texture_compression_s3tc);
+
+  return false;
+}
+
 void CRenderSystemGL::PresentRender(bool rendered, bool videoLayer)
 {
   SetVSync(true);
@@ -100,6 +100,7 @@ public:
   void SetStereoMode(RenderStereoMode mode, RenderStereoView view) override;
   bool SupportsStereo(RenderStereoMode mode) const override;
   bool SupportsNPOT(bool dxt) const override;
+  bool SupportsCompressedTextureFormat(KD_TEX_FMT format) const override;
 
   void Project(float &x, float &y, float &z) override;
 
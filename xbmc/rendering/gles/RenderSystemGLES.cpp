@@ -815,6 +815,14 @@ bool CRenderSystemGLES::SupportsStereo(RenderStereoMode mode) const
   return CRenderSystemBase::SupportsStereo(mode);
 }
 
+bool CRenderSystemGLES::SupportsCompressedTextureFormat(KD_TEX_FMT format) const
+{
+  if ((format & KD_TEX_FMT_TYPE_MASK) == KD_TEX_FMT_S3TC)
+    return CGLExtensions::IsExtensionSupported(CGLExtensions::EXT_texture_compression_s3tc);
+
+  return false;
+}
+
 GLint CRenderSystemGLES::GUIShaderGetModel()
 {
   if (m_pShader[m_method])
@@ -118,6 +118,7 @@ public:
   void SetCameraPosition(const CPoint &camera, int screenWidth, int screenHeight, float stereoFactor = 0.0f) override;
 
   bool SupportsStereo(RenderStereoMode mode) const override;
+  bool SupportsCompressedTextureFormat(KD_TEX_FMT format) const override;
 
   void Project(float &x, float &y, float &z) override;
 
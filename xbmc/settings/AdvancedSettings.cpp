@@ -435,6 +435,8 @@ void CAdvancedSettings::Initialize()
   m_bEpgDisplayUpdatePopup = true; /* Display a progress popup while updating EPG data from clients */
   m_bEpgDisplayIncrementalUpdatePopup = false; /* Display a progress popup while doing incremental EPG updates, but
                                                   only if 'displayupdatepopup' is also enabled. */
+  m_bEpgSearchIndex = true; /* Keep an in-memory word index of EPG titles and plots to speed up EPG
+                               searches. */
 
   m_bEdlMergeShortCommBreaks = false;      // Off by default
   m_EdlDisplayCommbreakNotifications = true; // On by default
@@ -884,6 +886,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pElement, "itemseparator", m_musicItemSeparator);
     XMLUtils::GetInt(pElement, "dateadded", m_iMusicLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "useisodates", m_bMusicLibraryUseISODates);
+    XMLUtils::GetInt(pElement, "tagreaders", m_musicLibraryTagReaders, 0, 32);
+    XMLUtils::GetInt(pElement, "virtuallistthreshold", m_musicLibraryVirtualListThreshold, 0,
+                     INT_MAX);
     XMLUtils::GetBoolean(pElement, "artistnavigatestosongs", m_bMusicLibraryArtistNavigatesToSongs);
     // Music artist name separators
     const TiXmlElement* separators = pElement->FirstChildElement("artistseparators");
@@ -907,6 +912,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "recentlyaddeditems", m_iVideoLibraryRecentlyAddedItems, 1, INT_MAX);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bVideoLibraryCleanOnUpdate);
     XMLUtils::GetBoolean(pElement, "usefasthash", m_bVideoLibraryUseFastHash);
+    XMLUtils::GetInt(pElement, "scanconcurrency", m_videoLibraryScanConcurrency, 1, 32);
     XMLUtils::GetString(pElement, "itemseparator", m_videoItemSeparator);
     XMLUtils::GetBoolean(pElement, "importwatchedstate", m_bVideoLibraryImportWatchedState);
     XMLUtils::GetBoolean(pElement, "importresumepoint", m_bVideoLibraryImportResumePoint);
@@ -1011,6 +1017,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
 
   XMLUtils::GetBoolean(pRootElement, "handlemounting", m_handleMounting);
   XMLUtils::GetBoolean(pRootElement, "automountopticalmedia", m_autoMountOpticalMedia);
+  XMLUtils::GetBoolean(pRootElement, "memorymaplocalfiles", m_memoryMapLocalFiles);
+  XMLUtils::GetBoolean(pRootElement, "persistdirectorycache", m_persistDirectoryCache);
+  XMLUtils::GetBoolean(pRootElement, "segmentedfilecache", m_segmentedFileCache);
 
 #if defined(TARGET_WINDOWS_DESKTOP)
   XMLUtils::GetBoolean(pRootElement, "minimizetotray", m_minimizeToTray);
@@ -1043,6 +1052,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "updateemptytagsinterval", m_iEpgUpdateEmptyTagsInterval);
     XMLUtils::GetBoolean(pElement, "displayupdatepopup", m_bEpgDisplayUpdatePopup);
     XMLUtils::GetBoolean(pElement, "displayincrementalupdatepopup", m_bEpgDisplayIncrementalUpdatePopup);
+    XMLUtils::GetBoolean(pElement, "searchindex", m_bEpgSearchIndex);
   }
 
   // EDL commercial break handling
@@ -1178,6 +1188,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   if (XMLUtils::GetString(pRootElement, "imagescalingalgorithm", tmp))
     m_imageScalingAlgorithm = CPictureScalingAlgorithm::FromString(tmp);
   XMLUtils::GetUInt(pRootElement, "imagequalityjpeg", m_imageQualityJpeg, 0, 21);
+  XMLUtils::GetUInt(pRootElement, "imagecachethreads", m_imageCacheThreads, 0, 16);
+  XMLUtils::GetUInt(pRootElement, "imagecachefetches", m_imageCacheFetches, 1, 16);
+  XMLUtils::GetBoolean(pRootElement, "imagecachecompressed", m_imageCacheCompressed);
   XMLUtils::GetBoolean(pRootElement, "playlistasfolders", m_playlistAsFolders);
   XMLUtils::GetBoolean(pRootElement, "uselocalecollation", m_useLocaleCollation);
   XMLUtils::GetBoolean(pRootElement, "detectasudf", m_detectAsUdf);
@@ -1297,6 +1310,10 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement, "geometryclear", m_guiGeometryClear);
     XMLUtils::GetBoolean(pElement, "asynctextureupload", m_guiAsyncTextureUpload);
     XMLUtils::GetBoolean(pElement, "transparentvideolayout", m_guiVideoLayoutTransparent);
+    XMLUtils::GetBoolean(pElement, "incrementalconditions", m_guiIncrementalConditions);
+    XMLUtils::GetBoolean(pElement, "conditionstats", m_guiConditionStats);
+    XMLUtils::GetUInt(pElement, "textureloaders", m_guiTextureLoaders, 0, 16);
+    XMLUtils::GetUInt(pElement, "textureuploadlimit", m_guiTextureUploadLimit, 0, 262144);
   }
 
   std::string seekSteps;
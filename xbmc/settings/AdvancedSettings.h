@@ -254,12 +254,18 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
 
     bool m_playlistAsFolders;
     bool m_detectAsUdf;
+    bool m_memoryMapLocalFiles{false}; ///< \brief play local media files through a memory mapping
+    bool m_persistDirectoryCache{false}; ///< \brief keep listings of network shares across restarts
+    bool m_segmentedFileCache{false}; ///< \brief keep the ranges around previous read positions of seekable audio/video in the memory cache
 
     unsigned int m_fanartRes; ///< \brief the maximal resolution to cache fanart at (assumes 16x9)
     unsigned int m_imageRes;  ///< \brief the maximal resolution to cache images at (assumes 16x9)
     CPictureScalingAlgorithm::Algorithm m_imageScalingAlgorithm;
     unsigned int
         m_imageQualityJpeg; ///< \brief the stored jpeg quality the lower the better (default: 4)
+    unsigned int m_imageCacheThreads{0}; ///< \brief images cached at once, 0 to pick by CPU count
+    unsigned int m_imageCacheFetches{2}; ///< \brief image files read at once while caching
+    bool m_imageCacheCompressed{false}; ///< \brief also store cached images as DXT compressed .dds
 
     int m_sambaclienttimeout;
     std::string m_sambadoscodepage;
@@ -278,6 +284,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bMusicLibraryCleanOnUpdate;
     bool m_bMusicLibraryArtistSortOnUpdate;
     bool m_bMusicLibraryUseISODates;
+    int m_musicLibraryTagReaders{0}; ///< \brief threads reading tags while scanning, 0 for automatic
+    int m_musicLibraryVirtualListThreshold{0}; ///< \brief songs from which the song node is paged in as shown, 0 to disable
     bool m_bMusicLibraryArtistNavigatesToSongs;
     std::string m_strMusicLibraryAlbumFormat;
     bool m_prioritiseAPEv2tags;
@@ -290,6 +298,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iVideoLibraryRecentlyAddedItems;
     bool m_bVideoLibraryCleanOnUpdate;
     bool m_bVideoLibraryUseFastHash;
+    int m_videoLibraryScanConcurrency{4}; ///< \brief directories listed in parallel per host while scanning
     bool m_bVideoLibraryImportWatchedState{true};
     bool m_bVideoLibraryImportResumePoint{true};
 
@@ -312,6 +321,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iEpgUpdateEmptyTagsInterval; // seconds
     bool m_bEpgDisplayUpdatePopup;
     bool m_bEpgDisplayIncrementalUpdatePopup;
+    bool m_bEpgSearchIndex;
 
     // EDL Commercial Break
     bool m_bEdlMergeShortCommBreaks;
@@ -382,6 +392,10 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiGeometryClear{true};
     bool m_guiAsyncTextureUpload{false};
     bool m_guiVideoLayoutTransparent{false};
+    bool m_guiIncrementalConditions{true}; /*!< only evaluate conditions again once their inputs changed */
+    bool m_guiConditionStats{false}; /*!< count and log the conditions evaluated per window and frame */
+    unsigned int m_guiTextureLoaders{0}; /*!< large textures decoded at once, 0 to pick by CPU count */
+    unsigned int m_guiTextureUploadLimit{8192}; /*!< KiB of large textures uploaded per frame, 0 for none */
 
     unsigned int m_addonPackageFolderSize;
 
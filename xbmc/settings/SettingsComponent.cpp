@@ -13,6 +13,7 @@
 #include "Util.h"
 #include "application/AppParams.h"
 #include "filesystem/Directory.h"
+#include "filesystem/DirectoryCache.h"
 #include "filesystem/SpecialProtocol.h"
 #ifdef TARGET_DARWIN_EMBEDDED
 #include "platform/darwin/ios-common/DarwinEmbedUtils.h"
@@ -57,6 +58,10 @@ void CreateUserDirs()
     CLog::Log(LOGWARNING, "Failed to remove the archive cache at {}", archiveCachePath);
 
   XFILE::CDirectory::Create(archiveCachePath);
+
+  // unlike the archive cache, persisted directory listings are validated when used
+  XFILE::CDirectory::Create("special://temp/dircache/");
+  g_directoryCache.PrunePersistedDirectories();
 }
 
 bool InitDirectoriesLinux(UserDirectoriesLocation loc)
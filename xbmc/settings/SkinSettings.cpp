@@ -25,6 +25,15 @@
 namespace
 {
 constexpr const char* XML_SKINSETTINGS = "skinsettings";
+
+void PublishChange()
+{
+  CServiceBroker::GetGUI()
+      ->GetInfoManager()
+      .GetInfoProviders()
+      .GetSkinInfoProvider()
+      .OnSkinSettingsChanged();
+}
 } // unnamed namespace
 
 CSkinSettings::CSkinSettings()
@@ -63,6 +72,7 @@ void CSkinSettings::SetString(int setting, const std::string& label) const
   if (!skin)
     return;
   skin->SetString(setting, label);
+  PublishChange();
 }
 
 int CSkinSettings::TranslateBool(const std::string& setting) const
@@ -95,6 +105,7 @@ void CSkinSettings::SetBool(int setting, bool set) const
   if (!skin)
     return;
   skin->SetBool(setting, set);
+  PublishChange();
 }
 
 void CSkinSettings::Reset(const std::string& setting) const
@@ -103,22 +114,46 @@ void CSkinSettings::Reset(const std::string& setting) const
   if (!skin)
     return;
   skin->Reset(setting);
+  PublishChange();
 }
 
-std::set<ADDON::CSkinSettingPtr> CSkinSettings::GetSettings() const
+bool CSkinSettings::SetString(const std::string& settingId, const std::string& value) const
 {
   auto skin = CServiceBroker::GetGUI()->GetSkinInfo();
   if (!skin)
-    return {};
-  return skin->GetSkinSettings();
+    return false;
+
+  const ADDON::CSkinSettingPtr setting = skin->GetSkinSetting(settingId);
+  if (!setting || setting->GetType() != "string")
+    return false;
+
+  std::static_pointer_cast<ADDON::CSkinSettingString>(setting)->value = value;
+  PublishChange();
+  return true;
 }
 
-ADDON::CSkinSettingPtr CSkinSettings::GetSetting(const std::string& settingId)
+bool CSkinSettings::SetBool(const std::string& settingId, bool value) const
 {
   auto skin = CServiceBroker::GetGUI()->GetSkinInfo();
   if (!skin)
-    return nullptr;
-  return skin->GetSkinSetting(settingId);
+    return false;
+
+  const ADDON::CSkinSettingPtr setting = skin->GetSkinSetting(settingId);
+  if (!setting || setting->GetType() != "bool")
+    return false;
+
+  std::static_pointer_cast<ADDON::CSkinSettingBool>(setting)->value = value;
+  PublishChange();
+  return true;
+}
+
+std::set<std::shared_ptr<const ADDON::CSkinSetting>> CSkinSettings::GetSettings() const
+{
+  auto skin = CServiceBroker::GetGUI()->GetSkinInfo();
+  if (!skin)
+    return {};
+  const std::set<ADDON::CSkinSettingPtr> settings = skin->GetSkinSettings();
+  return {settings.begin(), settings.end()};
 }
 
 std::shared_ptr<const ADDON::CSkinSetting> CSkinSettings::GetSetting(
@@ -137,6 +172,7 @@ void CSkinSettings::Reset() const
     return;
 
   skin->Reset();
+  PublishChange();
 
   CGUIInfoManager& infoMgr = CServiceBroker::GetGUI()->GetInfoManager();
   infoMgr.ResetCache();
@@ -217,6 +253,8 @@ void CSkinSettings::MigrateSettings(const std::shared_ptr<ADDON::CSkinInfo>& ski
 
   if (settingsMigrated)
   {
+    PublishChange();
+
     // save the skin's settings
     skin->SaveSettings();
 
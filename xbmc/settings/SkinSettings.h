@@ -43,8 +43,22 @@ public:
    */
   int GetInt(int setting) const;
 
-  std::set<ADDON::CSkinSettingPtr> GetSettings() const;
-  ADDON::CSkinSettingPtr GetSetting(const std::string& settingId);
+  /*! \brief Set the value of a string setting by its id.
+   * \param settingId - the setting id
+   * \param value - the new value
+   * \return true if the setting exists and is a string setting, false otherwise
+   */
+  bool SetString(const std::string& settingId, const std::string& value) const;
+
+  /*! \brief Set the value of a bool setting by its id.
+   * \param settingId - the setting id
+   * \param value - the new value
+   * \return true if the setting exists and is a bool setting, false otherwise
+   */
+  bool SetBool(const std::string& settingId, bool value) const;
+
+  // read only, settings are changed through the setters above so the changes are published
+  std::set<std::shared_ptr<const ADDON::CSkinSetting>> GetSettings() const;
   std::shared_ptr<const ADDON::CSkinSetting> GetSetting(const std::string& settingId) const;
 
   void Reset(const std::string& setting) const;
@@ -548,11 +548,13 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
 
   const dbiplus::result_set& resultSet = dataset.get_result_set();
   const auto offset = static_cast<unsigned int>(results.size());
+  // the records may be stored by column, go through the dataset for them
+  const auto numRows = static_cast<unsigned int>(dataset.num_rows());
 
   if (fields.empty())
   {
     DatabaseResult result;
-    for (unsigned int index = 0; index < resultSet.records.size(); index++)
+    for (unsigned int index = 0; index < numRows; index++)
     {
       result[Field::ROW] = index + offset;
       results.push_back(result);
@@ -569,9 +571,10 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
   for (const auto& field : fields)
     fieldIndexLookup.push_back(GetFieldIndex(field, mediaType));
 
-  results.reserve(resultSet.records.size() + offset);
-  for (unsigned int index = 0; index < resultSet.records.size(); index++)
+  results.reserve(numRows + offset);
+  for (unsigned int index = 0; index < numRows; index++)
   {
+    const dbiplus::sql_record& record = *dataset.get_record(index);
     DatabaseResult result;
     result[Field::ROW] = index + offset;
 
@@ -586,7 +589,7 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType& mediaType,
 
       std::pair<Field, CVariant> value;
       value.first = field;
-      if (!GetFieldValue(resultSet.records[index]->at(fieldIndex), value.second))
+      if (!GetFieldValue(record.at(fieldIndex), value.second))
         CLog::Log(LOGWARNING, "GetDatabaseResults: unable to retrieve value of field {}",
                   resultSet.record_header[fieldIndex].name);
 
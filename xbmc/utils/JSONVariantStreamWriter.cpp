@@ -0,0 +1,147 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "JSONVariantStreamWriter.h"
+
+#include <algorithm>
+#include <string.h>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+CJSONVariantStreamWriter::CJSONVariantStreamWriter(CVariant&& value, bool compact)
+  : m_value(std::move(value)), m_compact(compact)
+{
+}
+
+size_t CJSONVariantStreamWriter::Read(char* buffer, size_t size)
+{
+  size_t written = 0;
+  while (written < size && !m_failed)
+  {
+    if (m_pendingPosition == m_pending.size())
+    {
+      m_pending.clear();
+      m_pendingPosition = 0;
+
+      if (m_started && m_containers.empty())
+        break;
+
+      try
+      {
+        WriteNext();
+      }
+      catch (nlohmann::json::exception&)
+      {
+        m_failed = true;
+      }
+      continue;
+    }
+
+    const size_t length = std::min(size - written, m_pending.size() - m_pendingPosition);
+    memcpy(buffer + written, m_pending.data() + m_pendingPosition, length);
+    m_pendingPosition += length;
+    written += length;
+  }
+
+  return m_failed ? 0 : written;
+}
+
+void CJSONVariantStreamWriter::WriteNext()
+{
+  if (!m_started)
+  {
+    m_started = true;
+    WriteValue(m_value);
+    return;
+  }
+
+  Container& container = m_containers.back();
+  const bool isArray = container.value->isArray();
+  if (isArray ? container.itArray == container.value->end_array()
+              : container.itMap == container.value->end_map())
+  {
+    WriteIndent(m_containers.size() - 1);
+    m_pending += isArray ? ']' : '}';
+    *container.value = CVariant();
+    m_containers.pop_back();
+    return;
+  }
+
+  if (!container.first)
+    m_pending += ',';
+  container.first = false;
+  WriteIndent(m_containers.size());
+
+  // the reference to the container is invalidated by writing a nested one
+  CVariant* value;
+  if (isArray)
+    value = &*container.itArray++;
+  else
+  {
+    WriteString(std::string(container.itMap->first));
+    m_pending += m_compact ? ":" : ": ";
+    value = &(container.itMap++)->second;
+  }
+  WriteValue(*value);
+}
+
+void CJSONVariantStreamWriter::WriteValue(CVariant& value)
+{
+  switch (value.type())
+  {
+    case CVariant::VariantTypeInteger:
+      m_pending += std::to_string(value.asInteger());
+      break;
+    case CVariant::VariantTypeUnsignedInteger:
+      m_pending += std::to_string(value.asUnsignedInteger());
+      break;
+    case CVariant::VariantTypeDouble:
+      m_pending += nlohmann::json(value.asDouble()).dump();
+      break;
+    case CVariant::VariantTypeBoolean:
+      m_pending += value.asBoolean() ? "true" : "false";
+      break;
+    case CVariant::VariantTypeString:
+      WriteString(std::move(value).asString());
+      break;
+    case CVariant::VariantTypeArray:
+    case CVariant::VariantTypeObject:
+      if (value.empty())
+      {
+        m_pending += value.isArray() ? "[]" : "{}";
+        break;
+      }
+      m_pending += value.isArray() ? '[' : '{';
+      // released once all of its values have been written
+      m_containers.push_back({&value, value.begin_array(), value.begin_map(), true});
+      return;
+
+    case CVariant::VariantTypeConstNull:
+    case CVariant::VariantTypeNull:
+    default:
+      m_pending += "null";
+      break;
+  }
+
+  value = CVariant();
+}
+
+void CJSONVariantStreamWriter::WriteString(std::string&& str)
+{
+  m_pending += nlohmann::json(std::move(str)).dump();
+}
+
+void CJSONVariantStreamWriter::WriteIndent(size_t depth)
+{
+  if (m_compact)
+    return;
+
+  m_pending += '\n';
+  m_pending.append(depth, '\t');
+}
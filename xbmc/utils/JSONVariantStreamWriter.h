@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/Variant.h"
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Serializes a CVariant to JSON in parts of the size the consumer asks for.
+ *
+ * Produces the same output as CJSONVariantWriter, but without building the whole document in
+ * memory first: only the value currently being written is buffered, and every value is released
+ * as soon as it has been written. Meant for large responses, like library listings, which can be
+ * sent out while they are being serialized.
+ */
+class CJSONVariantStreamWriter
+{
+public:
+  CJSONVariantStreamWriter(CVariant&& value, bool compact);
+
+  /*!
+   * \brief Write the next part of the JSON document into the given buffer.
+   * \param buffer The buffer to write to
+   * \param size The size of the buffer
+   * \return The number of bytes written, 0 once the whole document has been written or on failure
+   */
+  size_t Read(char* buffer, size_t size);
+
+  /*!
+   * \brief Whether serializing failed, e.g. because of a string which isn't valid UTF-8.
+   */
+  bool HasFailed() const { return m_failed; }
+
+private:
+  struct Container
+  {
+    CVariant* value;
+    CVariant::iterator_array itArray;
+    CVariant::iterator_map itMap;
+    bool first;
+  };
+
+  void WriteNext();
+  void WriteValue(CVariant& value);
+  void WriteString(std::string&& str);
+  void WriteIndent(size_t depth);
+
+  CVariant m_value;
+  bool m_compact;
+  bool m_started{false};
+  bool m_failed{false};
+  std::vector<Container> m_containers;
+  std::string m_pending;
+  size_t m_pendingPosition{0};
+};
@@ -0,0 +1,327 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SortEngine.h"
+
+#include "LangInfo.h"
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <future>
+#include <locale>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+// weights of characters that aren't ascii symbols, these sort after the symbols
+constexpr uint64_t CHARACTER = uint64_t{1} << 32;
+// a run of digits is this marker followed by its value
+constexpr uint64_t NUMBER = CHARACTER | L'0';
+
+enum SortGroup : uint8_t
+{
+  GROUP_TOP,
+  GROUP_NONE,
+  GROUP_BOTTOM,
+  GROUP_NO_LABEL
+};
+
+// ascii punctuation and symbols, sorted above everything else by AlphaNumericCompare()
+bool IsSymbol(wchar_t c)
+{
+  return (c >= 32 && c < L'0') || (c > L'9' && c < L'A') || (c > L'Z' && c < L'a') ||
+         (c > L'z' && c < 128);
+}
+
+bool IsDigit(wchar_t c)
+{
+  return c >= L'0' && c <= L'9';
+}
+
+template<typename Iterator, typename Compare>
+void ParallelSort(Iterator first, Iterator last, Compare less, unsigned int threads)
+{
+  const auto size = static_cast<size_t>(last - first);
+  std::vector<size_t> bounds;
+  for (unsigned int i = 0; i < threads; ++i)
+    bounds.push_back(size * i / threads);
+  bounds.push_back(size);
+
+  std::vector<std::future<void>> tasks;
+  for (size_t i = 0; i + 1 < bounds.size(); ++i)
+    tasks.emplace_back(
+        std::async(std::launch::async, [=]
+                   { std::stable_sort(first + bounds[i], first + bounds[i + 1], less); }));
+  for (auto& task : tasks)
+    task.get();
+
+  // merge neighbouring runs pairwise until one is left
+  while (bounds.size() > 2)
+  {
+    tasks.clear();
+    std::vector<size_t> merged{0};
+    size_t i = 0;
+    for (; i + 2 < bounds.size(); i += 2)
+    {
+      const Iterator begin = first + bounds[i];
+      const Iterator middle = first + bounds[i + 1];
+      const Iterator end = first + bounds[i + 2];
+      tasks.emplace_back(std::async(std::launch::async, [=]
+                                    { std::inplace_merge(begin, middle, end, less); }));
+      merged.push_back(bounds[i + 2]);
+    }
+    if (merged.back() != bounds.back())
+      merged.push_back(bounds.back());
+    for (auto& task : tasks)
+      task.get();
+    bounds = std::move(merged);
+  }
+}
+} // namespace
+
+CSortEngine::CSortEngine(SortOrder sortOrder, SortAttribute attributes)
+  : m_sortOrder(sortOrder),
+    m_handleFolders(!(attributes & SortAttributeIgnoreFolders)),
+    m_localeCollation(g_langInfo.UseLocaleCollation())
+{
+}
+
+void CSortEngine::Reserve(size_t items)
+{
+  m_entries.reserve(items);
+  m_items.reserve(items);
+  m_weights.reserve(items * 24);
+}
+
+void CSortEngine::Add(const SortItem& item)
+{
+  Entry entry{};
+  entry.index = static_cast<uint32_t>(m_entries.size());
+  entry.offset = static_cast<uint32_t>(m_weights.size());
+  entry.group = GROUP_NONE;
+  entry.folder = -1;
+  m_items.push_back(&item);
+
+  const auto itSort = item.find(Field::SORT);
+  if (itSort == item.end())
+    entry.group = GROUP_NO_LABEL;
+  else
+  {
+    if (const auto it = item.find(Field::SORT_SPECIAL); it != item.end())
+    {
+      const int64_t special = it->second.asInteger();
+      if (special == static_cast<int64_t>(SortSpecial::TOP))
+        entry.group = GROUP_TOP;
+      else if (special == static_cast<int64_t>(SortSpecial::BOTTOM))
+        entry.group = GROUP_BOTTOM;
+    }
+    if (m_exact)
+      AddKey(itSort->second.asWideString());
+  }
+
+  if (m_handleFolders)
+  {
+    if (const auto it = item.find(Field::FOLDER); it != item.end())
+      entry.folder = it->second.asBoolean() ? 1 : 0;
+  }
+
+  entry.length = static_cast<uint32_t>(m_weights.size() - entry.offset);
+  m_entries.push_back(entry);
+}
+
+void CSortEngine::AddKey(const std::wstring& label)
+{
+  size_t i = 0;
+  while (i < label.size())
+  {
+    wchar_t c = label[i];
+    if (IsDigit(c))
+    {
+      // compare only up to 15 digits, like AlphaNumericCompare()
+      int64_t number = 0;
+      const size_t start = i;
+      while (i < label.size() && IsDigit(label[i]) && i - start < 15)
+        number = number * 10 + (label[i++] - L'0');
+      m_weights.push_back(NUMBER);
+      m_weights.push_back(static_cast<uint64_t>(number));
+      continue;
+    }
+
+    ++i;
+    if (IsSymbol(c))
+    {
+      m_weights.push_back(static_cast<uint64_t>(c));
+      continue;
+    }
+
+    if (!m_localeCollation)
+    {
+      if (c > 128)
+        c = StringUtils::GetCollationWeight(c);
+      // a character folded onto a digit compares with it rather than with the whole number
+      if (IsDigit(c))
+        m_exact = false;
+    }
+    if (c >= L'A' && c <= L'Z')
+      c += L'a' - L'A';
+    m_weights.push_back(CHARACTER | static_cast<uint32_t>(c));
+  }
+}
+
+void CSortEngine::RankCharacters()
+{
+  // the locale decides how characters compare, replace them by their rank in its order
+  std::array<bool, 128> seenAscii{};
+  std::unordered_map<uint32_t, uint32_t> ranks;
+  std::vector<wchar_t> characters;
+  for (wchar_t c = L'0'; c <= L'9'; ++c)
+    seenAscii[c] = true;
+
+  for (const Entry& entry : m_entries)
+  {
+    for (uint32_t i = entry.offset; i < entry.offset + entry.length; ++i)
+    {
+      const uint64_t weight = m_weights[i];
+      if (weight == NUMBER)
+        ++i;
+      else if (weight & CHARACTER)
+      {
+        const auto c = static_cast<uint32_t>(weight);
+        if (c < 128)
+          seenAscii[c] = true;
+        else
+          ranks.try_emplace(c, 0);
+      }
+    }
+  }
+  for (uint32_t c = 0; c < seenAscii.size(); ++c)
+  {
+    if (seenAscii[c])
+      characters.push_back(static_cast<wchar_t>(c));
+  }
+  for (const auto& [c, rank] : ranks)
+    characters.push_back(static_cast<wchar_t>(c));
+
+  const std::collate<wchar_t>& coll =
+      std::use_facet<std::collate<wchar_t>>(g_langInfo.GetSystemLocale());
+  const auto compare = [&coll](wchar_t left, wchar_t right)
+  { return coll.compare(&left, &left + 1, &right, &right + 1); };
+  std::ranges::sort(characters, [&compare](wchar_t left, wchar_t right)
+                    { return compare(left, right) < 0; });
+
+  // digits all compare as numbers, they need to rank next to each other and apart from the rest
+  const auto firstDigit = std::ranges::find_if(characters, IsDigit);
+  const auto lastDigit = std::find_if(characters.rbegin(), characters.rend(), IsDigit).base() - 1;
+  if (!std::all_of(firstDigit, lastDigit + 1, IsDigit) ||
+      (firstDigit != characters.begin() && compare(*(firstDigit - 1), *firstDigit) == 0) ||
+      (lastDigit + 1 != characters.end() && compare(*lastDigit, *(lastDigit + 1)) == 0))
+  {
+    m_exact = false;
+    return;
+  }
+
+  std::array<uint32_t, 128> asciiRanks{};
+  uint32_t rank = 0;
+  for (size_t i = 0; i < characters.size(); ++i)
+  {
+    if (i > 0 && compare(characters[i - 1], characters[i]) != 0)
+      ++rank;
+    const auto c = static_cast<uint32_t>(characters[i]);
+    if (c < 128)
+      asciiRanks[c] = rank;
+    else
+      ranks[c] = rank;
+  }
+  asciiRanks[L'0'] = asciiRanks[*firstDigit];
+
+  for (const Entry& entry : m_entries)
+  {
+    for (uint32_t i = entry.offset; i < entry.offset + entry.length; ++i)
+    {
+      uint64_t& weight = m_weights[i];
+      if (!(weight & CHARACTER))
+        continue;
+      const bool number = weight == NUMBER;
+      const auto c = static_cast<uint32_t>(weight);
+      weight = CHARACTER | (c < 128 ? asciiRanks[c] : ranks[c]);
+      if (number)
+        ++i;
+    }
+  }
+}
+
+int CSortEngine::CompareKeys(const Entry& left, const Entry& right) const
+{
+  if (!m_exact)
+  {
+    const int64_t result =
+        StringUtils::AlphaNumericCompare(m_labels[left.index], m_labels[right.index]);
+    return result < 0 ? -1 : (result > 0 ? 1 : 0);
+  }
+
+  const uint64_t* l = m_weights.data() + left.offset;
+  const uint64_t* r = m_weights.data() + right.offset;
+  const auto result =
+      std::lexicographical_compare_three_way(l, l + left.length, r, r + right.length);
+  return result < 0 ? -1 : (result > 0 ? 1 : 0);
+}
+
+bool CSortEngine::Less(const Entry& left, const Entry& right) const
+{
+  if (left.group != right.group)
+    return left.group < right.group;
+
+  // items sorted on top or bottom, and those without a label, keep their order
+  if (left.group == GROUP_NONE)
+  {
+    if (m_handleFolders && left.folder >= 0 && right.folder >= 0 && left.folder != right.folder)
+      return left.folder > right.folder;
+
+    const int result = CompareKeys(left, right);
+    if (result != 0)
+      return m_sortOrder == SortOrder::DESCENDING ? result > 0 : result < 0;
+  }
+
+  return left.index < right.index;
+}
+
+std::vector<uint32_t> CSortEngine::Sort(unsigned int threads)
+{
+  if (m_exact && m_localeCollation)
+    RankCharacters();
+
+  if (!m_exact && m_labels.size() != m_items.size())
+  {
+    m_labels.reserve(m_items.size());
+    for (const SortItem* item : m_items)
+    {
+      const auto it = item->find(Field::SORT);
+      m_labels.emplace_back(it == item->end() ? std::wstring() : it->second.asWideString());
+    }
+  }
+
+  // the index breaks ties, so splitting the work gives the same order as sorting in one go. A
+  // merge sort copes with labels that don't compare consistently, where an introsort could not.
+  const auto less = [this](const Entry& left, const Entry& right) { return Less(left, right); };
+  if (threads == 0)
+    threads = std::clamp(std::thread::hardware_concurrency(), 1U, 8U);
+  if (m_entries.size() < PARALLEL_THRESHOLD || threads == 1)
+    std::ranges::stable_sort(m_entries, less);
+  else
+    ParallelSort(m_entries.begin(), m_entries.end(), less, threads);
+
+  std::vector<uint32_t> order;
+  order.reserve(m_entries.size());
+  for (const Entry& entry : m_entries)
+    order.push_back(entry.index);
+  return order;
+}
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/SortUtils.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Orders sort items by their prepared sort label, the way SortUtils::Sort() does.
+ *
+ * Rather than comparing the items' maps of variants over and over, every item is reduced once
+ * to a typed key: its special sort position, its folder flag and a collation key of its label,
+ * stored next to each other in contiguous arrays. A collation key is a string of integers that
+ * compares like StringUtils::AlphaNumericCompare() compares the label: runs of digits become
+ * a single packed number and characters become their collation weight, so the comparison is a
+ * plain lexicographical compare. Large inputs are sorted on several threads.
+ *
+ * The order is stable and identical to comparing the labels with AlphaNumericCompare(). Should
+ * a label contain characters whose weight can't be represented exactly, e.g. a non-digit that
+ * collates among the digits, the labels are compared with AlphaNumericCompare() instead.
+ */
+class CSortEngine
+{
+public:
+  CSortEngine(SortOrder sortOrder, SortAttribute attributes);
+
+  void Reserve(size_t items);
+
+  /*!
+   * \brief Add the next item, its Field::SORT has to be prepared already.
+   */
+  void Add(const SortItem& item);
+
+  /*!
+   * \brief Sort the items added, call once all of them are.
+   * \param threads the number of threads to sort inputs of PARALLEL_THRESHOLD items or more on,
+   * 0 uses one per core up to 8
+   * \return the indexes of the items in the order they sort in
+   */
+  std::vector<uint32_t> Sort(unsigned int threads = 0);
+
+  /*!
+   * \brief Whether the last Sort() compared collation keys or fell back to the labels.
+   */
+  bool UsedCollationKeys() const { return m_exact; }
+
+  /*!
+   * \brief Inputs from this size on are sorted on several threads.
+   */
+  static constexpr size_t PARALLEL_THRESHOLD = 16384;
+
+private:
+  struct Entry
+  {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t index;
+    uint8_t group; // top, none, bottom, no sort label
+    int8_t folder; // -1 when unknown
+  };
+
+  void AddKey(const std::wstring& label);
+  void RankCharacters();
+  int CompareKeys(const Entry& left, const Entry& right) const;
+  bool Less(const Entry& left, const Entry& right) const;
+
+  SortOrder m_sortOrder;
+  bool m_handleFolders;
+  bool m_localeCollation;
+  bool m_exact{true};
+
+  std::vector<Entry> m_entries;
+  std::vector<uint64_t> m_weights;
+  std::vector<const SortItem*> m_items;
+  std::vector<std::wstring> m_labels;
+};
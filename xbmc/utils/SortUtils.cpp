@@ -9,6 +9,7 @@
 #include "SortUtils.h"
 
 #include "LangInfo.h"
+#include "SortEngine.h"
 #include "SortFileItem.h"
 #include "URL.h"
 #include "Util.h"
@@ -513,144 +514,6 @@ std::string ByBPM(SortAttribute attributes, const SortItem& values)
                              ByLabel(attributes, values));
 }
 
-bool preliminarySort(const SortItem& left,
-                     const SortItem& right,
-                     bool handleFolder,
-                     bool& result,
-                     std::wstring& labelLeft,
-                     std::wstring& labelRight)
-{
-  // make sure both items have the necessary data to do the sorting
-  const auto itLeftSort = left.find(Field::SORT);
-  if (itLeftSort == left.end())
-  {
-    result = false;
-    return true;
-  }
-  const auto itRightSort = right.find(Field::SORT);
-  if (itRightSort == right.end())
-  {
-    result = true;
-    return true;
-  }
-
-  // look at special sorting behaviour
-  SortSpecial leftSortSpecial = SortSpecial::NONE;
-  SortSpecial rightSortSpecial = SortSpecial::NONE;
-  if (const auto itLeft = left.find(Field::SORT_SPECIAL);
-      itLeft != left.end() &&
-      itLeft->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
-    leftSortSpecial = static_cast<SortSpecial>(itLeft->second.asInteger());
-  if (const auto itRight = right.find(Field::SORT_SPECIAL);
-      itRight != right.end() &&
-      itRight->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
-    rightSortSpecial = static_cast<SortSpecial>(itRight->second.asInteger());
-
-  // one has a special sort
-  if (leftSortSpecial != rightSortSpecial)
-  {
-    // left should be sorted on top
-    // or right should be sorted on bottom
-    // => left is sorted above right
-    if (leftSortSpecial == SortSpecial::TOP || rightSortSpecial == SortSpecial::BOTTOM)
-    {
-      result = true;
-      return true;
-    }
-
-    // otherwise right is sorted above left
-    result = false;
-    return true;
-  }
-  // both have either sort on top or sort on bottom -> leave as-is
-  else if (leftSortSpecial != SortSpecial::NONE)
-  {
-    result = false;
-    return true;
-  }
-
-  if (handleFolder)
-  {
-    const auto itLeft = left.find(Field::FOLDER);
-    const auto itRight = right.find(Field::FOLDER);
-    if (itLeft != left.end() && itRight != right.end() &&
-        itLeft->second.asBoolean() != itRight->second.asBoolean())
-    {
-      result = itLeft->second.asBoolean();
-      return true;
-    }
-  }
-
-  labelLeft = itLeftSort->second.asWideString();
-  labelRight = itRightSort->second.asWideString();
-
-  return false;
-}
-
-bool SorterAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
-}
-
-bool SorterDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
-
-bool SorterIgnoreFoldersAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
-}
-
-bool SorterIgnoreFoldersDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
-
-bool SorterIndirectAscending(const std::shared_ptr<SortItem>& left,
-                             const std::shared_ptr<SortItem>& right)
-{
-  return SorterAscending(*left, *right);
-}
-
-bool SorterIndirectDescending(const std::shared_ptr<SortItem>& left,
-                              const std::shared_ptr<SortItem>& right)
-{
-  return SorterDescending(*left, *right);
-}
-
-bool SorterIndirectIgnoreFoldersAscending(const std::shared_ptr<SortItem>& left,
-                                          const std::shared_ptr<SortItem>& right)
-{
-  return SorterIgnoreFoldersAscending(*left, *right);
-}
-
-bool SorterIndirectIgnoreFoldersDescending(const std::shared_ptr<SortItem>& left,
-                                           const std::shared_ptr<SortItem>& right)
-{
-  return SorterIgnoreFoldersDescending(*left, *right);
-}
-
 // clang-format off
 std::map<SortBy, SortUtils::SortPreparator> fillPreparators()
 {
@@ -999,7 +862,16 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
       }
 
       // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
+      CSortEngine engine(sortOrder, attributes);
+      engine.Reserve(items.size());
+      for (const auto& item : items)
+        engine.Add(item);
+
+      DatabaseResults sorted;
+      sorted.reserve(items.size());
+      for (const uint32_t index : engine.Sort())
+        sorted.emplace_back(std::move(items[index]));
+      items.swap(sorted);
     }
   }
 
@@ -1038,7 +910,16 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
       }
 
       // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorterIndirect(sortOrder, attributes));
+      CSortEngine engine(sortOrder, attributes);
+      engine.Reserve(items.size());
+      for (const auto& item : items)
+        engine.Add(*item);
+
+      SortItems sorted;
+      sorted.reserve(items.size());
+      for (const uint32_t index : engine.Sort())
+        sorted.emplace_back(std::move(items[index]));
+      items.swap(sorted);
     }
   }
 
@@ -1093,24 +974,6 @@ const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
   return it == m_preparators.end() ? m_preparators[SortBy::NONE] : it->second;
 }
 
-SortUtils::Sorter SortUtils::getSorter(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrder::DESCENDING ? SorterIgnoreFoldersDescending
-                                              : SorterIgnoreFoldersAscending;
-
-  return sortOrder == SortOrder::DESCENDING ? SorterDescending : SorterAscending;
-}
-
-SortUtils::SorterIndirect SortUtils::getSorterIndirect(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrder::DESCENDING ? SorterIndirectIgnoreFoldersDescending
-                                              : SorterIndirectIgnoreFoldersAscending;
-
-  return sortOrder == SortOrder::DESCENDING ? SorterIndirectDescending : SorterIndirectAscending;
-}
-
 const Fields& SortUtils::GetFieldsForSorting(SortBy sortBy)
 {
   const auto it = m_sortingFields.find(sortBy);
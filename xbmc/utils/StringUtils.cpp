@@ -1094,7 +1094,7 @@ static bool CollationMirrorsMySql()
 }
 } // namespace
 
-static wchar_t GetCollationWeight(const wchar_t& r)
+wchar_t StringUtils::GetCollationWeight(wchar_t r) noexcept
 {
   // Nordic languages order some accented vowels as distinct letters at the end of their
   // alphabet rather than as accented variants of a/o (see StringUtils::GetNordicCollationWeight).
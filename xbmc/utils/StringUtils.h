@@ -301,6 +301,16 @@ public:
    */
   [[nodiscard]] static wchar_t GetNordicCollationWeight(std::string_view languageCode,
                                                         wchar_t codepoint) noexcept;
+  /*! \brief Get the accent-folding collation weight of a codepoint.
+   *
+   * The weight AlphaNumericCompare()/AlphaNumericCollation() compare non-ascii characters by
+   * when locale collation is not in use, including the Nordic overrides.
+   *
+   * \param codepoint the unicode codepoint being weighted
+   *
+   * \return the weight, the equivalent lower case ascii letter for accented latin letters
+   */
+  [[nodiscard]] static wchar_t GetCollationWeight(wchar_t codepoint) noexcept;
   [[nodiscard]] static long TimeStringToSeconds(std::string_view timeString);
   static void RemoveCRLF(std::string& strLine) noexcept;
 
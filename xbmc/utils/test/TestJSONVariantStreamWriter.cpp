@@ -0,0 +1,208 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONVariantStreamWriter.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(TARGET_LINUX)
+#include <sys/resource.h>
+#endif
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::string ReadAll(CJSONVariantStreamWriter& writer, size_t chunkSize)
+{
+  std::string output;
+  std::vector<char> buffer(chunkSize);
+  size_t read;
+  while ((read = writer.Read(buffer.data(), buffer.size())) > 0)
+  {
+    EXPECT_LE(read, chunkSize);
+    output.append(buffer.data(), read);
+  }
+  return output;
+}
+
+CVariant CreateDocument()
+{
+  CVariant document;
+  document["null"] = CVariant();
+  document["boolean"] = false;
+  document["integer"] = static_cast<int64_t>(-4294967296LL);
+  document["unsigned"] = static_cast<uint64_t>(18446744073709551615ULL);
+  document["double"] = 7.25;
+  document["whole"] = 1.0;
+  document["string"] = "quote \" backslash \\ tab \t newline \n control \x01 unicode \xC3\xBC";
+  document["empty array"] = CVariant(CVariant::VariantTypeArray);
+  document["empty object"] = CVariant(CVariant::VariantTypeObject);
+  document["array"].push_back(1);
+  document["array"].push_back(CVariant(CVariant::VariantTypeArray));
+  document["array"][1].push_back("nested");
+  document["array"].push_back(CVariant(CVariant::VariantTypeObject));
+  document["array"][2]["key"] = true;
+  return document;
+}
+
+CVariant CreateMoviesResponse(int iMovies)
+{
+  CVariant response;
+  response["jsonrpc"] = "2.0";
+  response["id"] = 1;
+
+  CVariant& result = response["result"];
+  result["limits"]["start"] = 0;
+  result["limits"]["end"] = iMovies;
+  result["limits"]["total"] = iMovies;
+
+  CVariant& movies = result["movies"];
+  movies.reserve(iMovies);
+  for (int i = 0; i < iMovies; ++i)
+  {
+    CVariant movie;
+    movie["movieid"] = i + 1;
+    movie["label"] = "Movie " + std::to_string(i);
+    movie["title"] = "Movie " + std::to_string(i);
+    movie["originaltitle"] = "The original title of movie " + std::to_string(i);
+    movie["plot"] = "The plot of movie " + std::to_string(i) +
+                    ", a few sentences about the people in it and what happens to them, which "
+                    "doesn't give the end away. It is about as long as plots from scrapers are.";
+    movie["tagline"] = "A tagline";
+    movie["year"] = 1950 + i % 75;
+    movie["rating"] = 5.0 + (i % 50) / 10.0;
+    movie["runtime"] = 5400 + i % 3600;
+    movie["file"] = "smb://nas/movies/Movie " + std::to_string(i) + "/movie.mkv";
+    movie["art"]["poster"] =
+        "image://smb%3a%2f%2fnas%2fmovies%2fMovie%20" + std::to_string(i) + "%2fposter.jpg/";
+    movie["art"]["fanart"] =
+        "image://smb%3a%2f%2fnas%2fmovies%2fMovie%20" + std::to_string(i) + "%2ffanart.jpg/";
+    movie["genre"].push_back("Drama");
+    movie["genre"].push_back("Thriller");
+    for (int actor = 0; actor < 10; ++actor)
+    {
+      CVariant cast;
+      cast["name"] = "Actor " + std::to_string((i + actor) % 5000);
+      cast["role"] = "Role " + std::to_string(actor);
+      cast["order"] = actor;
+      movie["cast"].push_back(std::move(cast));
+    }
+    movies.push_back(std::move(movie));
+  }
+  return response;
+}
+
+#if defined(TARGET_LINUX)
+long GetMaxRss()
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+#endif
+} // namespace
+
+TEST(TestJSONVariantStreamWriter, WritesLikeJSONVariantWriter)
+{
+  for (const bool compact : {true, false})
+  {
+    std::string expected;
+    ASSERT_TRUE(CJSONVariantWriter::Write(CreateDocument(), expected, compact));
+
+    for (const size_t chunkSize : {1, 7, 4096})
+    {
+      CJSONVariantStreamWriter writer(CreateDocument(), compact);
+      EXPECT_EQ(expected, ReadAll(writer, chunkSize)) << compact << " " << chunkSize;
+      EXPECT_FALSE(writer.HasFailed());
+      EXPECT_EQ(0u, ReadAll(writer, chunkSize).size());
+    }
+  }
+}
+
+TEST(TestJSONVariantStreamWriter, WritesScalars)
+{
+  CJSONVariantStreamWriter writer(CVariant("foo"), false);
+  EXPECT_EQ("\"foo\"", ReadAll(writer, 2));
+
+  CJSONVariantStreamWriter nullWriter(CVariant(), false);
+  EXPECT_EQ("null", ReadAll(nullWriter, 2));
+}
+
+TEST(TestJSONVariantStreamWriter, FailsOnInvalidUTF8)
+{
+  CVariant value;
+  value["valid"] = "text";
+  value["zinvalid"] = "\xC3\x28";
+  CJSONVariantStreamWriter writer(std::move(value), true);
+
+  char buffer[4];
+  EXPECT_EQ(4u, writer.Read(buffer, sizeof(buffer)));
+  ReadAll(writer, 4);
+  EXPECT_TRUE(writer.HasFailed());
+}
+
+/*!
+ Serializes the response of a VideoLibrary.GetMovies call with all properties on a library of
+ 30000 movies, once the way the JSON-RPC transports did with CJSONVariantWriter and once in the
+ 32 KiB parts the web server asks for, and compares the time until the first byte can be sent and
+ the increase of the peak memory usage.
+
+ The numbers are for the serialization only. The CVariant tree is built before the timers start,
+ so the database query and the conversion of the CFileItemList, which a real request waits for
+ before either writer starts, aren't included.
+ */
+TEST(TestJSONVariantStreamWriter, DISABLED_SerializeLibraryResponse)
+{
+  constexpr int MOVIES = 30000;
+  constexpr size_t CHUNK_SIZE = 32 * 1024;
+
+  using Duration = std::chrono::duration<double, std::milli>;
+
+  CVariant response = CreateMoviesResponse(MOVIES);
+#if defined(TARGET_LINUX)
+  const long maxRss = GetMaxRss();
+#endif
+
+  // streaming first, the peak memory usage only ever grows
+  auto start = std::chrono::steady_clock::now();
+  CJSONVariantStreamWriter writer(std::move(response), true);
+  std::vector<char> buffer(CHUNK_SIZE);
+  size_t streamed = writer.Read(buffer.data(), buffer.size());
+  const Duration streamFirstByteTime = std::chrono::steady_clock::now() - start;
+  ASSERT_EQ(CHUNK_SIZE, streamed);
+  size_t read;
+  while ((read = writer.Read(buffer.data(), buffer.size())) > 0)
+    streamed += read;
+  const Duration streamTime = std::chrono::steady_clock::now() - start;
+  ASSERT_FALSE(writer.HasFailed());
+#if defined(TARGET_LINUX)
+  const long streamMaxRss = GetMaxRss();
+#endif
+
+  const CVariant written = CreateMoviesResponse(MOVIES);
+  start = std::chrono::steady_clock::now();
+  std::string output;
+  ASSERT_TRUE(CJSONVariantWriter::Write(written, output, true));
+  const Duration writeTime = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(output.size(), streamed);
+
+  RecordProperty("ResponseBytes", std::to_string(output.size()));
+  RecordProperty("SerializeWriteFirstByteMs", std::to_string(writeTime.count()));
+  RecordProperty("SerializeStreamFirstByteMs", std::to_string(streamFirstByteTime.count()));
+  RecordProperty("SerializeStreamMs", std::to_string(streamTime.count()));
+#if defined(TARGET_LINUX)
+  RecordProperty("SerializeStreamPeakRssIncreaseKiB", std::to_string(streamMaxRss - maxRss));
+  RecordProperty("SerializeWritePeakRssIncreaseKiB", std::to_string(GetMaxRss() - maxRss));
+#endif
+}
@@ -13,7 +13,10 @@
 #include "utils/XTimeUtils.h"
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -211,3 +214,106 @@ TEST_F(TestJobManager, IsProcessing)
 
   job->FinishAndStopBlocking();
 }
+
+namespace
+{
+class CountingJob : public CJob
+{
+public:
+  CountingJob(std::atomic<unsigned int>& counter, unsigned int depth)
+    : m_counter(counter),
+      m_depth(depth)
+  {
+  }
+
+  bool DoWork() override
+  {
+    // children are queued from the worker thread, i.e. on its own shard
+    if (m_depth > 0)
+    {
+      for (unsigned int i = 0; i < 2; ++i)
+        CServiceBroker::GetJobManager()->AddJob(new CountingJob(m_counter, m_depth - 1), nullptr,
+                                                CJob::PRIORITY_NORMAL);
+    }
+    ++m_counter;
+    return true;
+  }
+
+private:
+  std::atomic<unsigned int>& m_counter;
+  unsigned int m_depth;
+};
+} // namespace
+
+TEST_F(TestJobManager, JobsFromManyThreads)
+{
+  constexpr unsigned int producers{4};
+  constexpr unsigned int jobsPerProducer{250};
+  std::atomic<unsigned int> done{0};
+
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < producers; ++i)
+    threads.emplace_back(
+        [&done]
+        {
+          for (unsigned int j = 0; j < jobsPerProducer; ++j)
+            CServiceBroker::GetJobManager()->AddJob(
+                new CountingJob(done, 0), nullptr,
+                static_cast<CJob::PRIORITY>(j % (CJob::PRIORITY_HIGH + 1)));
+        });
+  for (auto& thread : threads)
+    thread.join();
+
+  ASSERT_TRUE(poll([&done]() -> bool { return done == producers * jobsPerProducer; }));
+}
+
+TEST_F(TestJobManager, NestedJobs)
+{
+  constexpr unsigned int depth{6};
+  std::atomic<unsigned int> done{0};
+
+  CServiceBroker::GetJobManager()->AddJob(new CountingJob(done, depth), nullptr);
+
+  ASSERT_TRUE(poll([&done]() -> bool { return done == (1U << (depth + 1)) - 1; }));
+}
+
+TEST_F(TestJobManager, DISABLED_StressManySmallJobs)
+{
+  constexpr unsigned int producers{4};
+  constexpr unsigned int jobsPerProducer{5000};
+  constexpr unsigned int total{producers * jobsPerProducer};
+  std::atomic<unsigned int> done{0};
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < producers; ++i)
+    threads.emplace_back(
+        [&done]
+        {
+          for (unsigned int j = 0; j < jobsPerProducer; ++j)
+            CServiceBroker::GetJobManager()->AddJob(
+                new CountingJob(done, 0), nullptr,
+                static_cast<CJob::PRIORITY>(j % (CJob::PRIORITY_HIGH + 1)));
+        });
+  for (auto& thread : threads)
+    thread.join();
+
+  ASSERT_TRUE(poll([&done]() -> bool { return done == total; }));
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  RecordProperty("JobsPerSecond", static_cast<int>(total / elapsed.count()));
+}
+
+TEST_F(TestJobManager, DISABLED_StressNestedJobs)
+{
+  // a binary tree of jobs: 2^11 - 1 jobs in total, mostly queued by the workers themselves
+  constexpr unsigned int depth{10};
+  constexpr unsigned int total{(1U << (depth + 1)) - 1};
+  std::atomic<unsigned int> done{0};
+
+  const auto start = std::chrono::steady_clock::now();
+  CServiceBroker::GetJobManager()->AddJob(new CountingJob(done, depth), nullptr);
+
+  ASSERT_TRUE(poll([&done]() -> bool { return done == total; }));
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  RecordProperty("JobsPerSecond", static_cast<int>(total / elapsed.count()));
+}
@@ -6,11 +6,64 @@
  *  See LICENSES/README.md for more information.
  */
 
+#include "utils/SortEngine.h"
 #include "utils/SortUtils.h"
+#include "utils/StringUtils.h"
 #include "utils/Variant.h"
 
+#include <algorithm>
+#include <chrono>
+#include <random>
+
 #include <gtest/gtest.h>
 
+namespace
+{
+std::shared_ptr<SortItem> CreateItem(const std::string& label, int id)
+{
+  auto item = std::make_shared<SortItem>();
+  (*item)[Field::LABEL] = label;
+  (*item)[Field::ID] = id;
+  return item;
+}
+
+std::vector<int> GetIds(const SortItems& items)
+{
+  std::vector<int> ids;
+  for (const auto& item : items)
+    ids.push_back(static_cast<int>(item->at(Field::ID).asInteger()));
+  return ids;
+}
+
+/*!
+ * \brief A music library of the given size: artists with and without articles, albums, tracks.
+ */
+SortItems CreateLibrary(int songs)
+{
+  std::mt19937 random(4711);
+  const std::vector<std::string> words{"Black", "Red", "Night", "Rain", "Fire", "Émilie",
+                                       "Stone", "Blue", "Ocean", "Lights", "Æther", "Wolves"};
+  SortItems items;
+  items.reserve(songs);
+  for (int i = 0; i < songs; ++i)
+  {
+    const size_t artist = random() % 600;
+    const std::string artistName = StringUtils::Format(
+        "{}{} {}", artist % 4 == 0 ? "The " : "", words[artist % words.size()], artist);
+    auto item = std::make_shared<SortItem>();
+    (*item)[Field::ID] = i;
+    (*item)[Field::ARTIST] = artistName;
+    (*item)[Field::ARTIST_SORT] = "";
+    (*item)[Field::ALBUM] = StringUtils::Format("{} {}", words[random() % words.size()], artist);
+    (*item)[Field::YEAR] = static_cast<int>(1960 + random() % 60);
+    (*item)[Field::TRACK_NUMBER] = static_cast<int>(1 + random() % 20);
+    (*item)[Field::LABEL] = StringUtils::Format("Track {}", random() % 20);
+    items.push_back(item);
+  }
+  return items;
+}
+} // namespace
+
 TEST(TestSortUtils, Sort_SortBy)
 {
   SortItems items;
@@ -121,3 +174,117 @@ TEST(TestSortUtils, GetFieldsForSorting)
   EXPECT_EQ(Field::TRACK_NUMBER, *it);
   EXPECT_EQ(5U, fields.size());
 }
+
+TEST(TestSortUtils, Sort_Numbers)
+{
+  SortItems items{CreateItem("Track 10", 0), CreateItem("track 2", 1), CreateItem("Track 1", 2),
+                  CreateItem("(Intro)", 3), CreateItem("Track 02", 4), CreateItem("Ärger", 5)};
+
+  SortUtils::Sort(SortBy::LABEL, SortOrder::ASCENDING, SortAttributeNone, items);
+  EXPECT_EQ((std::vector<int>{3, 5, 2, 1, 4, 0}), GetIds(items));
+
+  SortUtils::Sort(SortBy::LABEL, SortOrder::DESCENDING, SortAttributeNone, items);
+  EXPECT_EQ((std::vector<int>{0, 1, 4, 2, 5, 3}), GetIds(items));
+}
+
+TEST(TestSortUtils, Sort_SpecialAndFolders)
+{
+  SortItems items;
+  for (int i = 0; i < 6; ++i)
+    items.push_back(CreateItem(std::string(1, static_cast<char>('f' - i)), i));
+  (*items[0])[Field::SORT_SPECIAL] = static_cast<int>(SortSpecial::BOTTOM);
+  (*items[5])[Field::SORT_SPECIAL] = static_cast<int>(SortSpecial::TOP);
+  (*items[4])[Field::SORT_SPECIAL] = static_cast<int>(SortSpecial::TOP);
+  for (int i = 0; i < 6; ++i)
+    (*items[i])[Field::FOLDER] = i == 1;
+
+  // the ones on top keep their order, folders go first
+  SortUtils::Sort(SortBy::LABEL, SortOrder::ASCENDING, SortAttributeNone, items);
+  EXPECT_EQ((std::vector<int>{4, 5, 1, 3, 2, 0}), GetIds(items));
+
+  SortUtils::Sort(SortBy::LABEL, SortOrder::DESCENDING, SortAttributeIgnoreFolders, items);
+  EXPECT_EQ((std::vector<int>{4, 5, 1, 2, 3, 0}), GetIds(items));
+}
+
+TEST(TestSortUtils, Sort_Stable)
+{
+  SortItems items;
+  for (int i = 0; i < 100; ++i)
+    items.push_back(CreateItem(i % 2 ? "B" : "a", i));
+
+  SortUtils::Sort(SortBy::LABEL, SortOrder::DESCENDING, SortAttributeNone, items);
+  const std::vector<int> ids = GetIds(items);
+  EXPECT_TRUE(std::is_sorted(ids.begin(), ids.begin() + 50));
+  EXPECT_TRUE(std::is_sorted(ids.begin() + 50, ids.end()));
+  EXPECT_EQ(1, ids.front());
+  EXPECT_EQ(98, ids.back());
+}
+
+TEST(TestSortUtils, Sort_Parallel)
+{
+  // large enough to be split across threads, with plenty of equal labels to keep in order
+  SortItems items = CreateLibrary(static_cast<int>(CSortEngine::PARALLEL_THRESHOLD) * 2 + 123);
+  for (const auto& item : items)
+    (*item)[Field::SORT] = item->at(Field::ARTIST);
+  items.front()->insert({Field::SORT_SPECIAL, static_cast<int>(SortSpecial::TOP)});
+  items.back()->insert({Field::SORT_SPECIAL, static_cast<int>(SortSpecial::BOTTOM)});
+
+  for (const SortOrder sortOrder : {SortOrder::ASCENDING, SortOrder::DESCENDING})
+  {
+    CSortEngine serial(sortOrder, SortAttributeNone);
+    for (const auto& item : items)
+      serial.Add(*item);
+    const std::vector<uint32_t> order = serial.Sort(1);
+    ASSERT_EQ(items.size(), order.size());
+    EXPECT_EQ(0U, order.front());
+    EXPECT_EQ(items.size() - 1, order.back());
+
+    // 0 picks the number of threads by the cores, which still sorts serially on a single one
+    for (const unsigned int threads : {2U, 3U, 8U, 0U})
+    {
+      CSortEngine parallel(sortOrder, SortAttributeNone);
+      for (const auto& item : items)
+        parallel.Add(*item);
+      EXPECT_EQ(order, parallel.Sort(threads)) << threads << " threads";
+    }
+  }
+}
+
+TEST(TestSortUtils, DISABLED_Benchmark)
+{
+  constexpr int songs = 60000;
+  SortItems items = CreateLibrary(songs);
+
+  const auto start = std::chrono::steady_clock::now();
+  SortUtils::Sort(SortBy::ARTIST, SortOrder::ASCENDING, SortAttributeIgnoreArticle, items);
+  const std::chrono::duration<double, std::milli> sorted = std::chrono::steady_clock::now() - start;
+
+  // what comparing the items used to cost, on the labels prepared above
+  SortItems compared = items;
+  std::ranges::shuffle(compared, std::mt19937(42));
+  const auto compareStart = std::chrono::steady_clock::now();
+  std::ranges::stable_sort(compared,
+                           [](const std::shared_ptr<SortItem>& left,
+                              const std::shared_ptr<SortItem>& right)
+                           {
+                             return StringUtils::AlphaNumericCompare(
+                                        left->at(Field::SORT).asWideString(),
+                                        right->at(Field::SORT).asWideString()) < 0;
+                           });
+  const std::chrono::duration<double, std::milli> variants =
+      std::chrono::steady_clock::now() - compareStart;
+
+  // ordered like comparing the labels, ties in their original order
+  for (size_t i = 1; i < items.size(); ++i)
+  {
+    const int64_t result = StringUtils::AlphaNumericCompare(
+        items[i - 1]->at(Field::SORT).asWideString(), items[i]->at(Field::SORT).asWideString());
+    ASSERT_LE(result, 0);
+    if (result == 0)
+      ASSERT_LT(items[i - 1]->at(Field::ID).asInteger(), items[i]->at(Field::ID).asInteger());
+  }
+
+  RecordProperty("Songs", songs);
+  RecordProperty("SortMs", static_cast<int>(sorted.count()));
+  RecordProperty("VariantCompareMs", static_cast<int>(variants.count()));
+}
@@ -288,12 +288,12 @@ bool CVideoDatabase::GetPathsForTvShow(int idShow, std::set<int>& paths)
   return false;
 }
 
-int CVideoDatabase::RunQuery(const std::string &sql)
+int CVideoDatabase::RunQuery(const std::string& sql, bool columnar /* = false */)
 {
   auto start = std::chrono::steady_clock::now();
 
   int rows = -1;
-  if (m_pDS->query(sql))
+  if (columnar ? m_pDS->query_columnar(sql) : m_pDS->query(sql))
   {
     rows = m_pDS->num_rows();
     if (rows == 0)
@@ -1287,14 +1287,15 @@ int CVideoDatabase::AddToTable(const std::string& table, const std::string& firs
     if (nullptr == m_pDS)
       return -1;
 
-    std::string strSQL = PrepareSQL("select %s from %s where %s like '%s'", firstField.c_str(), table.c_str(), secondField.c_str(), value.substr(0, 255).c_str());
-    m_pDS->query(strSQL);
+    const dbiplus::BindParams params = dbiplus::make_params(value.substr(0, 255));
+    std::string strSQL = PrepareSQL("select %s from %s where %s like ?", firstField.c_str(), table.c_str(), secondField.c_str());
+    m_pDS->query(strSQL, params);
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL = PrepareSQL("insert into %s (%s, %s) values(NULL, '%s')", table.c_str(), firstField.c_str(), secondField.c_str(), value.substr(0, 255).c_str());
-      m_pDS->exec(strSQL);
+      strSQL = PrepareSQL("insert into %s (%s, %s) values(NULL, ?)", table.c_str(), firstField.c_str(), secondField.c_str());
+      m_pDS->exec(strSQL, params);
       return static_cast<int>(m_pDS->lastinsertid());
     }
     else
@@ -1530,14 +1531,14 @@ int CVideoDatabase::AddActor(const std::string& name, const std::string& thumbUR
     std::string trimmedName = name;
     StringUtils::Trim(trimmedName);
 
-    std::string strSQL=PrepareSQL("select actor_id from actor where name like '%s'", trimmedName.substr(0, 255).c_str());
-    m_pDS->query(strSQL);
+    m_pDS->query("select actor_id from actor where name like ?",
+                 dbiplus::make_params(trimmedName.substr(0, 255)));
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL=PrepareSQL("insert into actor (actor_id, name, art_urls) values(NULL, '%s', '%s')", trimmedName.substr(0,255).c_str(), thumbURLs.c_str());
-      m_pDS->exec(strSQL);
+      m_pDS->exec("insert into actor (actor_id, name, art_urls) values(NULL, ?, ?)",
+                  dbiplus::make_params(trimmedName.substr(0, 255), thumbURLs));
       idActor = static_cast<int>(m_pDS->lastinsertid());
     }
     else
@@ -1546,10 +1547,8 @@ int CVideoDatabase::AddActor(const std::string& name, const std::string& thumbUR
       m_pDS->close();
       // update the thumb url's
       if (!thumbURLs.empty())
-      {
-        strSQL=PrepareSQL("update actor set art_urls = '%s' where actor_id = %i", thumbURLs.c_str(), idActor);
-        m_pDS->exec(strSQL);
-      }
+        m_pDS->exec("update actor set art_urls = ? where actor_id = ?",
+                    dbiplus::make_params(thumbURLs, idActor));
     }
     // add artwork
     if (!thumb.empty())
@@ -1567,26 +1566,27 @@ int CVideoDatabase::AddActor(const std::string& name, const std::string& thumbUR
 
 void CVideoDatabase::AddLinkToActor(int mediaId, const char *mediaType, int actorId, const std::string &role, int order)
 {
-  std::string sql = PrepareSQL("SELECT 1 FROM actor_link WHERE actor_id=%i AND "
-                               "media_id=%i AND media_type='%s' AND role='%s'",
-                               actorId, mediaId, mediaType, role.c_str());
-
-  if (GetSingleValue(sql).empty())
+  if (GetSingleValue("SELECT 1 FROM actor_link WHERE actor_id=? AND media_id=? AND "
+                     "media_type=? AND role=?",
+                     dbiplus::make_params(actorId, mediaId, mediaType, role))
+          .empty())
   { // doesn't exists, add it
-    sql = PrepareSQL("INSERT INTO actor_link (actor_id, media_id, media_type, role, cast_order) VALUES(%i,%i,'%s','%s',%i)", actorId, mediaId, mediaType, role.c_str(), order);
-    ExecuteQuery(sql);
+    ExecuteQuery("INSERT INTO actor_link (actor_id, media_id, media_type, role, cast_order) "
+                 "VALUES(?, ?, ?, ?, ?)",
+                 dbiplus::make_params(actorId, mediaId, mediaType, role, order));
   }
 }
 
 void CVideoDatabase::AddToLinkTable(int mediaId, const std::string& mediaType, const std::string& table, int valueId, const char *foreignKey)
 {
   const char *key = foreignKey ? foreignKey : table.c_str();
-  std::string sql = PrepareSQL("SELECT 1 FROM %s_link WHERE %s_id=%i AND media_id=%i AND media_type='%s'", table.c_str(), key, valueId, mediaId, mediaType.c_str());
+  const dbiplus::BindParams params = dbiplus::make_params(valueId, mediaId, mediaType);
+  std::string sql = PrepareSQL("SELECT 1 FROM %s_link WHERE %s_id=? AND media_id=? AND media_type=?", table.c_str(), key);
 
-  if (GetSingleValue(sql).empty())
+  if (GetSingleValue(sql, params).empty())
   { // doesn't exists, add it
-    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(%i,%i,'%s')", table.c_str(), key, valueId, mediaId, mediaType.c_str());
-    ExecuteQuery(sql);
+    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(?, ?, ?)", table.c_str(), key);
+    ExecuteQuery(sql, params);
   }
 }
 
@@ -8030,7 +8030,7 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
-    int iRowsFound = RunQuery(strSQL);
+    int iRowsFound = RunQuery(strSQL, true);
 
     // store the total value of items as a property
     if (total < iRowsFound)
@@ -8048,11 +8048,10 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
 
     // get data from returned rows
     items.Reserve(results.size());
-    const query_data &data = m_pDS->get_result_set().records;
     for (const auto &i : results)
     {
       const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_record(targetRow);
 
       CVideoInfoTag movie = GetDetailsForMovie(record, getDetails);
       if (m_profileManager.GetMasterProfile().getLockMode() == LockMode::EVERYONE ||
@@ -8190,7 +8189,7 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
-    int iRowsFound = RunQuery(strSQL);
+    int iRowsFound = RunQuery(strSQL, true);
 
     // store the total value of items as a property
     if (total < iRowsFound)
@@ -8207,11 +8206,10 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
 
     // get data from returned rows
     items.Reserve(results.size());
-    const query_data &data = m_pDS->get_result_set().records;
     for (const auto &i : results)
     {
       const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_record(targetRow);
 
       auto pItem = std::make_shared<CFileItem>();
       CVideoInfoTag movie = GetDetailsForTvShow(record, getDetails, pItem.get());
@@ -8319,7 +8317,7 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
-    int iRowsFound = RunQuery(strSQL);
+    int iRowsFound = RunQuery(strSQL, true);
 
     // store the total value of items as a property
     if (total < iRowsFound)
@@ -8338,11 +8336,10 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
     items.Reserve(results.size());
     CLabelFormatter formatter("%H. %T", "");
 
-    const query_data &data = m_pDS->get_result_set().records;
     for (const auto &i : results)
     {
       const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_record(targetRow);
 
       CVideoInfoTag episode = GetDetailsForEpisode(record, getDetails);
       if (m_profileManager.GetMasterProfile().getLockMode() == LockMode::EVERYONE ||
@@ -9335,7 +9332,7 @@ bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Fil
 
     strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
 
-    int iRowsFound = RunQuery(strSQL);
+    int iRowsFound = RunQuery(strSQL, true);
 
     // store the total value of items as a property
     if (total < iRowsFound)
@@ -9353,11 +9350,10 @@ bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Fil
     // get data from returned rows
     items.Reserve(results.size());
     // get songs from returned subtable
-    const query_data &data = m_pDS->get_result_set().records;
     for (const auto &i : results)
     {
       const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
-      const dbiplus::sql_record* const record = data.at(targetRow);
+      const dbiplus::sql_record* const record = m_pDS->get_record(targetRow);
 
       CVideoInfoTag musicvideo = GetDetailsForMusicVideo(record, getDetails);
       if (!checkLocks || m_profileManager.GetMasterProfile().getLockMode() == LockMode::EVERYONE ||
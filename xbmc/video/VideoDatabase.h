@@ -1204,9 +1204,10 @@ private:
   /*! \brief Run a query on the main dataset and return the number of rows
    If no rows are found we close the dataset and return 0.
    \param sql the sql query to run
+   \param columnar whether to keep the rows in a columnar result set, read them with get_record()
    \return the number of rows, -1 for an error.
    */
-  int RunQuery(const std::string &sql);
+  int RunQuery(const std::string& sql, bool columnar = false);
 
   void AppendIdLinkFilter(const char* field,
                           const char* table,
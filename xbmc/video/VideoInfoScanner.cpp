@@ -67,6 +67,7 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <set>
 #include <string>
@@ -380,6 +381,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
           }
         }
       }
+      m_prefetched.clear();
 
       if (!bCancelled)
       {
@@ -476,6 +478,11 @@ CVideoInfoScanner::~CVideoInfoScanner()
      */
     m_pathsToScan.erase(strDirectory);
 
+    // take what was prefetched while scanning the parent directory
+    std::optional<CDirectoryPrefetcher::Result> prefetched;
+    if (auto node = m_prefetched.extract(strDirectory); !node.empty())
+      prefetched = std::move(node.mapped());
+
     // load subfolder
     CFileItemList items;
     bool foundDirectly = false;
@@ -524,6 +531,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
     std::string hash, dbHash;
     bool listingHash = false; // hash came from GetPathHash over a fetched listing
+    std::vector<std::string> prefetchedPaths;
     if (content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS)
     {
       if (m_handle)
@@ -535,7 +543,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       std::string fastHash;
       if (m_advancedSettings->m_bVideoLibraryUseFastHash && !URIUtils::IsPlugin(strDirectory))
-        fastHash = GetFastHash(strDirectory, regexps);
+      {
+        if (prefetched)
+          fastHash = prefetched->time != 0 ? GetFastHash(regexps, prefetched->time) : "";
+        else
+          fastHash = GetFastHash(strDirectory, regexps);
+      }
 
       if (m_database.GetPathHash(strDirectory, dbHash) && !fastHash.empty() && StringUtils::EqualsNoCase(fastHash, dbHash))
       { // fast hashes match - no need to process anything
@@ -543,8 +556,15 @@ CVideoInfoScanner::~CVideoInfoScanner()
       }
       else
       { // need to fetch the folder
-        CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
-                                 DIR_FLAG_DEFAULTS);
+        if (prefetched && prefetched->listed)
+          items.Copy(*prefetched->items);
+        else
+          CDirectory::GetDirectory(strDirectory, items,
+                                   CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                                   DIR_FLAG_DEFAULTS);
+
+        // get the sub folders in parallel, the recursion below then only processes them
+        prefetchedPaths = PrefetchSubDirectories(items, regexps);
 
         // mark subfolders whose stored fast hash matches the listing mtime digest;
         // the disc structure probes in Stack() and the recursion loop (which also
@@ -567,8 +587,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
               std::none_of(stackRegExps.begin(), stackRegExps.end(),
                            [&label](CRegExp& re) { return re.RegFind(label) != -1; }) &&
               m_database.GetPathHash(items[i]->GetPath(), dbh) && !dbh.empty() &&
-              StringUtils::EqualsNoCase(rawTime != 0 ? GetFastHash(regexps, rawTime)
-                                                     : GetFastHash(items[i]->GetPath(), regexps),
+              StringUtils::EqualsNoCase(rawTime != 0
+                                            ? GetFastHash(regexps, rawTime)
+                                            : GetPrefetchedFastHash(items[i]->GetPath(), regexps),
                                         dbh))
             items[i]->SetProperty(PROPERTY_UNCHANGED, true);
           else if (HasNoMedia(items[i]->GetPath()))
@@ -817,6 +838,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
                  CURL::GetRedacted(strDirectory));
     }
 
+    // sub folders that were skipped or not recursed into
+    for (const std::string& path : prefetchedPaths)
+      m_prefetched.erase(path);
+
     return std::make_pair(m_bStop ? ScanComplete::Stopped : ScanComplete::Completed,
                           foundSomething || foundSomethingInArchive ? ContentFound::NewContentFound
                                                                     : ContentFound::None);
@@ -2969,6 +2994,70 @@ CVideoInfoScanner::~CVideoInfoScanner()
     return count;
   }
 
+  std::vector<std::string> CVideoInfoScanner::PrefetchSubDirectories(
+      const CFileItemList& items, const std::vector<std::string>& excludes)
+  {
+    std::vector<std::string> paths;
+    if (m_advancedSettings->m_videoLibraryScanConcurrency <= 1)
+      return paths;
+
+    // the stored hashes are looked up here, the database can't be used from the workers
+    std::vector<CDirectoryPrefetcher::Request> requests;
+    std::unordered_map<std::string, std::string> dbHashes;
+    for (const auto& item : items)
+    {
+      if (!item->IsFolder() || item->IsParentFolder() || item->IsPlugin() ||
+          PLAYLIST::IsPlayList(*item) || m_prefetched.contains(item->GetPath()))
+        continue;
+
+      int64_t rawTime = item->GetProperty(DIR_PROPERTY_STAT_MTIME).asInteger(0);
+      if (rawTime == 0)
+        rawTime = item->GetProperty(DIR_PROPERTY_STAT_CTIME).asInteger(0);
+      requests.push_back({item->GetPath(), rawTime});
+      m_database.GetPathHash(item->GetPath(), dbHashes[item->GetPath()]);
+    }
+    if (requests.size() < 2)
+      return paths;
+
+    // only list the folders the recursion will have to list: the ones whose fast hash changed
+    const bool useFastHash = m_advancedSettings->m_bVideoLibraryUseFastHash;
+    const auto needsListing = [&](const std::string& path, int64_t time)
+    {
+      const std::string& dbHash = dbHashes.at(path);
+      return !useFastHash || time == 0 || dbHash.empty() ||
+             !StringUtils::EqualsNoCase(GetFastHash(excludes, time), dbHash);
+    };
+
+    CDirectoryPrefetcher prefetcher(CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                                    DIR_FLAG_DEFAULTS,
+                                    m_advancedSettings->m_videoLibraryScanConcurrency);
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<CDirectoryPrefetcher::Result> results =
+        prefetcher.Fetch(requests, needsListing, m_bStop);
+    const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    CLog::Log(LOGDEBUG, "VideoInfoScanner: Prefetched {} sub folders of '{}' in {} ms",
+              results.size(), CURL::GetRedacted(items.GetPath()), duration.count());
+
+    paths.reserve(results.size());
+    for (auto& result : results)
+    {
+      paths.emplace_back(result.path);
+      m_prefetched.insert_or_assign(result.path, std::move(result));
+    }
+    return paths;
+  }
+
+  std::string CVideoInfoScanner::GetPrefetchedFastHash(
+      const std::string& directory, const std::vector<std::string>& excludes) const
+  {
+    const auto it = m_prefetched.find(directory);
+    if (it == m_prefetched.end())
+      return GetFastHash(directory, excludes);
+
+    return it->second.time != 0 ? GetFastHash(excludes, it->second.time) : "";
+  }
+
   bool CVideoInfoScanner::CanFastHash(const CFileItemList &items, const std::vector<std::string> &excludes) const
   {
     if (!m_advancedSettings->m_bVideoLibraryUseFastHash || items.IsPlugin())
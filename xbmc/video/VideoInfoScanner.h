@@ -12,6 +12,7 @@
 #include "VideoDatabase.h"
 #include "VideoManagerTypes.h"
 #include "addons/Scraper.h"
+#include "filesystem/DirectoryPrefetcher.h"
 #include "settings/VideoVersionsSettings.h"
 #include "utils/Artwork.h"
 #include "utils/RegExp.h"
@@ -22,6 +23,7 @@
 #include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 class CAdvancedSettings;
@@ -410,8 +412,27 @@ namespace KODI::VIDEO
      */
     std::string GetEditionFromFolderName(const std::string& folderName);
 
+    /*!
+     * \brief Get the times of the sub folders of a listing in parallel, along with the listings of
+     *        the ones whose fast hash changed, for the recursion in DoScan() to use.
+     * \param[in] items The listing
+     * \param[in] excludes The exclude regexps the fast hashes are computed with
+     * \return The paths of the prefetched sub folders
+     */
+    std::vector<std::string> PrefetchSubDirectories(const CFileItemList& items,
+                                                    const std::vector<std::string>& excludes);
+
+    /*!
+     * \brief Get the fast hash of a directory, from its prefetched time if there is one.
+     */
+    std::string GetPrefetchedFastHash(const std::string& directory,
+                                      const std::vector<std::string>& excludes) const;
+
     mutable KODI::REGEXP::RegExpCache m_regexpCache;
 
+    //! Sub folders of the directories being scanned, prefetched by PrefetchSubDirectories()
+    std::unordered_map<std::string, XFILE::CDirectoryPrefetcher::Result> m_prefetched;
+
     //! Editions known to the library, cached for the duration of a scan
     std::vector<std::string> m_videoVersionTypes;
     bool m_videoVersionTypesCached{false};
@@ -43,6 +43,7 @@
 #include "guilib/GUIEditControl.h"
 #include "guilib/GUIKeyboardFactory.h"
 #include "guilib/GUIWindowManager.h"
+#include "guilib/VirtualItemList.h"
 #include "input/actions/Action.h"
 #include "input/actions/ActionIDs.h"
 #include "interfaces/generic/ScriptInvocationManager.h"
@@ -59,6 +60,7 @@
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "storage/MediaManager.h"
+#include "threads/Event.h"
 #include "utils/FileUtils.h"
 #include "utils/LabelFormatter.h"
 #include "utils/SortUtils.h"
@@ -86,6 +88,20 @@ using namespace KODI;
 using namespace KODI::MESSAGING;
 using namespace std::chrono_literals;
 
+namespace
+{
+/*!
+ \brief Whether items are a virtual list whose source sorts it the way the view state wants.
+ Such a list can be shown as it is, anything else needs all of its items.
+ */
+bool IsSortedBySource(const CFileItemList& items, const CGUIViewState& viewState)
+{
+  SortDescription sorting = viewState.GetSortMethod();
+  sorting.sortOrder = viewState.GetSortOrder();
+  return items.IsVirtualSortedBy(sorting);
+}
+} // unnamed namespace
+
 CGUIMediaWindow::CGUIMediaWindow(int id, const char *xmlFile)
     : CGUIWindow(id, xmlFile)
 {
@@ -311,8 +327,12 @@ bool CGUIMediaWindow::OnMessage(CGUIMessage& message)
       }
       else if ( message.GetParam1() == GUI_MSG_REFRESH_THUMBS )
       {
-        for (int i = 0; i < m_vecItems->Size(); i++)
-          m_vecItems->Get(i)->FreeMemory(true);
+        // the items of a virtual list are only held by its container
+        if (!m_vecItems->GetVirtualItems())
+        {
+          for (const auto& item : *m_vecItems)
+            item->FreeMemory(true);
+        }
         break;  // the window will take care of any info images
       }
       else if (message.GetParam1() == GUI_MSG_REMOVED_MEDIA)
@@ -706,6 +726,14 @@ void CGUIMediaWindow::FormatAndSort(CFileItemList &items)
 
   if (viewState)
   {
+    // the source of a virtual list formats and sorts its items
+    if (IsSortedBySource(items, *viewState))
+      return;
+
+    // any other order needs all of its items, shown as the source sorts them if they can't be had
+    if (!MaterializeVirtualItems(items))
+      return;
+
     LABEL_MASKS labelMasks;
     viewState->GetSortMethodLabelMasks(labelMasks);
     FormatItemLabels(items, labelMasks);
@@ -714,6 +742,42 @@ void CGUIMediaWindow::FormatAndSort(CFileItemList &items)
   }
 }
 
+bool CGUIMediaWindow::MaterializeVirtualItems(CFileItemList& items)
+{
+  const std::shared_ptr<CVirtualItemList> virtualItems = items.GetVirtualItems();
+  if (!virtualItems)
+    return true;
+
+  // shared with the job, which keeps running when the wait is cancelled
+  struct CResult
+  {
+    CEvent event{true};
+    std::vector<std::shared_ptr<CFileItem>> items;
+    bool result = false;
+  };
+  const auto result = std::make_shared<CResult>();
+  CServiceBroker::GetJobManager()->Submit(
+      [virtualItems, result]
+      {
+        result->result = virtualItems->GetAll(result->items);
+        result->event.Set();
+      },
+      CJob::PRIORITY_HIGH);
+
+  if (!CGUIDialogBusy::WaitOnEvent(result->event, 100, true))
+    return false;
+
+  if (!result->result)
+  {
+    CLog::LogF(LOGERROR, "failed to get the virtual items of {}",
+               CURL::GetRedacted(items.GetPath()));
+    return false;
+  }
+
+  items.MaterializeVirtualItems(std::move(result->items));
+  return true;
+}
+
 /*!
  * \brief Overwrite to fill fileitems from a source
  *
@@ -1332,7 +1396,8 @@ void CGUIMediaWindow::RestoreSelectedItemFromHistory()
 {
   std::string strSelectedItem = m_history.GetSelectedItem(m_vecItems->GetPath());
 
-  if (!strSelectedItem.empty())
+  // finding the item would page in all of a virtual list
+  if (!strSelectedItem.empty() && !m_vecItems->GetVirtualItems())
   {
     for (int i = 0; i < m_vecItems->Size(); ++i)
     {
@@ -1543,6 +1608,8 @@ bool CGUIMediaWindow::OnPlayAndQueueMedia(const CFileItemPtr& item, const std::s
     // Remove ZIP, RAR files and folders
     CFileItemList playlist;
     playlist.Copy(*m_vecItems, true);
+    if (!MaterializeVirtualItems(playlist))
+      return false;
     erase_if(playlist, [](const std::shared_ptr<CFileItem>& i)
              { return i->IsZIP() || i->IsRAR() || i->IsFolder(); });
 
@@ -1622,9 +1689,18 @@ void CGUIMediaWindow::UpdateFileList()
     CServiceBroker::GetPlaylistPlayer().ClearPlaylist(playlistId);
     CServiceBroker::GetPlaylistPlayer().Reset();
 
-    for (int i = 0; i < m_vecItems->Size(); i++)
+    // fetch the items of a virtual list at once rather than page by page
+    CFileItemList virtualItems;
+    if (m_vecItems->GetVirtualItems())
     {
-      CFileItemPtr pItem = m_vecItems->Get(i);
+      virtualItems.Copy(*m_vecItems);
+      MaterializeVirtualItems(virtualItems);
+    }
+    const CFileItemList& items = m_vecItems->GetVirtualItems() ? virtualItems : *m_vecItems;
+
+    for (int i = 0; i < items.Size(); i++)
+    {
+      CFileItemPtr pItem = items.Get(i);
       if (pItem->IsFolder())
         continue;
 
@@ -1914,6 +1990,26 @@ void CGUIMediaWindow::OnFilterItems(const std::string &filter)
 {
   m_viewControl.Clear();
 
+  if (m_unfilteredItems->GetVirtualItems())
+  {
+    // a virtual list is shown as it is unless it has to be filtered or sorted by the window
+    std::string trimmedFilter(filter);
+    StringUtils::TrimLeft(trimmedFilter);
+    const std::unique_ptr<CGUIViewState> viewState(
+        CGUIViewState::GetViewState(GetID(), *m_unfilteredItems));
+    if (trimmedFilter.empty() && m_filter.IsEmpty() && !CURL(m_strFilterPath).HasOption("filter") &&
+        viewState && IsSortedBySource(*m_unfilteredItems, *viewState))
+    {
+      m_vecItems->ClearItems();
+      m_vecItems->ClearSortState();
+      m_vecItems->SetVirtualItems(m_unfilteredItems->GetVirtualItems());
+      SetProperty("filter", filter);
+      m_viewControl.SetItems(*m_vecItems);
+      return;
+    }
+    MaterializeVirtualItems(*m_unfilteredItems);
+  }
+
   CFileItemList items;
   items.Copy(*m_vecItems, false); // use the original path - it'll likely be relied on for other things later.
   items.Append(*m_unfilteredItems);
@@ -101,6 +101,13 @@ protected:
   virtual bool Refresh(bool clearCache = false);
 
   virtual void FormatAndSort(CFileItemList &items);
+  /*! \brief Turn a virtual list into a plain list, fetching all of its items with their art in a
+   job while the busy dialog shows.
+   \param items the list, left as it is if it is a plain list.
+   \return true if the list holds all of its items, false if fetching them failed or was cancelled.
+   \sa CFileItemList::SetVirtualItems
+   */
+  bool MaterializeVirtualItems(CFileItemList& items);
   virtual void OnPrepareFileItems(CFileItemList &items);
   virtual void OnCacheFileItems(CFileItemList &items);
   virtual void GetGroupedItems(CFileItemList &items) { }
@@ -13,6 +13,7 @@
 #include "ServiceBroker.h"
 #include "addons/Skin.h"
 #include "commons/ilog.h"
+#include "filesystem/DirectoryCache.h"
 #include "filesystem/SpecialProtocol.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIControlFactory.h"
@@ -133,6 +134,12 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+    const XFILE::DirectoryCacheStats dirStats = g_directoryCache.GetStats();
+    info += StringUtils::Format("\nDIR: {} dirs, {} hits, {} misses - disk: {} hits, {} stale, {} "
+                                "misses",
+                                dirStats.cachedDirs, dirStats.hits, dirStats.misses,
+                                dirStats.persistentHits, dirStats.persistentStale,
+                                dirStats.persistentMisses);
   }
 
   // render the skin debug info